@@ -6,6 +6,33 @@ namespace lasd {
 
 using ulong = unsigned long; // Definizione di ulong 
 
+// Occupazione di memoria di un contenitore, in byte (vedi MemoryUsage):
+//   payload     = gli elementi memorizzati (sizeof(Data) ciascuno, senza la
+//                 memoria che gli elementi allocano per conto loro);
+//   overhead    = la struttura: l'oggetto stesso, puntatori e vtable dei nodi,
+//                 separatori, flag;
+//   slack       = spazio allocato ma inutilizzato (capacità in eccesso);
+//   allocations = blocchi allocati ancora vivi (l'intestazione che malloc
+//                 aggiunge a ciascuno, 8-16 byte, non è compresa).
+struct MemStats {
+  ulong payload = 0;
+  ulong overhead = 0;
+  ulong slack = 0;
+  ulong allocations = 0;
+
+  inline ulong Total() const noexcept {
+    return payload + overhead + slack;
+  }
+
+  inline MemStats& operator+=(const MemStats& mem) noexcept {
+    payload += mem.payload;
+    overhead += mem.overhead;
+    slack += mem.slack;
+    allocations += mem.allocations;
+    return *this;
+  }
+};
+
 class Container {
 protected:
 
@@ -33,6 +60,9 @@ public:
     return size;
   }
 
+  // Occupazione di memoria attuale
+  virtual MemStats MemoryUsage() const noexcept = 0;
+
 };
 
 
@@ -1,4 +1,6 @@
 
+#include <algorithm>
+
 namespace lasd {
 
 /* ************************************************************************** */
@@ -8,6 +10,11 @@ namespace lasd {
 template<typename Data>
 bool LinearContainer<Data>::operator==(const LinearContainer<Data> & con) const noexcept {
   if (this->Size() == con.Size()) {
+    const Data * fst = Contiguous();
+    const Data * snd = con.Contiguous();
+    if (fst != nullptr && snd != nullptr) {
+      return std::equal(fst, fst + this->Size(), snd);
+    }
     for (ulong index = 0; index < this->Size(); ++index) {
       if (operator[](index) != con.operator[](index)) {
         return false;
@@ -55,6 +62,12 @@ inline void LinearContainer<Data>::Traverse(TraverseFun fun) const {
 
 template<typename Data>
 inline void LinearContainer<Data>::PreOrderTraverse(TraverseFun fun) const {
+  if (const Data * elm = Contiguous()) {
+    for (const Data * cur = elm; cur != elm + this->Size(); ++cur) {
+      fun(*cur);
+    }
+    return;
+  }
   for (ulong index = 0; index < this->Size(); ++index) {
     fun(operator[](index));
   }
@@ -67,6 +80,12 @@ inline void LinearContainer<Data>::PreOrderTraverse(TraverseFun fun) const {
 template<typename Data>
 inline void LinearContainer<Data>::PostOrderTraverse(TraverseFun fun) const {
   ulong index = this->Size();
+  if (const Data * elm = Contiguous()) {
+    while (index > 0) {
+      fun(elm[--index]);
+    }
+    return;
+  }
   while (index > 0) {
     fun(operator[](--index));
   }
@@ -119,6 +138,12 @@ inline void MutableLinearContainer<Data>::Map(MapFun fun) {
 
 template<typename Data>
 inline void MutableLinearContainer<Data>::PreOrderMap(MapFun fun) {
+  if (Data * elm = this->MutableContiguous()) {
+    for (Data * cur = elm; cur != elm + this->Size(); ++cur) {
+      fun(*cur);
+    }
+    return;
+  }
   for (ulong index = 0; index < this->Size(); ++index) {
     fun(operator[](index));
   }
@@ -131,6 +156,12 @@ inline void MutableLinearContainer<Data>::PreOrderMap(MapFun fun) {
 template<typename Data>
 inline void MutableLinearContainer<Data>::PostOrderMap(MapFun fun) {
   ulong index = this->Size();
+  if (Data * elm = this->MutableContiguous()) {
+    while (index > 0) {
+      fun(elm[--index]);
+    }
+    return;
+  }
   while (index > 0) {
     fun(operator[](--index));
   }
@@ -142,29 +173,38 @@ inline void MutableLinearContainer<Data>::PostOrderMap(MapFun fun) {
 
 template<typename Data>
 void SortableLinearContainer<Data>::Sort() noexcept {
-  QuickSort(0, this->Size() - 1);
+  if (this->Size() < 2) {
+    return;
+  }
+  if (Data * elm = this->MutableContiguous()) {
+    QuickSort([elm](ulong index) -> Data & { return elm[index]; }, 0, this->Size() - 1);
+  } else {
+    QuickSort([this](ulong index) -> Data & { return this->operator[](index); }, 0, this->Size() - 1);
+  }
 }
 
 template<typename Data>
-void SortableLinearContainer<Data>::QuickSort(ulong p, ulong r) noexcept {
+template<typename Elm>
+void SortableLinearContainer<Data>::QuickSort(Elm elm, ulong p, ulong r) noexcept {
   if (p < r) {
-    ulong q = Partition(p, r);
-    QuickSort(p, q);
-    QuickSort(q + 1, r);
+    ulong q = Partition(elm, p, r);
+    QuickSort(elm, p, q);
+    QuickSort(elm, q + 1, r);
   }
 }
 
 template<typename Data>
-ulong SortableLinearContainer<Data>::Partition(ulong p, ulong r) noexcept {
-  Data x = this->operator[](p);
+template<typename Elm>
+ulong SortableLinearContainer<Data>::Partition(Elm elm, ulong p, ulong r) noexcept {
+  Data x = elm(p);
   ulong i = p - 1;
   ulong j = r + 1;
   do {
     do { j--; }
-    while (x < this->operator[](j));
+    while (x < elm(j));
     do { i++; }
-    while (x > this->operator[](i));
-    if (i < j) { std::swap(this->operator[](i), this->operator[](j)); }
+    while (x > elm(i));
+    if (i < j) { std::swap(elm(i), elm(j)); }
   }
   while (i < j);
   return j;
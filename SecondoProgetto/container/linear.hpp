@@ -48,7 +48,11 @@ namespace lasd
 
         inline void PostOrderTraverse(TraverseFun) const override;
 
- 
+    protected:
+        // Elementi contigui in memoria (nullptr se non lo sono): gli algoritmi
+        // generici qui sotto li scorrono con un puntatore invece di chiamare
+        // per ogni elemento l'operator[] virtuale e controllato
+        virtual const Data *Contiguous() const noexcept { return nullptr; }
     };
 
     /* ************************************************************************** */
@@ -98,6 +102,11 @@ namespace lasd
         // Specific member function (inherited from PostOrderMappableContainer)
 
         inline void PostOrderMap(MapFun) override;
+
+    protected:
+        // Gli stessi elementi di Contiguous, modificabili (nullptr se non sono
+        // contigui): chi ridefinisce l'uno ridefinisce anche l'altro
+        virtual Data *MutableContiguous() noexcept { return nullptr; }
     };
 
     /* ************************************************************************** */
@@ -122,10 +131,13 @@ namespace lasd
         virtual void Sort() noexcept;
 
     protected:
-        // Auxiliary member functions
+        // Auxiliary member functions: elm(i) restituisce l'i-esimo elemento
+        // (con operator[] in generale, con un puntatore se sono contigui)
 
-        void QuickSort(ulong p, ulong r) noexcept;
-        ulong Partition(ulong p, ulong r) noexcept;
+        template <typename Elm>
+        static void QuickSort(Elm, ulong p, ulong r) noexcept;
+        template <typename Elm>
+        static ulong Partition(Elm, ulong p, ulong r) noexcept;
     };
 
     /* ************************************************************************** */
@@ -0,0 +1,221 @@
+#ifndef FLAT_ADAPTER_HPP
+#define FLAT_ADAPTER_HPP
+
+/* ************************************************************************** */
+/*
+  adapter.hpp - Adattatori dai contenitori flat alle interfacce polimorfe
+
+  Un adattatore è una vista sottile su un contenitore flat (che non copia e
+  che deve vivere meno di lui): implementa le interfacce virtuali della
+  libreria inoltrando ogni chiamata al contenitore, così un FlatVector o un
+  FlatSetVec si possono passare dove serve un LinearContainer, un Set, una
+  PQ, o a un costruttore che accetta un TraversableContainer. La chiamata
+  virtuale si paga solo attraversando l'adattatore.
+
+    LinearAdapter        - LinearContainer (ogni contenitore flat)
+    MutableLinearAdapter - MutableLinearContainer (FlatVector, FlatList)
+    SetAdapter           - Set (FlatSetVec)
+    PQAdapter            - PQ (FlatPQHeap)
+*/
+
+/* ************************************************************************** */
+
+#include <concepts>
+
+#include "../container/linear.hpp"
+#include "../set/set.hpp"
+#include "../pq/pq.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Flat>
+class LinearAdapter : virtual public LinearContainer<typename Flat::value_type> {
+protected:
+
+  using Data = typename Flat::value_type;
+
+  const Flat & con;
+
+public:
+
+  explicit LinearAdapter(const Flat & flat) noexcept : con(flat) {}
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from Container)
+
+  inline ulong Size() const noexcept override { return con.Size(); }
+
+  inline MemStats MemoryUsage() const noexcept override { return con.MemoryUsage(); }
+
+  // Specific member function (inherited from TestableContainer)
+
+  inline bool Exists(const Data & val) const noexcept override { return con.Exists(val); }
+
+  // Specific member functions (inherited from LinearContainer)
+
+  inline const Data & operator[](ulong index) const override { return con[index]; }
+  inline const Data & Front() const override { return con.Front(); }
+  inline const Data & Back() const override { return con.Back(); }
+
+  // Specific member functions (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+
+  inline void Traverse(TraverseFun fun) const override { con.Traverse(fun); }
+  inline void PreOrderTraverse(TraverseFun fun) const override { con.PreOrderTraverse(fun); }
+  inline void PostOrderTraverse(TraverseFun fun) const override { con.PostOrderTraverse(fun); }
+
+protected:
+
+  // Gli algoritmi generici di LinearContainer (operator==) scorrono il puntatore
+  inline const Data * Contiguous() const noexcept override {
+    if constexpr (requires { con.data(); }) {
+      return con.data();
+    } else {
+      return nullptr;
+    }
+  }
+
+};
+
+/* ************************************************************************** */
+
+template <typename Flat>
+class MutableLinearAdapter : virtual public MutableLinearContainer<typename Flat::value_type>, public LinearAdapter<Flat> {
+protected:
+
+  using typename LinearAdapter<Flat>::Data;
+
+  Flat & mcon;
+
+public:
+
+  explicit MutableLinearAdapter(Flat & flat) noexcept : LinearAdapter<Flat>(flat), mcon(flat) {}
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from MutableLinearContainer)
+
+  using LinearAdapter<Flat>::operator[];
+  using LinearAdapter<Flat>::Front;
+  using LinearAdapter<Flat>::Back;
+
+  inline Data & operator[](ulong index) override { return mcon[index]; }
+  inline Data & Front() override { return mcon.Front(); }
+  inline Data & Back() override { return mcon.Back(); }
+
+  // Specific member functions (inherited from MappableContainer)
+
+  using typename MappableContainer<Data>::MapFun;
+
+  inline void Map(MapFun fun) override { mcon.Map(fun); }
+  inline void PreOrderMap(MapFun fun) override { mcon.PreOrderMap(fun); }
+  inline void PostOrderMap(MapFun fun) override { mcon.PostOrderMap(fun); }
+
+protected:
+
+  inline Data * MutableContiguous() noexcept override {
+    if constexpr (requires { { mcon.data() } -> std::same_as<Data *>; }) {
+      return mcon.data();
+    } else {
+      return nullptr;
+    }
+  }
+
+};
+
+/* ************************************************************************** */
+
+template <typename Flat>
+class SetAdapter : virtual public Set<typename Flat::value_type>, public LinearAdapter<Flat> {
+protected:
+
+  using typename LinearAdapter<Flat>::Data;
+
+  Flat & mcon;
+
+public:
+
+  explicit SetAdapter(Flat & flat) noexcept : LinearAdapter<Flat>(flat), mcon(flat) {}
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  inline const Data & Min() const override { return mcon.Min(); }
+  inline Data MinNRemove() override { return mcon.MinNRemove(); }
+  inline void RemoveMin() override { mcon.RemoveMin(); }
+
+  inline const Data & Max() const override { return mcon.Max(); }
+  inline Data MaxNRemove() override { return mcon.MaxNRemove(); }
+  inline void RemoveMax() override { mcon.RemoveMax(); }
+
+  inline const Data & Predecessor(const Data & val) const override { return mcon.Predecessor(val); }
+  inline Data PredecessorNRemove(const Data & val) override { return mcon.PredecessorNRemove(val); }
+  inline void RemovePredecessor(const Data & val) override { mcon.RemovePredecessor(val); }
+
+  inline const Data & Successor(const Data & val) const override { return mcon.Successor(val); }
+  inline Data SuccessorNRemove(const Data & val) override { return mcon.SuccessorNRemove(val); }
+  inline void RemoveSuccessor(const Data & val) override { mcon.RemoveSuccessor(val); }
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  inline bool Insert(const Data & val) override { return mcon.Insert(val); }
+  inline bool Insert(Data && val) override { return mcon.Insert(std::move(val)); }
+  inline bool Remove(const Data & val) override { return mcon.Remove(val); }
+
+  // Set ridichiara come astratti anche questi: li si riprende dall'adattatore lineare
+
+  inline const Data & operator[](ulong index) const override { return LinearAdapter<Flat>::operator[](index); }
+  inline bool Exists(const Data & val) const noexcept override { return LinearAdapter<Flat>::Exists(val); }
+
+  // Specific member function (inherited from ClearableContainer)
+
+  inline void Clear() override { mcon.Clear(); }
+
+};
+
+/* ************************************************************************** */
+
+template <typename Flat>
+class PQAdapter : virtual public PQ<typename Flat::value_type>, public LinearAdapter<Flat> {
+protected:
+
+  using typename LinearAdapter<Flat>::Data;
+
+  Flat & mcon;
+
+public:
+
+  explicit PQAdapter(Flat & flat) noexcept : LinearAdapter<Flat>(flat), mcon(flat) {}
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  inline const Data & Tip() const override { return mcon.Tip(); }
+  inline void RemoveTip() override { mcon.RemoveTip(); }
+  inline Data TipNRemove() override { return mcon.TipNRemove(); }
+
+  inline void Insert(const Data & val) override { mcon.Insert(val); }
+  inline void Insert(Data && val) override { mcon.Insert(std::move(val)); }
+
+  inline void Change(const ulong index, const Data & val) override { mcon.Change(index, val); }
+  inline void Change(const ulong index, Data && val) override { mcon.Change(index, std::move(val)); }
+
+  // Specific member function (inherited from ClearableContainer)
+
+  inline void Clear() override { mcon.Clear(); }
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#endif
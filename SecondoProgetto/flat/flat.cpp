@@ -0,0 +1,123 @@
+#include <algorithm>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Specific member functions (FlatContainer)
+
+template <typename Derived, typename Data>
+inline bool FlatContainer<Derived, Data>::Empty() const noexcept {
+  return (Self().Size() == 0);
+}
+
+template <typename Derived, typename Data>
+bool FlatContainer<Derived, Data>::Exists(const Data & val) const noexcept {
+  bool found = false;
+  Self().Traverse(
+    [&val, &found](const Data & dat) {
+      found |= (dat == val);
+    }
+  );
+  return found;
+}
+
+template <typename Derived, typename Data>
+template <typename Accumulator, typename Fun>
+Accumulator FlatContainer<Derived, Data>::Fold(Fun fun, Accumulator acc) const {
+  Self().Traverse(
+    [&fun, &acc](const Data & dat) {
+      acc = fun(dat, acc);
+    }
+  );
+  return acc;
+}
+
+/* ************************************************************************** */
+
+// Comparison operators (FlatLinear)
+
+template <typename Derived, typename Data>
+template <typename Other>
+bool FlatLinear<Derived, Data>::operator==(const FlatLinear<Other, Data> & con) const noexcept {
+  return std::equal(begin(), end(), con.begin(), con.end());
+}
+
+template <typename Derived, typename Data>
+template <typename Other>
+inline bool FlatLinear<Derived, Data>::operator!=(const FlatLinear<Other, Data> & con) const noexcept {
+  return !(*this == con);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (FlatLinear)
+
+template <typename Derived, typename Data>
+inline const Data & FlatLinear<Derived, Data>::operator[](ulong index) const {
+  if (index >= Self().Size()) [[unlikely]] {
+    OutOfRange(index, Self().Size());
+  }
+  return Self().data()[index];
+}
+
+template <typename Derived, typename Data>
+inline const Data & FlatLinear<Derived, Data>::Front() const {
+  if (Self().Size() == 0) [[unlikely]] {
+    EmptyAccess();
+  }
+  return Self().data()[0];
+}
+
+template <typename Derived, typename Data>
+inline const Data & FlatLinear<Derived, Data>::Back() const {
+  if (Self().Size() == 0) [[unlikely]] {
+    EmptyAccess();
+  }
+  return Self().data()[Self().Size() - 1];
+}
+
+template <typename Derived, typename Data>
+bool FlatLinear<Derived, Data>::Exists(const Data & val) const noexcept {
+  return (std::find(begin(), end(), val) != end());
+}
+
+template <typename Derived, typename Data>
+template <typename Fun>
+void FlatLinear<Derived, Data>::Traverse(Fun fun) const {
+  PreOrderTraverse(fun);
+}
+
+template <typename Derived, typename Data>
+template <typename Fun>
+void FlatLinear<Derived, Data>::PreOrderTraverse(Fun fun) const {
+  for (const Data * cur = begin(); cur != end(); ++cur) {
+    fun(*cur);
+  }
+}
+
+template <typename Derived, typename Data>
+template <typename Fun>
+void FlatLinear<Derived, Data>::PostOrderTraverse(Fun fun) const {
+  for (const Data * cur = end(); cur != begin(); ) {
+    fun(*--cur);
+  }
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions (FlatLinear)
+
+template <typename Derived, typename Data>
+void FlatLinear<Derived, Data>::OutOfRange(ulong index, ulong num) {
+  throw std::out_of_range("Access at index " + std::to_string(index) + "; container size " + std::to_string(num) + ".");
+}
+
+template <typename Derived, typename Data>
+void FlatLinear<Derived, Data>::EmptyAccess() {
+  throw std::length_error("Access to an empty container.");
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,130 @@
+#ifndef FLAT_HPP
+#define FLAT_HPP
+
+/* ************************************************************************** */
+/*
+  flat.hpp - Basi CRTP della famiglia "flat"
+
+  I contenitori della libreria stanno in un reticolo di ereditarietà virtuale
+  (Container, ClearableContainer, ResizableContainer, TraversableContainer,
+  MappableContainer, LinearContainer, ...): anche Size() ed Empty() sono
+  virtuali, size si raggiunge tramite l'offset di una base virtuale e ogni
+  visita passa da una std::function.
+
+  I contenitori flat (FlatVector, FlatList, FlatSetVec, FlatHeapVec,
+  FlatPQHeap) offrono le stesse operazioni con classi final, senza vtable e
+  senza basi virtuali: le parti comuni stanno in queste basi CRTP, che
+  chiamano il contenitore concreto (Derived) con un static_cast, e le visite
+  accettano una qualunque funzione, che il compilatore può espandere inline.
+  Per passarli alle funzioni che si aspettano le interfacce polimorfe ci sono
+  gli adattatori di adapter.hpp.
+*/
+
+/* ************************************************************************** */
+
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include "../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Derived fornisce Size() e Traverse(fun) const
+template <typename Derived, typename Data>
+class FlatContainer {
+protected:
+
+  FlatContainer() = default;
+  ~FlatContainer() = default; // Non virtuale: non si distrugge tramite la base
+
+public:
+
+  using value_type = Data;
+
+  // Specific member functions
+
+  inline bool Empty() const noexcept;
+
+  bool Exists(const Data &) const noexcept; // Ricerca lineare (i set la ridefiniscono)
+
+  template <typename Accumulator, typename Fun>
+  Accumulator Fold(Fun, Accumulator) const; // fun(dat, acc) restituisce il nuovo accumulatore
+
+protected:
+
+  inline const Derived & Self() const noexcept { return static_cast<const Derived &>(*this); }
+  inline Derived & Self() noexcept { return static_cast<Derived &>(*this); }
+
+};
+
+/* ************************************************************************** */
+
+// Contenitori flat con gli elementi contigui: Derived fornisce Size() e
+// data() const (i Size() elementi in ordine). Accesso, visite e confronto
+// scorrono direttamente il puntatore.
+template <typename Derived, typename Data>
+class FlatLinear : public FlatContainer<Derived, Data> {
+protected:
+
+  using FlatContainer<Derived, Data>::Self;
+
+  FlatLinear() = default;
+  ~FlatLinear() = default;
+
+public:
+
+  // Comparison operators (stessi elementi nello stesso ordine, anche tra contenitori flat diversi)
+  template <typename Other>
+  bool operator==(const FlatLinear<Other, Data> &) const noexcept;
+  template <typename Other>
+  inline bool operator!=(const FlatLinear<Other, Data> &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline const Data & operator[](ulong) const; // std::out_of_range se fuori indice
+  inline const Data & Front() const; // std::length_error se vuoto
+  inline const Data & Back() const; // std::length_error se vuoto
+
+  inline const Data & UncheckedAt(ulong index) const noexcept { return Self().data()[index]; }
+
+  inline std::span<const Data> Span() const noexcept { return std::span<const Data>(Self().data(), Self().Size()); }
+
+  using const_iterator = const Data *;
+
+  inline const_iterator begin() const noexcept { return Self().data(); }
+  inline const_iterator end() const noexcept { return Self().data() + Self().Size(); }
+  inline const_iterator cbegin() const noexcept { return begin(); }
+  inline const_iterator cend() const noexcept { return end(); }
+
+  bool Exists(const Data &) const noexcept;
+
+  template <typename Fun>
+  void Traverse(Fun) const;
+  template <typename Fun>
+  void PreOrderTraverse(Fun) const;
+  template <typename Fun>
+  void PostOrderTraverse(Fun) const;
+
+protected:
+
+  // Auxiliary functions
+
+  [[noreturn]] static void OutOfRange(ulong, ulong);
+  [[noreturn]] static void EmptyAccess();
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "flat.cpp"
+
+#endif
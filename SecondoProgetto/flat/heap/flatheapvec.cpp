@@ -0,0 +1,107 @@
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Specific constructors
+
+template <typename Data>
+FlatHeapVec<Data>::FlatHeapVec(const TraversableContainer<Data> & con) : vec(con) {
+  Heapify();
+}
+
+template <typename Data>
+FlatHeapVec<Data>::FlatHeapVec(MappableContainer<Data> && con) : vec(std::move(con)) {
+  Heapify();
+}
+
+template <typename Data>
+template <typename Other>
+FlatHeapVec<Data>::FlatHeapVec(const FlatContainer<Other, Data> & con) : vec(con) {
+  Heapify();
+}
+
+/* ************************************************************************** */
+
+// Heap operations
+
+template <typename Data>
+bool FlatHeapVec<Data>::IsHeap() const noexcept {
+  const Data * elm = vec.data();
+  for (ulong i = 1; i < vec.Size(); ++i) {
+    if (elm[(i - 1) / 2] < elm[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Data>
+void FlatHeapVec<Data>::Heapify() noexcept {
+  MakeHeap(vec.data(), vec.Size());
+}
+
+template <typename Data>
+void FlatHeapVec<Data>::Sort() noexcept {
+  Data * elm = vec.data();
+  MakeHeap(elm, vec.Size());
+  for (ulong i = vec.Size(); i > 1; --i) {
+    std::swap(elm[0], elm[i - 1]);
+    HeapifyDown(elm, i - 1, 0);
+  }
+}
+
+template <typename Data>
+MemStats FlatHeapVec<Data>::MemoryUsage() const noexcept {
+  MemStats mem = vec.MemoryUsage();
+  mem.overhead += sizeof(*this) - sizeof(vec); // Il resto dell'oggetto
+  return mem;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+
+template <typename Data>
+void FlatHeapVec<Data>::HeapifyDown(Data * elm, ulong num, ulong i) noexcept {
+  while (true) {
+    ulong largest = i;
+    ulong left = 2 * i + 1;
+    ulong right = 2 * i + 2;
+    if (left < num && elm[left] > elm[largest]) {
+      largest = left;
+    }
+    if (right < num && elm[right] > elm[largest]) {
+      largest = right;
+    }
+    if (largest == i) {
+      return;
+    }
+    std::swap(elm[i], elm[largest]);
+    i = largest;
+  }
+}
+
+template <typename Data>
+void FlatHeapVec<Data>::HeapifyUp(Data * elm, ulong i) noexcept {
+  while (i > 0) {
+    ulong parent = (i - 1) / 2;
+    if (!(elm[i] > elm[parent])) {
+      return;
+    }
+    std::swap(elm[i], elm[parent]);
+    i = parent;
+  }
+}
+
+template <typename Data>
+void FlatHeapVec<Data>::MakeHeap(Data * elm, ulong num) noexcept {
+  for (ulong i = num / 2; i > 0; --i) {
+    HeapifyDown(elm, num, i - 1);
+  }
+}
+
+/* ************************************************************************** */
+
+}
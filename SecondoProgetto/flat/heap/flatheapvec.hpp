@@ -0,0 +1,86 @@
+#ifndef FLATHEAPVEC_HPP
+#define FLATHEAPVEC_HPP
+
+/* ************************************************************************** */
+/*
+  flatheapvec.hpp - Definizione della classe FlatHeapVec
+
+  Le operazioni di HeapVec (max-heap su un vettore) in una classe final
+  (vedi flat/flat.hpp). Gli aggiustamenti dello heap lavorano su un
+  puntatore e sono iterativi; FlatPQHeap li riusa sul proprio buffer.
+*/
+
+/* ************************************************************************** */
+
+#include "../flat.hpp"
+#include "../vector/flatvector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+class FlatPQHeap;
+
+template <typename Data>
+class FlatHeapVec final : public FlatLinear<FlatHeapVec<Data>, Data> {
+
+  friend class FlatPQHeap<Data>;
+
+protected:
+
+  FlatVector<Data> vec;
+
+public:
+
+  // Default constructor
+  FlatHeapVec() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  FlatHeapVec(const TraversableContainer<Data> &); // Dalle interfacce polimorfe
+  FlatHeapVec(MappableContainer<Data> &&);
+  template <typename Other>
+  explicit FlatHeapVec(const FlatContainer<Other, Data> &); // Da un altro contenitore flat
+
+  /* ************************************************************************ */
+
+  // Copy and move constructors, destructor and assignments: quelli di FlatVector
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline ulong Size() const noexcept { return vec.Size(); }
+
+  inline const Data * data() const noexcept { return vec.data(); }
+
+  bool IsHeap() const noexcept;
+  void Heapify() noexcept;
+
+  void Sort() noexcept; // HeapSort: lascia gli elementi in ordine crescente
+
+  inline void Clear() noexcept { vec.Clear(); }
+
+  MemStats MemoryUsage() const noexcept;
+
+protected:
+
+  // Auxiliary functions (sui primi num elementi di elm)
+
+  static void HeapifyDown(Data *, ulong num, ulong) noexcept;
+  static void HeapifyUp(Data *, ulong) noexcept;
+  static void MakeHeap(Data *, ulong num) noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "flatheapvec.cpp"
+
+#endif
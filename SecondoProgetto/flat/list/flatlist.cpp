@@ -0,0 +1,338 @@
+#include <memory>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Specific constructors
+
+template <typename Data>
+FlatList<Data>::FlatList(const TraversableContainer<Data> & con) {
+  con.Traverse(
+    [this](const Data & dat) {
+      InsertAtBack(dat);
+    }
+  );
+}
+
+template <typename Data>
+FlatList<Data>::FlatList(MappableContainer<Data> && con) {
+  con.Map(
+    [this](Data & dat) {
+      InsertAtBack(std::move(dat));
+    }
+  );
+}
+
+template <typename Data>
+template <typename Other>
+FlatList<Data>::FlatList(const FlatContainer<Other, Data> & con) {
+  static_cast<const Other &>(con).Traverse(
+    [this](const Data & dat) {
+      InsertAtBack(dat);
+    }
+  );
+}
+
+/* ************************************************************************** */
+
+// Copy constructor
+template <typename Data>
+FlatList<Data>::FlatList(const FlatList<Data> & lst) {
+  for (Node * cur = lst.head; cur != nullptr; cur = cur->next) {
+    InsertAtBack(cur->element);
+  }
+}
+
+// Move constructor
+template <typename Data>
+FlatList<Data>::FlatList(FlatList<Data> && lst) noexcept {
+  std::swap(head, lst.head);
+  std::swap(tail, lst.tail);
+  std::swap(size, lst.size);
+}
+
+// Destructor
+template <typename Data>
+FlatList<Data>::~FlatList() {
+  Clear();
+}
+
+/* ************************************************************************** */
+
+// Copy assignment
+template <typename Data>
+FlatList<Data> & FlatList<Data>::operator=(const FlatList<Data> & lst) {
+  FlatList<Data> tmp(lst);
+  std::swap(head, tmp.head);
+  std::swap(tail, tmp.tail);
+  std::swap(size, tmp.size);
+  return *this;
+}
+
+// Move assignment
+template <typename Data>
+FlatList<Data> & FlatList<Data>::operator=(FlatList<Data> && lst) noexcept {
+  std::swap(head, lst.head);
+  std::swap(tail, lst.tail);
+  std::swap(size, lst.size);
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// Comparison operators
+
+template <typename Data>
+bool FlatList<Data>::operator==(const FlatList<Data> & lst) const noexcept {
+  if (size != lst.size) {
+    return false;
+  }
+  for (Node * fst = head, * snd = lst.head; fst != nullptr; fst = fst->next, snd = snd->next) {
+    if (fst->element != snd->element) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Data>
+inline bool FlatList<Data>::operator!=(const FlatList<Data> & lst) const noexcept {
+  return !(*this == lst);
+}
+
+/* ************************************************************************** */
+
+// Insertions and removals
+
+template <typename Data>
+void FlatList<Data>::InsertAtFront(const Data & dat) {
+  Node * nod = new Node(dat);
+  nod->next = head;
+  head = nod;
+  if (tail == nullptr) {
+    tail = nod;
+  }
+  ++size;
+}
+
+template <typename Data>
+void FlatList<Data>::InsertAtFront(Data && dat) {
+  Node * nod = new Node(std::move(dat));
+  nod->next = head;
+  head = nod;
+  if (tail == nullptr) {
+    tail = nod;
+  }
+  ++size;
+}
+
+template <typename Data>
+void FlatList<Data>::RemoveFromFront() {
+  delete Detach();
+}
+
+template <typename Data>
+Data FlatList<Data>::FrontNRemove() {
+  Node * nod = Detach();
+  Data dat = std::move(nod->element);
+  delete nod;
+  return dat;
+}
+
+template <typename Data>
+void FlatList<Data>::InsertAtBack(const Data & dat) {
+  Append(new Node(dat));
+}
+
+template <typename Data>
+void FlatList<Data>::InsertAtBack(Data && dat) {
+  Append(new Node(std::move(dat)));
+}
+
+template <typename Data>
+void FlatList<Data>::RemoveFromBack() {
+  BackNRemove();
+}
+
+template <typename Data>
+Data FlatList<Data>::BackNRemove() {
+  if (size == 0) throw std::length_error("List is empty");
+  if (head == tail) {
+    return FrontNRemove();
+  }
+  Node * prev = head;
+  while (prev->next != tail) {
+    prev = prev->next;
+  }
+  Data dat = std::move(tail->element);
+  delete tail;
+  tail = prev;
+  tail->next = nullptr;
+  --size;
+  return dat;
+}
+
+/* ************************************************************************** */
+
+// Access
+
+template <typename Data>
+Data & FlatList<Data>::operator[](ulong index) {
+  return const_cast<Data &>(static_cast<const FlatList<Data> &>(*this)[index]);
+}
+
+template <typename Data>
+const Data & FlatList<Data>::operator[](ulong index) const {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  Node * cur = head;
+  while (index-- > 0) {
+    cur = cur->next;
+  }
+  return cur->element;
+}
+
+template <typename Data>
+inline Data & FlatList<Data>::Front() {
+  if (size == 0) throw std::length_error("List is empty");
+  return head->element;
+}
+
+template <typename Data>
+inline const Data & FlatList<Data>::Front() const {
+  if (size == 0) throw std::length_error("List is empty");
+  return head->element;
+}
+
+template <typename Data>
+inline Data & FlatList<Data>::Back() {
+  if (size == 0) throw std::length_error("List is empty");
+  return tail->element;
+}
+
+template <typename Data>
+inline const Data & FlatList<Data>::Back() const {
+  if (size == 0) throw std::length_error("List is empty");
+  return tail->element;
+}
+
+/* ************************************************************************** */
+
+// Traversals and maps
+
+template <typename Data>
+template <typename Fun>
+void FlatList<Data>::Traverse(Fun fun) const {
+  PreOrderTraverse(fun);
+}
+
+template <typename Data>
+template <typename Fun>
+void FlatList<Data>::PreOrderTraverse(Fun fun) const {
+  for (const Node * cur = head; cur != nullptr; cur = cur->next) {
+    fun(cur->element);
+  }
+}
+
+template <typename Data>
+template <typename Fun>
+void FlatList<Data>::PostOrderTraverse(Fun fun) const {
+  Backwards(
+    [&fun](Node * nod) {
+      fun(static_cast<const Data &>(nod->element));
+    }
+  );
+}
+
+template <typename Data>
+template <typename Fun>
+void FlatList<Data>::Map(Fun fun) {
+  PreOrderMap(fun);
+}
+
+template <typename Data>
+template <typename Fun>
+void FlatList<Data>::PreOrderMap(Fun fun) {
+  for (Node * cur = head; cur != nullptr; cur = cur->next) {
+    fun(cur->element);
+  }
+}
+
+template <typename Data>
+template <typename Fun>
+void FlatList<Data>::PostOrderMap(Fun fun) {
+  Backwards(
+    [&fun](Node * nod) {
+      fun(nod->element);
+    }
+  );
+}
+
+/* ************************************************************************** */
+
+template <typename Data>
+void FlatList<Data>::Clear() noexcept {
+  while (head != nullptr) {
+    Node * nod = head;
+    head = head->next;
+    delete nod;
+  }
+  tail = nullptr;
+  size = 0;
+}
+
+template <typename Data>
+MemStats FlatList<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this) + size * (sizeof(Node) - sizeof(Data));
+  mem.allocations = size;
+  return mem;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+
+template <typename Data>
+void FlatList<Data>::Append(Node * nod) noexcept {
+  if (tail == nullptr) {
+    head = nod;
+  } else {
+    tail->next = nod;
+  }
+  tail = nod;
+  ++size;
+}
+
+template <typename Data>
+typename FlatList<Data>::Node * FlatList<Data>::Detach() {
+  if (size == 0) throw std::length_error("List is empty");
+  Node * nod = head;
+  head = head->next;
+  if (head == nullptr) {
+    tail = nullptr;
+  }
+  --size;
+  return nod;
+}
+
+template <typename Data>
+template <typename Fun>
+void FlatList<Data>::Backwards(Fun fun) const {
+  // Un array di puntatori ai nodi invece della ricorsione (che con liste
+  // lunghe esaurisce lo stack)
+  std::unique_ptr<Node *[]> nodes(new Node *[size]);
+  ulong index = 0;
+  for (Node * cur = head; cur != nullptr; cur = cur->next) {
+    nodes[index++] = cur;
+  }
+  while (index > 0) {
+    fun(nodes[--index]);
+  }
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,191 @@
+#ifndef FLATLIST_HPP
+#define FLATLIST_HPP
+
+/* ************************************************************************** */
+/*
+  flatlist.hpp - Definizione della classe FlatList
+
+  Le operazioni di List in una classe final (vedi flat/flat.hpp). Anche i
+  nodi sono senza vtable (niente distruttore virtuale ricorsivo: la catena
+  si libera con un ciclo) e la visita in post-ordine non è ricorsiva.
+*/
+
+/* ************************************************************************** */
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../flat.hpp"
+#include "../../container/traversable.hpp"
+#include "../../container/mappable.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+class FlatList final : public FlatContainer<FlatList<Data>, Data> {
+protected:
+
+  struct Node {
+    Data element;
+    Node * next = nullptr;
+
+    Node(const Data & dat) : element(dat) {}
+    Node(Data && dat) noexcept : element(std::move(dat)) {}
+  };
+
+  Node * head = nullptr;
+  Node * tail = nullptr;
+  ulong size = 0;
+
+public:
+
+  // Iteratore STL in avanti sui nodi (Value è Data o const Data)
+  template <typename Value>
+  class Iterator {
+
+    friend class FlatList;
+    template <typename> friend class Iterator;
+
+    Node * cur = nullptr;
+
+    explicit Iterator(Node * nod) noexcept : cur(nod) {}
+
+  public:
+
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    Iterator() = default;
+
+    template <typename Other> requires std::is_same_v<Value, const Other>
+    Iterator(const Iterator<Other> & it) noexcept : cur(it.cur) {}
+
+    reference operator*() const noexcept { return cur->element; }
+    pointer operator->() const noexcept { return &cur->element; }
+
+    Iterator & operator++() noexcept { cur = cur->next; return *this; }
+    Iterator operator++(int) noexcept { Iterator tmp(*this); cur = cur->next; return tmp; }
+
+    friend bool operator==(const Iterator & a, const Iterator & b) noexcept { return a.cur == b.cur; }
+
+  };
+
+  using iterator = Iterator<Data>;
+  using const_iterator = Iterator<const Data>;
+
+  inline iterator begin() noexcept { return iterator(head); }
+  inline iterator end() noexcept { return iterator(); }
+  inline const_iterator begin() const noexcept { return const_iterator(head); }
+  inline const_iterator end() const noexcept { return const_iterator(); }
+  inline const_iterator cbegin() const noexcept { return const_iterator(head); }
+  inline const_iterator cend() const noexcept { return const_iterator(); }
+
+  /* ************************************************************************ */
+
+  // Default constructor
+  FlatList() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  FlatList(const TraversableContainer<Data> &); // Dalle interfacce polimorfe
+  FlatList(MappableContainer<Data> &&);
+  template <typename Other>
+  explicit FlatList(const FlatContainer<Other, Data> &); // Da un altro contenitore flat
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  FlatList(const FlatList &);
+
+  // Move constructor
+  FlatList(FlatList &&) noexcept;
+
+  // Destructor
+  ~FlatList();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FlatList & operator=(const FlatList &);
+
+  // Move assignment
+  FlatList & operator=(FlatList &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const FlatList &) const noexcept;
+  inline bool operator!=(const FlatList &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline ulong Size() const noexcept { return size; }
+
+  void InsertAtFront(const Data &); // Copy of the value
+  void InsertAtFront(Data &&); // Move of the value
+  void RemoveFromFront(); // std::length_error se vuota
+  Data FrontNRemove(); // std::length_error se vuota
+
+  void InsertAtBack(const Data &); // Copy of the value
+  void InsertAtBack(Data &&); // Move of the value
+  void RemoveFromBack(); // std::length_error se vuota
+  Data BackNRemove(); // std::length_error se vuota
+
+  Data & operator[](ulong); // std::out_of_range se fuori indice
+  const Data & operator[](ulong) const;
+
+  inline Data & Front(); // std::length_error se vuota
+  inline const Data & Front() const;
+  inline Data & Back(); // std::length_error se vuota
+  inline const Data & Back() const;
+
+  template <typename Fun>
+  void Traverse(Fun) const; // fun(const Data &)
+  template <typename Fun>
+  void PreOrderTraverse(Fun) const;
+  template <typename Fun>
+  void PostOrderTraverse(Fun) const;
+
+  template <typename Fun>
+  void Map(Fun); // fun(Data &)
+  template <typename Fun>
+  void PreOrderMap(Fun);
+  template <typename Fun>
+  void PostOrderMap(Fun);
+
+  void Clear() noexcept;
+
+  MemStats MemoryUsage() const noexcept;
+
+protected:
+
+  // Auxiliary functions
+
+  void Append(Node *) noexcept;
+  Node * Detach(); // Toglie il primo nodo (std::length_error se vuota)
+
+  // I nodi dall'ultimo al primo, per le visite in post-ordine
+  template <typename Fun>
+  void Backwards(Fun) const;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "flatlist.cpp"
+
+#endif
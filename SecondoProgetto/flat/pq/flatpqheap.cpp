@@ -0,0 +1,164 @@
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Specific constructors
+
+template <typename Data>
+FlatPQHeap<Data>::FlatPQHeap(const TraversableContainer<Data> & con) : vec(con), size(vec.Size()) {
+  Heap::MakeHeap(vec.data(), size);
+}
+
+template <typename Data>
+FlatPQHeap<Data>::FlatPQHeap(MappableContainer<Data> && con) : vec(std::move(con)), size(vec.Size()) {
+  Heap::MakeHeap(vec.data(), size);
+}
+
+template <typename Data>
+template <typename Other>
+FlatPQHeap<Data>::FlatPQHeap(const FlatContainer<Other, Data> & con) : vec(con), size(vec.Size()) {
+  Heap::MakeHeap(vec.data(), size);
+}
+
+/* ************************************************************************** */
+
+// Copy constructor (solo gli elementi presenti)
+template <typename Data>
+FlatPQHeap<Data>::FlatPQHeap(const FlatPQHeap<Data> & pq) : vec(pq.size), size(pq.size) {
+  std::copy(pq.begin(), pq.end(), vec.begin());
+}
+
+// Move constructor
+template <typename Data>
+FlatPQHeap<Data>::FlatPQHeap(FlatPQHeap<Data> && pq) noexcept : vec(std::move(pq.vec)) {
+  std::swap(size, pq.size);
+}
+
+/* ************************************************************************** */
+
+// Copy assignment
+template <typename Data>
+FlatPQHeap<Data> & FlatPQHeap<Data>::operator=(const FlatPQHeap<Data> & pq) {
+  FlatPQHeap<Data> tmp(pq);
+  std::swap(vec, tmp.vec);
+  std::swap(size, tmp.size);
+  return *this;
+}
+
+// Move assignment
+template <typename Data>
+FlatPQHeap<Data> & FlatPQHeap<Data>::operator=(FlatPQHeap<Data> && pq) noexcept {
+  std::swap(vec, pq.vec);
+  std::swap(size, pq.size);
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// Tip
+
+template <typename Data>
+const Data & FlatPQHeap<Data>::Tip() const {
+  if (size == 0) throw std::length_error("Priority Queue is empty");
+  return vec.UncheckedAt(0);
+}
+
+template <typename Data>
+void FlatPQHeap<Data>::RemoveTip() {
+  if (size == 0) throw std::length_error("Priority Queue is empty");
+  --size;
+  std::swap(vec.UncheckedAt(0), vec.UncheckedAt(size));
+  Heap::HeapifyDown(vec.data(), size, 0);
+}
+
+template <typename Data>
+Data FlatPQHeap<Data>::TipNRemove() {
+  if (size == 0) throw std::length_error("Priority Queue is empty");
+  Data dat = std::move(vec.UncheckedAt(0));
+  if (--size != 0) {
+    vec.UncheckedAt(0) = std::move(vec.UncheckedAt(size));
+    Heap::HeapifyDown(vec.data(), size, 0);
+  }
+  return dat;
+}
+
+/* ************************************************************************** */
+
+// Insert
+
+template <typename Data>
+void FlatPQHeap<Data>::Insert(const Data & dat) {
+  Reserve();
+  vec.UncheckedAt(size) = dat;
+  Heap::HeapifyUp(vec.data(), size++);
+}
+
+template <typename Data>
+void FlatPQHeap<Data>::Insert(Data && dat) {
+  Reserve();
+  vec.UncheckedAt(size) = std::move(dat);
+  Heap::HeapifyUp(vec.data(), size++);
+}
+
+/* ************************************************************************** */
+
+// Change
+
+template <typename Data>
+void FlatPQHeap<Data>::Change(ulong index, const Data & dat) {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  bool down = (dat < vec.UncheckedAt(index));
+  vec.UncheckedAt(index) = dat;
+  Reheap(index, down);
+}
+
+template <typename Data>
+void FlatPQHeap<Data>::Change(ulong index, Data && dat) {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  bool down = (dat < vec.UncheckedAt(index));
+  vec.UncheckedAt(index) = std::move(dat);
+  Reheap(index, down);
+}
+
+/* ************************************************************************** */
+
+template <typename Data>
+void FlatPQHeap<Data>::Clear() noexcept {
+  vec.Clear();
+  size = 0;
+}
+
+template <typename Data>
+MemStats FlatPQHeap<Data>::MemoryUsage() const noexcept {
+  MemStats mem = vec.MemoryUsage();
+  mem.payload = size * sizeof(Data);
+  mem.slack = (vec.Size() - size) * sizeof(Data);
+  mem.overhead += sizeof(*this) - sizeof(vec); // Il resto dell'oggetto
+  return mem;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+
+template <typename Data>
+void FlatPQHeap<Data>::Reserve() {
+  if (size == vec.Size()) {
+    vec.Resize((size < 8) ? 8 : 2 * size);
+  }
+}
+
+template <typename Data>
+void FlatPQHeap<Data>::Reheap(ulong index, bool down) noexcept {
+  if (down) {
+    Heap::HeapifyDown(vec.data(), size, index);
+  } else {
+    Heap::HeapifyUp(vec.data(), index);
+  }
+}
+
+/* ************************************************************************** */
+
+}
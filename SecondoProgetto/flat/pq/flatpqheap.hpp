@@ -0,0 +1,99 @@
+#ifndef FLATPQHEAP_HPP
+#define FLATPQHEAP_HPP
+
+/* ************************************************************************** */
+/*
+  flatpqheap.hpp - Definizione della classe FlatPQHeap
+
+  Le operazioni di PQHeap (coda con priorità su un max-heap) in una classe
+  final (vedi flat/flat.hpp). Il buffer ha una capacità che raddoppia,
+  quindi Insert non rialloca a ogni elemento.
+*/
+
+/* ************************************************************************** */
+
+#include "../flat.hpp"
+#include "../heap/flatheapvec.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+class FlatPQHeap final : public FlatLinear<FlatPQHeap<Data>, Data> {
+protected:
+
+  using Heap = FlatHeapVec<Data>;
+
+  FlatVector<Data> vec; // vec.Size() è la capacità
+  ulong size = 0;
+
+public:
+
+  // Default constructor
+  FlatPQHeap() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  FlatPQHeap(const TraversableContainer<Data> &); // Dalle interfacce polimorfe
+  FlatPQHeap(MappableContainer<Data> &&);
+  template <typename Other>
+  explicit FlatPQHeap(const FlatContainer<Other, Data> &); // Da un altro contenitore flat
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  FlatPQHeap(const FlatPQHeap &);
+
+  // Move constructor
+  FlatPQHeap(FlatPQHeap &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FlatPQHeap & operator=(const FlatPQHeap &);
+
+  // Move assignment
+  FlatPQHeap & operator=(FlatPQHeap &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline ulong Size() const noexcept { return size; }
+
+  inline const Data * data() const noexcept { return vec.data(); }
+
+  const Data & Tip() const; // std::length_error se vuota
+  void RemoveTip(); // std::length_error se vuota
+  Data TipNRemove(); // std::length_error se vuota
+
+  void Insert(const Data &); // Copy of the value
+  void Insert(Data &&); // Move of the value
+
+  void Change(ulong, const Data &); // std::out_of_range se fuori indice
+  void Change(ulong, Data &&); // std::out_of_range se fuori indice
+
+  void Clear() noexcept;
+
+  MemStats MemoryUsage() const noexcept; // Le posizioni libere del buffer sono slack
+
+protected:
+
+  // Auxiliary functions
+
+  void Reserve(); // Spazio per un elemento in più
+  void Reheap(ulong, bool) noexcept; // Dopo che l'elemento è diminuito (true) o aumentato
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "flatpqheap.cpp"
+
+#endif
@@ -0,0 +1,361 @@
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Specific constructors
+
+template <typename Data>
+FlatSetVec<Data>::FlatSetVec(const TraversableContainer<Data> & con) {
+  Adopt(FlatVector<Data>(con));
+}
+
+template <typename Data>
+FlatSetVec<Data>::FlatSetVec(MappableContainer<Data> && con) {
+  Adopt(FlatVector<Data>(std::move(con)));
+}
+
+template <typename Data>
+template <typename Other>
+FlatSetVec<Data>::FlatSetVec(const FlatContainer<Other, Data> & con) {
+  Adopt(FlatVector<Data>(con));
+}
+
+/* ************************************************************************** */
+
+// Copy constructor
+template <typename Data>
+FlatSetVec<Data>::FlatSetVec(const FlatSetVec<Data> & set) {
+  if (set.size != 0) {
+    buf = new Data[set.size];
+    std::copy(set.data(), set.data() + set.size, buf);
+    cap = set.size;
+    size = set.size;
+  }
+}
+
+// Move constructor
+template <typename Data>
+FlatSetVec<Data>::FlatSetVec(FlatSetVec<Data> && set) noexcept {
+  Swap(set);
+}
+
+// Destructor
+template <typename Data>
+FlatSetVec<Data>::~FlatSetVec() {
+  delete[] buf;
+}
+
+/* ************************************************************************** */
+
+// Copy assignment
+template <typename Data>
+FlatSetVec<Data> & FlatSetVec<Data>::operator=(const FlatSetVec<Data> & set) {
+  FlatSetVec<Data> tmp(set);
+  Swap(tmp);
+  return *this;
+}
+
+// Move assignment
+template <typename Data>
+FlatSetVec<Data> & FlatSetVec<Data>::operator=(FlatSetVec<Data> && set) noexcept {
+  Swap(set);
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// Min / Max
+
+template <typename Data>
+const Data & FlatSetVec<Data>::Min() const {
+  if (size == 0) throw std::length_error("Empty container");
+  return buf[head];
+}
+
+template <typename Data>
+Data FlatSetVec<Data>::MinNRemove() {
+  if (size == 0) throw std::length_error("Empty container");
+  Data dat = std::move(buf[head]);
+  RemoveAt(0);
+  return dat;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::RemoveMin() {
+  if (size == 0) throw std::length_error("Empty container");
+  RemoveAt(0);
+}
+
+template <typename Data>
+const Data & FlatSetVec<Data>::Max() const {
+  if (size == 0) throw std::length_error("Empty container");
+  return buf[head + size - 1];
+}
+
+template <typename Data>
+Data FlatSetVec<Data>::MaxNRemove() {
+  if (size == 0) throw std::length_error("Empty container");
+  Data dat = std::move(buf[head + size - 1]);
+  RemoveAt(size - 1);
+  return dat;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::RemoveMax() {
+  if (size == 0) throw std::length_error("Empty container");
+  RemoveAt(size - 1);
+}
+
+/* ************************************************************************** */
+
+// Predecessor / Successor
+
+template <typename Data>
+const Data & FlatSetVec<Data>::Predecessor(const Data & val) const {
+  ulong pos = LowerBound(val);
+  if (pos == 0) throw std::length_error("No predecessor");
+  return buf[head + pos - 1];
+}
+
+template <typename Data>
+Data FlatSetVec<Data>::PredecessorNRemove(const Data & val) {
+  ulong pos = LowerBound(val);
+  if (pos == 0) throw std::length_error("No predecessor");
+  Data dat = std::move(buf[head + pos - 1]);
+  RemoveAt(pos - 1);
+  return dat;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::RemovePredecessor(const Data & val) {
+  ulong pos = LowerBound(val);
+  if (pos == 0) throw std::length_error("No predecessor");
+  RemoveAt(pos - 1);
+}
+
+template <typename Data>
+const Data & FlatSetVec<Data>::Successor(const Data & val) const {
+  ulong pos = LowerBound(val);
+  pos += (pos < size && buf[head + pos] == val);
+  if (pos >= size) throw std::length_error("No successor");
+  return buf[head + pos];
+}
+
+template <typename Data>
+Data FlatSetVec<Data>::SuccessorNRemove(const Data & val) {
+  ulong pos = LowerBound(val);
+  pos += (pos < size && buf[head + pos] == val);
+  if (pos >= size) throw std::length_error("No successor");
+  Data dat = std::move(buf[head + pos]);
+  RemoveAt(pos);
+  return dat;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::RemoveSuccessor(const Data & val) {
+  ulong pos = LowerBound(val);
+  pos += (pos < size && buf[head + pos] == val);
+  if (pos >= size) throw std::length_error("No successor");
+  RemoveAt(pos);
+}
+
+/* ************************************************************************** */
+
+// Insert / Remove
+
+template <typename Data>
+bool FlatSetVec<Data>::Insert(const Data & val) {
+  return Emplace(val);
+}
+
+template <typename Data>
+bool FlatSetVec<Data>::Insert(Data && val) {
+  return Emplace(std::move(val));
+}
+
+template <typename Data>
+bool FlatSetVec<Data>::Remove(const Data & val) {
+  ulong pos = LowerBound(val);
+  if (pos == size || buf[head + pos] != val) {
+    return false;
+  }
+  RemoveAt(pos);
+  return true;
+}
+
+template <typename Data>
+template <typename Con>
+bool FlatSetVec<Data>::InsertAll(const Con & con) {
+  bool all = true;
+  con.Traverse(
+    [this, &all](const Data & dat) {
+      all &= Insert(dat);
+    }
+  );
+  return all;
+}
+
+template <typename Data>
+template <typename Con>
+bool FlatSetVec<Data>::RemoveAll(const Con & con) {
+  bool all = true;
+  con.Traverse(
+    [this, &all](const Data & dat) {
+      all &= Remove(dat);
+    }
+  );
+  return all;
+}
+
+template <typename Data>
+template <typename Con>
+bool FlatSetVec<Data>::InsertSome(const Con & con) {
+  bool some = false;
+  con.Traverse(
+    [this, &some](const Data & dat) {
+      some |= Insert(dat);
+    }
+  );
+  return some;
+}
+
+template <typename Data>
+template <typename Con>
+bool FlatSetVec<Data>::RemoveSome(const Con & con) {
+  bool some = false;
+  con.Traverse(
+    [this, &some](const Data & dat) {
+      some |= Remove(dat);
+    }
+  );
+  return some;
+}
+
+template <typename Data>
+bool FlatSetVec<Data>::Exists(const Data & val) const noexcept {
+  ulong pos = LowerBound(val);
+  return (pos < size && buf[head + pos] == val);
+}
+
+/* ************************************************************************** */
+
+template <typename Data>
+void FlatSetVec<Data>::Clear() noexcept {
+  delete[] buf;
+  buf = nullptr;
+  cap = head = size = 0;
+}
+
+template <typename Data>
+MemStats FlatSetVec<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this);
+  mem.slack = (cap - size) * sizeof(Data);
+  mem.allocations = (buf != nullptr) ? 1 : 0;
+  return mem;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+
+template <typename Data>
+ulong FlatSetVec<Data>::LowerBound(const Data & val) const noexcept {
+  const Data * elm = buf + head;
+  ulong lo = 0;
+  ulong hi = size;
+  while (lo < hi) {
+    ulong mid = lo + (hi - lo) / 2;
+    if (elm[mid] < val) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+template <typename Data>
+template <typename Value>
+bool FlatSetVec<Data>::Emplace(Value && val) {
+  ulong pos = LowerBound(val);
+  if (pos < size && buf[head + pos] == val) {
+    return false;
+  }
+  if (head > 0 && (2 * pos < size || head + size == cap)) {
+    // Spazio libero davanti: la parte prima di pos scala indietro di uno
+    Data * elm = buf + head;
+    std::move(elm, elm + pos, elm - 1);
+    --head;
+  } else {
+    if (head + size == cap) {
+      Grow();
+    }
+    Data * elm = buf + head;
+    std::move_backward(elm + pos, elm + size, elm + size + 1);
+  }
+  buf[head + pos] = std::forward<Value>(val);
+  ++size;
+  return true;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::RemoveAt(ulong pos) noexcept {
+  Data * elm = buf + head;
+  if (2 * pos < size) {
+    std::move_backward(elm, elm + pos, elm + pos + 1);
+    ++head;
+  } else {
+    std::move(elm + pos + 1, elm + size, elm + pos);
+  }
+  if (--size == 0) {
+    head = 0;
+  }
+}
+
+template <typename Data>
+void FlatSetVec<Data>::Grow() {
+  ulong newcap = (cap < 8) ? 8 : 2 * cap;
+  Data * tmp = new Data[newcap];
+  std::move(buf + head, buf + head + size, tmp);
+  delete[] buf;
+  buf = tmp;
+  cap = newcap;
+  head = 0;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::Adopt(FlatVector<Data> && vec) {
+  vec.Sort();
+  ulong num = 0;
+  for (ulong index = 0; index < vec.Size(); ++index) {
+    if (num == 0 || vec.UncheckedAt(num - 1) != vec.UncheckedAt(index)) {
+      if (num != index) {
+        vec.UncheckedAt(num) = std::move(vec.UncheckedAt(index));
+      }
+      ++num;
+    }
+  }
+  FlatSetVec<Data> tmp;
+  if (num != 0) {
+    tmp.buf = new Data[num];
+    std::move(vec.begin(), vec.begin() + num, tmp.buf);
+    tmp.cap = tmp.size = num;
+  }
+  Swap(tmp);
+}
+
+template <typename Data>
+void FlatSetVec<Data>::Swap(FlatSetVec<Data> & set) noexcept {
+  std::swap(buf, set.buf);
+  std::swap(cap, set.cap);
+  std::swap(head, set.head);
+  std::swap(size, set.size);
+}
+
+/* ************************************************************************** */
+
+}
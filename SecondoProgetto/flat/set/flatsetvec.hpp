@@ -0,0 +1,141 @@
+#ifndef FLATSETVEC_HPP
+#define FLATSETVEC_HPP
+
+/* ************************************************************************** */
+/*
+  flatsetvec.hpp - Definizione della classe FlatSetVec
+
+  Le operazioni di SetVec in una classe final (vedi flat/flat.hpp).
+
+  Gli elementi occupano una finestra contigua buf[head, head + size) di un
+  array più grande, invece di un buffer circolare: RemoveMin sposta solo
+  head, un inserimento o una rimozione spostano la parte più corta fra
+  quella prima e quella dopo la posizione (verso lo spazio libero davanti,
+  se c'è), e gli elementi restano un unico tratto contiguo, quindi accesso
+  per indice, visite e ricerca binaria lavorano su un semplice puntatore.
+*/
+
+/* ************************************************************************** */
+
+#include "../flat.hpp"
+#include "../vector/flatvector.hpp"
+#include "../../container/traversable.hpp"
+#include "../../container/mappable.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+class FlatSetVec final : public FlatLinear<FlatSetVec<Data>, Data> {
+protected:
+
+  Data * buf = nullptr;
+  ulong cap = 0;  // Capacità di buf
+  ulong head = 0; // Posizione del minimo
+  ulong size = 0;
+
+public:
+
+  // Default constructor
+  FlatSetVec() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  FlatSetVec(const TraversableContainer<Data> &); // Dalle interfacce polimorfe
+  FlatSetVec(MappableContainer<Data> &&);
+  template <typename Other>
+  explicit FlatSetVec(const FlatContainer<Other, Data> &); // Da un altro contenitore flat
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  FlatSetVec(const FlatSetVec &);
+
+  // Move constructor
+  FlatSetVec(FlatSetVec &&) noexcept;
+
+  // Destructor
+  ~FlatSetVec();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FlatSetVec & operator=(const FlatSetVec &);
+
+  // Move assignment
+  FlatSetVec & operator=(FlatSetVec &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline ulong Size() const noexcept { return size; }
+
+  inline const Data * data() const noexcept { return buf + head; }
+
+  const Data & Min() const; // std::length_error se vuoto
+  Data MinNRemove(); // std::length_error se vuoto
+  void RemoveMin(); // std::length_error se vuoto
+
+  const Data & Max() const; // std::length_error se vuoto
+  Data MaxNRemove(); // std::length_error se vuoto
+  void RemoveMax(); // std::length_error se vuoto
+
+  const Data & Predecessor(const Data &) const; // std::length_error se non esiste
+  Data PredecessorNRemove(const Data &); // std::length_error se non esiste
+  void RemovePredecessor(const Data &); // std::length_error se non esiste
+
+  const Data & Successor(const Data &) const; // std::length_error se non esiste
+  Data SuccessorNRemove(const Data &); // std::length_error se non esiste
+  void RemoveSuccessor(const Data &); // std::length_error se non esiste
+
+  bool Insert(const Data &); // Copy of the value
+  bool Insert(Data &&); // Move of the value
+  bool Remove(const Data &);
+
+  // Con un qualunque contenitore che abbia Traverse (flat o polimorfo):
+  // All è vero se tutti gli elementi sono stati inseriti / rimossi, Some se
+  // almeno uno
+  template <typename Con>
+  bool InsertAll(const Con &);
+  template <typename Con>
+  bool RemoveAll(const Con &);
+  template <typename Con>
+  bool InsertSome(const Con &);
+  template <typename Con>
+  bool RemoveSome(const Con &);
+
+  bool Exists(const Data &) const noexcept; // Ricerca binaria
+
+  void Clear() noexcept;
+
+  MemStats MemoryUsage() const noexcept; // Le posizioni libere di buf sono slack
+
+protected:
+
+  // Auxiliary functions
+
+  ulong LowerBound(const Data &) const noexcept; // Indice della prima chiave >= val (size se non esiste)
+
+  template <typename Value>
+  bool Emplace(Value &&);
+  void RemoveAt(ulong) noexcept;
+  void Grow();
+
+  void Adopt(FlatVector<Data> &&); // Ordina gli elementi raccolti e toglie i duplicati
+
+  void Swap(FlatSetVec &) noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "flatsetvec.cpp"
+
+#endif
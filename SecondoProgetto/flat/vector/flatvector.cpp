@@ -0,0 +1,218 @@
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Specific constructors
+
+template <typename Data>
+FlatVector<Data>::FlatVector(const ulong newsize) {
+  if (newsize != 0) {
+    Elements = new Data[newsize]{};
+    size = newsize;
+  }
+}
+
+template <typename Data>
+FlatVector<Data>::FlatVector(const TraversableContainer<Data> & con) : FlatVector(con.Size()) {
+  ulong index = 0;
+  con.Traverse(
+    [this, &index](const Data & dat) {
+      Elements[index++] = dat;
+    }
+  );
+}
+
+template <typename Data>
+FlatVector<Data>::FlatVector(MappableContainer<Data> && con) : FlatVector(con.Size()) {
+  ulong index = 0;
+  con.Map(
+    [this, &index](Data & dat) {
+      Elements[index++] = std::move(dat);
+    }
+  );
+}
+
+template <typename Data>
+template <typename Other>
+FlatVector<Data>::FlatVector(const FlatContainer<Other, Data> & con) : FlatVector(static_cast<const Other &>(con).Size()) {
+  ulong index = 0;
+  static_cast<const Other &>(con).Traverse(
+    [this, &index](const Data & dat) {
+      Elements[index++] = dat;
+    }
+  );
+}
+
+/* ************************************************************************** */
+
+// Copy constructor
+template <typename Data>
+FlatVector<Data>::FlatVector(const FlatVector<Data> & vec) {
+  if (vec.size != 0) {
+    Elements = new Data[vec.size];
+    std::copy(vec.Elements, vec.Elements + vec.size, Elements);
+    size = vec.size;
+  }
+}
+
+// Move constructor
+template <typename Data>
+FlatVector<Data>::FlatVector(FlatVector<Data> && vec) noexcept {
+  std::swap(Elements, vec.Elements);
+  std::swap(size, vec.size);
+}
+
+// Destructor
+template <typename Data>
+FlatVector<Data>::~FlatVector() {
+  delete[] Elements;
+}
+
+/* ************************************************************************** */
+
+// Copy assignment
+template <typename Data>
+FlatVector<Data> & FlatVector<Data>::operator=(const FlatVector<Data> & vec) {
+  FlatVector<Data> tmp(vec);
+  std::swap(Elements, tmp.Elements);
+  std::swap(size, tmp.size);
+  return *this;
+}
+
+// Move assignment
+template <typename Data>
+FlatVector<Data> & FlatVector<Data>::operator=(FlatVector<Data> && vec) noexcept {
+  std::swap(Elements, vec.Elements);
+  std::swap(size, vec.size);
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// Specific member functions
+
+template <typename Data>
+inline Data & FlatVector<Data>::operator[](ulong index) {
+  if (index >= size) [[unlikely]] {
+    this->OutOfRange(index, size);
+  }
+  return Elements[index];
+}
+
+template <typename Data>
+inline Data & FlatVector<Data>::Front() {
+  if (size == 0) [[unlikely]] {
+    this->EmptyAccess();
+  }
+  return Elements[0];
+}
+
+template <typename Data>
+inline Data & FlatVector<Data>::Back() {
+  if (size == 0) [[unlikely]] {
+    this->EmptyAccess();
+  }
+  return Elements[size - 1];
+}
+
+template <typename Data>
+template <typename Fun>
+void FlatVector<Data>::Map(Fun fun) {
+  PreOrderMap(fun);
+}
+
+template <typename Data>
+template <typename Fun>
+void FlatVector<Data>::PreOrderMap(Fun fun) {
+  for (Data * cur = Elements; cur != Elements + size; ++cur) {
+    fun(*cur);
+  }
+}
+
+template <typename Data>
+template <typename Fun>
+void FlatVector<Data>::PostOrderMap(Fun fun) {
+  for (Data * cur = Elements + size; cur != Elements; ) {
+    fun(*--cur);
+  }
+}
+
+/* ************************************************************************** */
+
+// Sorting
+
+template <typename Data>
+void FlatVector<Data>::Sort() noexcept {
+  if (size > 1) {
+    QuickSort(0, size - 1);
+  }
+}
+
+template <typename Data>
+void FlatVector<Data>::QuickSort(ulong p, ulong r) noexcept {
+  if (p < r) {
+    ulong q = Partition(p, r);
+    QuickSort(p, q);
+    QuickSort(q + 1, r);
+  }
+}
+
+template <typename Data>
+ulong FlatVector<Data>::Partition(ulong p, ulong r) noexcept {
+  Data x = Elements[p];
+  ulong i = p - 1;
+  ulong j = r + 1;
+  do {
+    do { j--; }
+    while (x < Elements[j]);
+    do { i++; }
+    while (x > Elements[i]);
+    if (i < j) { std::swap(Elements[i], Elements[j]); }
+  }
+  while (i < j);
+  return j;
+}
+
+/* ************************************************************************** */
+
+// Resize / Clear (come Vector: nuova capacità esatta)
+
+template <typename Data>
+void FlatVector<Data>::Resize(ulong newsize) {
+  if (newsize == 0) {
+    Clear();
+  } else if (size != newsize) {
+    Data * tmp = new Data[newsize]{};
+    ulong minsize = (size < newsize) ? size : newsize;
+    for (ulong index = 0; index < minsize; ++index) {
+      std::swap(Elements[index], tmp[index]);
+    }
+    std::swap(Elements, tmp);
+    size = newsize;
+    delete[] tmp;
+  }
+}
+
+template <typename Data>
+void FlatVector<Data>::Clear() noexcept {
+  delete[] Elements;
+  Elements = nullptr;
+  size = 0;
+}
+
+/* ************************************************************************** */
+
+template <typename Data>
+MemStats FlatVector<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this);
+  mem.allocations = (Elements != nullptr) ? 1 : 0;
+  return mem;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,123 @@
+#ifndef FLATVECTOR_HPP
+#define FLATVECTOR_HPP
+
+/* ************************************************************************** */
+/*
+  flatvector.hpp - Definizione della classe FlatVector
+
+  Le operazioni di Vector e SortableVector in una classe final, senza
+  vtable né basi virtuali (vedi flat/flat.hpp).
+*/
+
+/* ************************************************************************** */
+
+#include "../flat.hpp"
+#include "../../container/traversable.hpp"
+#include "../../container/mappable.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+class FlatVector final : public FlatLinear<FlatVector<Data>, Data> {
+protected:
+
+  Data * Elements = nullptr;
+  ulong size = 0;
+
+public:
+
+  // Default constructor
+  FlatVector() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  FlatVector(const ulong);
+  FlatVector(const TraversableContainer<Data> &); // Dalle interfacce polimorfe
+  FlatVector(MappableContainer<Data> &&);
+  template <typename Other>
+  explicit FlatVector(const FlatContainer<Other, Data> &); // Da un altro contenitore flat
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  FlatVector(const FlatVector &);
+
+  // Move constructor
+  FlatVector(FlatVector &&) noexcept;
+
+  // Destructor
+  ~FlatVector();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FlatVector & operator=(const FlatVector &);
+
+  // Move assignment
+  FlatVector & operator=(FlatVector &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline ulong Size() const noexcept { return size; }
+
+  inline Data * data() noexcept { return Elements; }
+  inline const Data * data() const noexcept { return Elements; }
+
+  using FlatLinear<FlatVector<Data>, Data>::operator[];
+  using FlatLinear<FlatVector<Data>, Data>::Front;
+  using FlatLinear<FlatVector<Data>, Data>::Back;
+  using FlatLinear<FlatVector<Data>, Data>::UncheckedAt;
+  using FlatLinear<FlatVector<Data>, Data>::Span;
+  using FlatLinear<FlatVector<Data>, Data>::begin;
+  using FlatLinear<FlatVector<Data>, Data>::end;
+
+  inline Data & operator[](ulong); // std::out_of_range se fuori indice
+  inline Data & Front(); // std::length_error se vuoto
+  inline Data & Back(); // std::length_error se vuoto
+
+  inline Data & UncheckedAt(ulong index) noexcept { return Elements[index]; }
+
+  inline std::span<Data> Span() noexcept { return std::span<Data>(Elements, size); }
+
+  using iterator = Data *;
+
+  inline iterator begin() noexcept { return Elements; }
+  inline iterator end() noexcept { return Elements + size; }
+
+  template <typename Fun>
+  void Map(Fun); // fun(Data &)
+  template <typename Fun>
+  void PreOrderMap(Fun);
+  template <typename Fun>
+  void PostOrderMap(Fun);
+
+  void Sort() noexcept; // Lo stesso QuickSort di SortableLinearContainer
+
+  void Resize(ulong);
+  void Clear() noexcept;
+
+  MemStats MemoryUsage() const noexcept;
+
+protected:
+
+  // Auxiliary functions
+
+  void QuickSort(ulong, ulong) noexcept;
+  ulong Partition(ulong, ulong) noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "flatvector.cpp"
+
+#endif
@@ -87,14 +87,21 @@ void HeapVec<Data>::HeapifyDown(ulong i) {
   ulong left = 2 * i + 1;
   ulong right = 2 * i + 2;
 
-  if (left < this->Size() && Elements[left] > Elements[largest])
-    largest = left;
+  if (left < this->Size()) {
+    this->CountOp(StatOp::Comparison);
+    if (Elements[left] > Elements[largest])
+      largest = left;
+  }
 
-  if (right < this->Size() && Elements[right] > Elements[largest])
-    largest = right;
+  if (right < this->Size()) {
+    this->CountOp(StatOp::Comparison);
+    if (Elements[right] > Elements[largest])
+      largest = right;
+  }
 
   if (largest != i) {
     std::swap(Elements[i], Elements[largest]);
+    this->CountOp(StatOp::Move, 3);
     HeapifyDown(largest);
   }
 }
@@ -103,8 +110,10 @@ template <typename Data>
 void HeapVec<Data>::HeapifyUp(ulong i) {
   while (i > 0) {
     ulong parent = (i - 1) / 2;
+    this->CountOp(StatOp::Comparison);
     if (Elements[i] > Elements[parent]) {
       std::swap(Elements[i], Elements[parent]);
+      this->CountOp(StatOp::Move, 3);
       i = parent;
     } else {
       break;
@@ -114,6 +123,34 @@ void HeapVec<Data>::HeapifyUp(ulong i) {
 
 /* ************************************************************************** */
 
+// Binary serialization
+
+template <typename Data>
+void HeapVec<Data>::Save(const std::string& path) const {
+  SaveBinary<Data>(path, 'H', Elements, size);
+}
+
+template <typename Data>
+void HeapVec<Data>::Load(const std::string& path) {
+  Vector<Data>::Load(path);
+  if (!IsHeap()) {
+    Heapify();
+  }
+}
+
+/* ************************************************************************** */
+
+// Streaming construction
+
+template <typename Data>
+template <typename Source>
+void HeapVec<Data>::Build(Source&& src, ulong hint) {
+  Vector<Data>::Build(src, hint);
+  Heapify();
+}
+
+/* ************************************************************************** */
+
 // Sorting using HeapSort
 
 template <typename Data>
@@ -122,6 +159,7 @@ void HeapVec<Data>::Sort() noexcept {
 
   for (ulong i = this->Size() - 1; i > 0; --i) {
     std::swap(Elements[0], Elements[i]);
+    this->CountOp(StatOp::Move, 3);
     ulong tempSize = i;
     ulong root = 0;
 
@@ -130,6 +168,7 @@ void HeapVec<Data>::Sort() noexcept {
       ulong left = 2 * root + 1;
       ulong right = 2 * root + 2;
 
+      this->CountOp(StatOp::Comparison, (left < tempSize) + (right < tempSize));
       if (left < tempSize && Elements[left] > Elements[largest])
         largest = left;
 
@@ -138,6 +177,7 @@ void HeapVec<Data>::Sort() noexcept {
 
       if (largest != root) {
         std::swap(Elements[root], Elements[largest]);
+        this->CountOp(StatOp::Move, 3);
         root = largest;
       } else {
         break;
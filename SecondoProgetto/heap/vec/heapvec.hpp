@@ -33,6 +33,10 @@ using LinearContainer<Data>::Back;  // const Back()
 using MutableLinearContainer<Data>::Front; // non-const Front()
 using MutableLinearContainer<Data>::Back;  // non-const Back()
 
+  // Operation counters (see stats/stats.hpp)
+  using Vector<Data>::Stats;
+  using Vector<Data>::ResetStats;
+
   // Default constructor
   HeapVec() = default;
 
@@ -66,10 +70,36 @@ using MutableLinearContainer<Data>::Back;  // non-const Back()
   // SortableLinearContainer function
 void Sort() noexcept override;
 
+  // Binary serialization (format in serial/serial.hpp): the array is saved
+  // as is; Load rebuilds the heap only if the file does not hold one
+  void Save(const std::string&) const;
+  void Load(const std::string&);
+
+  // Streaming construction (sources in stream/stream.hpp): the records are
+  // read in place and heapified once, bottom-up in O(n)
+  template <typename Source>
+  void Build(Source&&, ulong = 0);
+
+  // Iteratori STL in sola lettura (contigui, in ordine di heap)
+  using iterator = typename Vector<Data>::const_iterator;
+  using const_iterator = typename Vector<Data>::const_iterator;
+
+  inline const_iterator begin() const noexcept { return Vector<Data>::cbegin(); }
+  inline const_iterator end() const noexcept { return Vector<Data>::cend(); }
+  inline const_iterator cbegin() const noexcept { return Vector<Data>::cbegin(); }
+  inline const_iterator cend() const noexcept { return Vector<Data>::cend(); }
+
   // ClearableContainer function
   void Clear() noexcept override { // Override ClearableContainer member
     Vector<Data>::Clear(); // Call the Clear method of the base class
   } // No need to throw exceptions, as Clear is not expected to fail
+
+  // Container function
+  MemStats MemoryUsage() const noexcept override { // Override Container member
+    MemStats mem = Vector<Data>::MemoryUsage();
+    mem.overhead += sizeof(*this) - sizeof(Vector<Data>); // Il resto dell'oggetto
+    return mem;
+  }
 };
 
 
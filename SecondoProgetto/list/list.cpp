@@ -299,6 +299,19 @@ void List<Data>::Clear() {
   size = 0;
 }
 
+/* ************************************************************************** */
+/* MemoryUsage Function */
+
+// Un nodo per elemento: il resto del nodo (next e vtable) è overhead
+template <typename Data>
+MemStats List<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this) + size * (sizeof(Node) - sizeof(Data));
+  mem.allocations = size;
+  return mem;
+}
+
 /* ************************************************************************** */
 
 } // namespace lasd
@@ -3,6 +3,10 @@
 
 /* ************************************************************************** */
 
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
 #include "../container/linear.hpp"
 #include "../container/container.hpp"
 
@@ -59,6 +63,54 @@ protected:
 
 public:
 
+  // STL forward iterator over the nodes (Value is Data or const Data)
+  template <typename Value>
+  class Iterator {
+
+    friend class List;
+    template <typename> friend class Iterator;
+
+    Node* cur = nullptr;
+
+    explicit Iterator(Node* nod) noexcept : cur(nod) {}
+
+  public:
+
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    Iterator() = default;
+
+    // A mutable iterator converts to a const one
+    template <typename Other> requires std::is_same_v<Value, const Other>
+    Iterator(const Iterator<Other>& it) noexcept : cur(it.cur) {}
+
+    reference operator*() const noexcept { return cur->element; }
+    pointer operator->() const noexcept { return &cur->element; }
+
+    Iterator& operator++() noexcept { cur = cur->next; return *this; }
+    Iterator operator++(int) noexcept { Iterator tmp(*this); cur = cur->next; return tmp; }
+
+    friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.cur == b.cur; }
+
+  };
+
+  using iterator = Iterator<Data>;
+  using const_iterator = Iterator<const Data>;
+
+  inline iterator begin() noexcept { return iterator(head); }
+  inline iterator end() noexcept { return iterator(); }
+  inline const_iterator begin() const noexcept { return const_iterator(head); }
+  inline const_iterator end() const noexcept { return const_iterator(); }
+  inline const_iterator cbegin() const noexcept { return const_iterator(head); }
+  inline const_iterator cend() const noexcept { return const_iterator(); }
+
+  /* ************************************************************************ */
+
   // Default constructor
    List() = default;
 
@@ -182,6 +234,12 @@ public:
 
   void Clear() override; // Override ClearableContainer member
 
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override; // Override Container member
+
 protected:
 
   // Auxiliary functions, if necessary!
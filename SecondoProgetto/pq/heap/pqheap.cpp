@@ -61,6 +61,7 @@ template <typename Data>
 void PQHeap<Data>::RemoveTip() {
   if (size == 0) throw std::length_error("Heap is empty");
   std::swap(Elements[0], Elements[size - 1]);
+  this->CountOp(StatOp::Move, 3);
   Resize(size - 1);  // elimina l'ultimo
   if (size > 0)
     HeapifyDown(0);
@@ -83,6 +84,7 @@ void PQHeap<Data>::Insert(const Data& dat) {
         Resize(size + 1); // Ensure enough space
 
   Elements[size-1] = dat;
+  this->CountOp(StatOp::Copy);
   HeapifyUp(size - 1);
 }
 
@@ -91,6 +93,7 @@ template <typename Data>
 void PQHeap<Data>::Insert(Data&& dat) {
     Resize(size + 1); // Ensure enough space
   Elements[size -1] = std::move(dat);
+  this->CountOp(StatOp::Move);
   HeapifyUp(size - 1);
 }
 
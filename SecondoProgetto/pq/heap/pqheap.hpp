@@ -31,6 +31,10 @@ namespace lasd
   public:
     PQHeap() = default; // Default constructor
 
+    // Operation counters (see stats/stats.hpp)
+    using HeapVec<Data>::Stats;
+    using HeapVec<Data>::ResetStats;
+
     /* ************************************************************************ */
 
     // Specific constructors
@@ -72,6 +76,13 @@ PQHeap(PQHeap<Data>&&) noexcept;
       HeapVec<Data>::Clear(); // Call the Clear method of the base class
     } // No need to throw exceptions, as Clear is not expected to fail
 
+    // Specific member function (inherited from Container)
+    MemStats MemoryUsage() const noexcept override { // Override Container member
+      MemStats mem = Vector<Data>::MemoryUsage();
+      mem.overhead += sizeof(*this) - sizeof(Vector<Data>); // Il resto dell'oggetto
+      return mem;
+    }
+
       //espongo Front e Back
  using LinearContainer<Data>::Front; // const Front()
 using LinearContainer<Data>::Back;  // const Back()
@@ -0,0 +1,140 @@
+#ifndef SERIAL_CPP
+#define SERIAL_CPP
+
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************ */
+
+// File chiuso all'uscita dallo scope (anche per eccezione)
+struct FileCloser {
+  void operator()(std::FILE* fil) const noexcept { std::fclose(fil); }
+};
+
+using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+
+inline FilePtr OpenBinary(const std::string& path, const char* mode) {
+  FilePtr fil(std::fopen(path.c_str(), mode));
+  if (fil == nullptr) {
+    throw std::runtime_error("Cannot open " + path);
+  }
+  std::setvbuf(fil.get(), nullptr, _IOFBF, 1 << 20);
+  return fil;
+}
+
+/* ************************************************************************ */
+
+// Scrittura: su un file temporaneo rinominato alla fine, così un file
+// esistente è sostituito solo da uno completo
+template <typename Data>
+void SaveBinary(const std::string& path, char tag, const Data* fst, ulong fstnum, const Data* snd, ulong sndnum) {
+  BinaryHeader hdr;
+  hdr.tag = static_cast<std::uint8_t>(tag);
+  hdr.encoding = BinaryEncoding<Data>();
+  hdr.elemsize = (hdr.encoding == 0) ? sizeof(Data) : 1;
+  hdr.count = fstnum + sndnum;
+
+  std::string tmp = path + ".tmp";
+  {
+    FilePtr fil = OpenBinary(tmp, "wb");
+    bool ok = (std::fwrite(&hdr, sizeof(hdr), 1, fil.get()) == 1);
+    for (auto [dat, num] : {std::pair(fst, fstnum), std::pair(snd, sndnum)}) {
+      if constexpr (BinaryEncoding<Data>() == 0) {
+        ok = ok && (num == 0 || std::fwrite(dat, sizeof(Data), num, fil.get()) == num);
+      } else {
+        for (ulong i = 0; ok && i < num; ++i) {
+          std::uint64_t len = dat[i].size();
+          ok = (std::fwrite(&len, sizeof(len), 1, fil.get()) == 1) &&
+               (len == 0 || std::fwrite(dat[i].data(), 1, len, fil.get()) == len);
+        }
+      }
+    }
+    // fclose scrive il buffer: anche il suo esito conta
+    ok = (std::fclose(fil.release()) == 0) && ok;
+    if (!ok) {
+      std::remove(tmp.c_str());
+      throw std::runtime_error("Cannot write " + path);
+    }
+  }
+  if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+    std::remove(tmp.c_str());
+    throw std::runtime_error("Cannot write " + path);
+  }
+}
+
+/* ************************************************************************ */
+
+template <typename Data, typename Alloc>
+char LoadBinary(const std::string& path, Alloc alloc) {
+  FilePtr fil = OpenBinary(path, "rb");
+  std::fseek(fil.get(), 0, SEEK_END);
+  long length = std::ftell(fil.get());
+  std::fseek(fil.get(), 0, SEEK_SET);
+
+  BinaryHeader hdr;
+  if (length < 0 || std::fread(&hdr, sizeof(hdr), 1, fil.get()) != 1) {
+    throw std::runtime_error("Truncated binary file " + path);
+  }
+  CheckHeader<Data>(hdr, length, path);
+
+  ulong num = hdr.count;
+  Data* dat = alloc(num);
+  if constexpr (BinaryEncoding<Data>() == 0) {
+    if (num != 0 && std::fread(dat, sizeof(Data), num, fil.get()) != num) {
+      throw std::runtime_error("Truncated binary file " + path);
+    }
+  } else {
+    ulong left = length - sizeof(hdr);
+    for (ulong i = 0; i < num; ++i) {
+      std::uint64_t len;
+      if (std::fread(&len, sizeof(len), 1, fil.get()) != 1 || len > left - sizeof(len)) {
+        throw std::runtime_error("Truncated binary file " + path);
+      }
+      left -= sizeof(len) + len;
+      dat[i].resize(len);
+      if (len != 0 && std::fread(dat[i].data(), 1, len, fil.get()) != len) {
+        throw std::runtime_error("Truncated binary file " + path);
+      }
+    }
+  }
+  return static_cast<char>(hdr.tag);
+}
+
+/* ************************************************************************ */
+
+template <typename Data>
+void CheckHeader(const BinaryHeader& hdr, ulong length, const std::string& path) {
+  BinaryHeader exp;
+  if (std::memcmp(hdr.magic, exp.magic, sizeof(exp.magic)) != 0) {
+    throw std::runtime_error("Not a lasd binary file: " + path);
+  }
+  if (hdr.version != exp.version) {
+    throw std::runtime_error("Unsupported binary format version in " + path);
+  }
+  if (hdr.endian != exp.endian) {
+    throw std::runtime_error("Binary file written with a different byte order: " + path);
+  }
+  std::uint8_t enc = BinaryEncoding<Data>();
+  if (hdr.encoding != enc || hdr.elemsize != ((enc == 0) ? sizeof(Data) : 1)) {
+    throw std::runtime_error("Element type mismatch in " + path);
+  }
+  // Il conteggio deve essere compatibile con la lunghezza (anche contro gli overflow)
+  ulong payload = length - sizeof(BinaryHeader);
+  bool fits = (enc == 0) ? (hdr.count == payload / sizeof(Data) && payload % sizeof(Data) == 0)
+                         : (hdr.count <= payload / sizeof(std::uint64_t));
+  if (!fits) {
+    throw std::runtime_error("Truncated binary file " + path);
+  }
+}
+
+/* ************************************************************************ */
+
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef SERIAL_HPP
+#define SERIAL_HPP
+
+/* ************************************************************************** */
+/*
+  serial.hpp - Formato binario dei contenitori lineari
+
+  Un file è formato da un'intestazione di 32 byte seguita dagli elementi in
+  ordine. L'intestazione riporta la versione del formato, il contenitore che
+  l'ha scritto (tag), la codifica degli elementi, la loro dimensione e il
+  loro numero:
+    - tipi banalmente copiabili: gli elementi sono copiati byte per byte, così
+      il file si legge con una sola fread o si mappa in memoria (payload
+      allineato a 32 byte);
+    - std::string: per ogni stringa la lunghezza (8 byte) e poi i caratteri.
+  Gli altri tipi non sono supportati (errore in compilazione).
+  Il file usa l'ordine dei byte della macchina che lo scrive: un marcatore
+  nell'intestazione fa rifiutare i file scritti con l'ordine opposto.
+
+  Gli errori di I/O e i file non validi lanciano std::runtime_error.
+*/
+/* ************************************************************************** */
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+struct BinaryHeader {
+  char magic[4] = {'L', 'A', 'S', 'D'};
+  std::uint16_t version = 1;
+  std::uint8_t tag = 0;      // 'V' Vector, 'S' SetVec (chiavi strettamente crescenti), 'H' HeapVec
+  std::uint8_t encoding = 0; // 0 byte per byte, 1 stringhe con lunghezza
+  std::uint32_t endian = 0x01020304;
+  std::uint32_t elemsize = 0;
+  std::uint64_t count = 0;
+  std::uint64_t reserved = 0;
+};
+
+static_assert(sizeof(BinaryHeader) == 32);
+
+// Codifica usata per Data (solo per i tipi supportati)
+template <typename Data>
+constexpr std::uint8_t BinaryEncoding() {
+  static_assert(std::is_trivially_copyable_v<Data> || std::is_same_v<Data, std::string>,
+                "Binary serialization needs a trivially copyable Data or std::string");
+  return std::is_trivially_copyable_v<Data> ? 0 : 1;
+}
+
+// Scrive num1 elementi da fst e poi num2 da snd (due tratti, per i buffer circolari)
+template <typename Data>
+void SaveBinary(const std::string &, char, const Data *, ulong, const Data * = nullptr, ulong = 0);
+
+// Legge un file: alloc(num) deve restituire lo spazio per num elementi
+// (nullptr se num è 0); restituisce il tag del contenitore che l'ha scritto
+template <typename Data, typename Alloc>
+char LoadBinary(const std::string &, Alloc);
+
+// Controlla un'intestazione letta da un file di length byte (std::runtime_error se non valida)
+template <typename Data>
+void CheckHeader(const BinaryHeader &, ulong, const std::string &);
+
+/* ************************************************************************** */
+
+}
+
+#include "serial.cpp"
+
+#endif
@@ -0,0 +1,787 @@
+#ifndef SETBTREE_CPP
+#define SETBTREE_CPP
+
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************ */
+
+// Distruttore dei nodi interni: libera ricorsivamente i figli
+template <typename Data>
+SetBTree<Data>::Inner::~Inner() {
+  for (ulong i = 0; i <= this->count; ++i) {
+    delete child[i];
+  }
+}
+
+/* ************************************************************************ */
+
+// Costruttore da TraversableContainer
+template <typename Data>
+SetBTree<Data>::SetBTree(const TraversableContainer<Data>& con) {
+  ulong distinct = 0;
+  if (IsSorted(con, distinct)) {
+    BulkLoad(distinct,
+      [&con](auto& push) {
+        con.Traverse(
+          [&push](const Data& dat) {
+            push(dat);
+          }
+        );
+      }
+    );
+  } else {
+    con.Traverse(
+      [this](const Data& dat) {
+        Insert(dat);
+      }
+    );
+  }
+}
+
+// Costruttore da MappableContainer (rvalue)
+template <typename Data>
+SetBTree<Data>::SetBTree(MappableContainer<Data>&& con) {
+  ulong distinct = 0;
+  if (IsSorted(con, distinct)) {
+    BulkLoad(distinct,
+      [&con](auto& push) {
+        con.Map(
+          [&push](Data& dat) {
+            push(std::move(dat));
+          }
+        );
+      }
+    );
+  } else {
+    con.Map(
+      [this](Data& dat) {
+        Insert(std::move(dat));
+      }
+    );
+  }
+}
+
+// Copy constructor (le chiavi sono già ordinate: caricamento in blocco)
+template <typename Data>
+SetBTree<Data>::SetBTree(const SetBTree<Data>& other) {
+  BulkLoad(other.size,
+    [&other](auto& push) {
+      for (const Leaf* leaf = other.head; leaf != nullptr; leaf = leaf->next) {
+        for (ulong k = 0; k < leaf->count; ++k) {
+          push(leaf->keys[k]);
+        }
+      }
+    }
+  );
+}
+
+// Move constructor
+template <typename Data>
+SetBTree<Data>::SetBTree(SetBTree<Data>&& other) noexcept {
+  std::swap(root, other.root);
+  std::swap(head, other.head);
+  std::swap(tail, other.tail);
+  std::swap(size, other.size);
+}
+
+// Destructor
+template <typename Data>
+SetBTree<Data>::~SetBTree() {
+  delete root;
+}
+
+// Copy assignment
+template <typename Data>
+SetBTree<Data>& SetBTree<Data>::operator=(const SetBTree<Data>& other) {
+  SetBTree<Data> tmp(other);
+  std::swap(root, tmp.root);
+  std::swap(head, tmp.head);
+  std::swap(tail, tmp.tail);
+  std::swap(size, tmp.size);
+  return *this;
+}
+
+// Move assignment
+template <typename Data>
+SetBTree<Data>& SetBTree<Data>::operator=(SetBTree<Data>&& other) noexcept {
+  std::swap(root, other.root);
+  std::swap(head, other.head);
+  std::swap(tail, other.tail);
+  std::swap(size, other.size);
+  return *this;
+}
+
+// Equality: confronto delle due liste di foglie (la forma dell'albero non conta)
+template <typename Data>
+bool SetBTree<Data>::operator==(const SetBTree<Data>& other) const noexcept {
+  if (size != other.size)
+    return false;
+  const Leaf* lef = head;
+  const Leaf* rig = other.head;
+  ulong i = 0;
+  ulong j = 0;
+  for (ulong n = 0; n < size; ++n) {
+    if (i == lef->count) {
+      lef = lef->next;
+      i = 0;
+    }
+    if (j == rig->count) {
+      rig = rig->next;
+      j = 0;
+    }
+    if (lef->keys[i++] != rig->keys[j++])
+      return false;
+  }
+  return true;
+}
+
+template <typename Data>
+inline bool SetBTree<Data>::operator!=(const SetBTree<Data>& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************ */
+
+// Min / Max: prima chiave della prima foglia, ultima dell'ultima
+
+template <typename Data>
+const Data& SetBTree<Data>::Min() const {
+  if (size == 0) throw std::length_error("Empty container");
+  return head->keys[0];
+}
+
+template <typename Data>
+Data SetBTree<Data>::MinNRemove() {
+  Data tmp = Min();
+  Remove(tmp);
+  return tmp;
+}
+
+template <typename Data>
+void SetBTree<Data>::RemoveMin() {
+  MinNRemove();
+}
+
+template <typename Data>
+const Data& SetBTree<Data>::Max() const {
+  if (size == 0) throw std::length_error("Empty container");
+  return tail->keys[tail->count - 1];
+}
+
+template <typename Data>
+Data SetBTree<Data>::MaxNRemove() {
+  Data tmp = Max();
+  Remove(tmp);
+  return tmp;
+}
+
+template <typename Data>
+void SetBTree<Data>::RemoveMax() {
+  MaxNRemove();
+}
+
+// Predecessor / Successor: se nella foglia raggiunta non c'è, è il bordo della
+// foglia adiacente (tutte le chiavi intermedie stanno nella foglia raggiunta)
+
+template <typename Data>
+const Data& SetBTree<Data>::Predecessor(const Data& val) const {
+  const Leaf* leaf = FindLeaf(val, false);
+  if (leaf != nullptr) {
+    ulong p = LowerIdx(leaf, val);
+    if (p > 0)
+      return leaf->keys[p - 1];
+    if (leaf->prev != nullptr)
+      return leaf->prev->keys[leaf->prev->count - 1];
+  }
+  throw std::length_error("No predecessor");
+}
+
+template <typename Data>
+Data SetBTree<Data>::PredecessorNRemove(const Data& val) {
+  Data tmp = Predecessor(val);
+  Remove(tmp);
+  return tmp;
+}
+
+template <typename Data>
+void SetBTree<Data>::RemovePredecessor(const Data& val) {
+  PredecessorNRemove(val);
+}
+
+template <typename Data>
+const Data& SetBTree<Data>::Successor(const Data& val) const {
+  const Leaf* leaf = FindLeaf(val, true);
+  if (leaf != nullptr) {
+    ulong p = UpperIdx(leaf, val);
+    if (p < leaf->count)
+      return leaf->keys[p];
+    if (leaf->next != nullptr)
+      return leaf->next->keys[0];
+  }
+  throw std::length_error("No successor");
+}
+
+template <typename Data>
+Data SetBTree<Data>::SuccessorNRemove(const Data& val) {
+  Data tmp = Successor(val);
+  Remove(tmp);
+  return tmp;
+}
+
+template <typename Data>
+void SetBTree<Data>::RemoveSuccessor(const Data& val) {
+  SuccessorNRemove(val);
+}
+
+/* ************************************************************************ */
+
+// Insert
+
+template <typename Data>
+bool SetBTree<Data>::Insert(const Data& val) {
+  return InsertKey(val);
+}
+
+template <typename Data>
+bool SetBTree<Data>::Insert(Data&& val) {
+  return InsertKey(std::move(val));
+}
+
+// Remove: se la radice interna resta con un solo figlio, l'albero si abbassa
+template <typename Data>
+bool SetBTree<Data>::Remove(const Data& val) {
+  if (root == nullptr || !RemoveAt(root, val))
+    return false;
+  --size;
+  if (root->count == 0) {
+    if (root->leaf) {
+      delete root;
+      root = nullptr;
+      head = tail = nullptr;
+    } else {
+      Inner* in = static_cast<Inner*>(root);
+      root = in->child[0];
+      in->child[0] = nullptr;
+      delete in;
+    }
+  }
+  return true;
+}
+
+/* ************************************************************************ */
+
+// Accesso per indice: si scende sottraendo le dimensioni dei sottoalberi saltati
+template <typename Data>
+const Data& SetBTree<Data>::operator[](ulong idx) const {
+  if (idx >= size) throw std::out_of_range("Index out of bounds");
+  const Node* node = root;
+  while (!node->leaf) {
+    const Inner* in = static_cast<const Inner*>(node);
+    ulong i = 0;
+    while (idx >= in->sizes[i]) {
+      idx -= in->sizes[i++];
+    }
+    node = in->child[i];
+  }
+  return node->keys[idx];
+}
+
+// Traverse (in ordine crescente)
+template <typename Data>
+void SetBTree<Data>::Traverse(TraverseFun fun) const {
+  for (const Leaf* leaf = head; leaf != nullptr; leaf = leaf->next) {
+    for (ulong k = 0; k < leaf->count; ++k) {
+      fun(leaf->keys[k]);
+    }
+  }
+}
+
+template <typename Data>
+void SetBTree<Data>::PreOrderTraverse(TraverseFun fun) const {
+  Traverse(fun);
+}
+
+// PostOrderTraverse (in ordine decrescente)
+template <typename Data>
+void SetBTree<Data>::PostOrderTraverse(TraverseFun fun) const {
+  for (const Leaf* leaf = tail; leaf != nullptr; leaf = leaf->prev) {
+    for (ulong k = leaf->count; k > 0; --k) {
+      fun(leaf->keys[k - 1]);
+    }
+  }
+}
+
+/* ************************************************************************ */
+
+// Exists
+template <typename Data>
+bool SetBTree<Data>::Exists(const Data& val) const noexcept {
+  const Leaf* leaf = FindLeaf(val, true);
+  if (leaf == nullptr)
+    return false;
+  ulong p = LowerIdx(leaf, val);
+  return (p < leaf->count && !(val < leaf->keys[p]));
+}
+
+// Clear
+template <typename Data>
+void SetBTree<Data>::Clear() {
+  delete root;
+  root = nullptr;
+  head = tail = nullptr;
+  size = 0;
+}
+
+// MemoryUsage: visita di tutti i nodi
+template <typename Data>
+MemStats SetBTree<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this);
+  if (root != nullptr)
+    NodeMemory(root, mem);
+  return mem;
+}
+
+/* ************************************************************************ */
+
+// Ricerca binaria nelle chiavi di un nodo (un nodo sta in poche linee di cache)
+
+template <typename Data>
+ulong SetBTree<Data>::LowerIdx(const Node* node, const Data& val) noexcept {
+  ulong lo = 0;
+  ulong hi = node->count;
+  while (lo < hi) {
+    ulong mid = (lo + hi) / 2;
+    if (node->keys[mid] < val)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+template <typename Data>
+ulong SetBTree<Data>::UpperIdx(const Node* node, const Data& val) noexcept {
+  ulong lo = 0;
+  ulong hi = node->count;
+  while (lo < hi) {
+    ulong mid = (lo + hi) / 2;
+    if (val < node->keys[mid])
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return lo;
+}
+
+// Una foglia contiene payload (le chiavi, già contate) e posizioni libere;
+// in un nodo interno anche le chiavi (separatori) sono overhead, mentre le
+// posizioni libere di chiavi, figli e dimensioni sono slack
+template <typename Data>
+void SetBTree<Data>::NodeMemory(const Node* node, MemStats& mem) noexcept {
+  ulong freekeys = cap + 1 - node->count;
+  mem.allocations++;
+  if (node->leaf) {
+    mem.overhead += sizeof(Leaf) - (cap + 1) * sizeof(Data);
+    mem.slack += freekeys * sizeof(Data);
+    return;
+  }
+  const Inner* in = static_cast<const Inner*>(node);
+  ulong freeslots = freekeys * (sizeof(Data) + sizeof(Node*) + sizeof(ulong));
+  mem.overhead += sizeof(Inner) - freeslots;
+  mem.slack += freeslots;
+  for (ulong i = 0; i <= in->count; ++i) {
+    NodeMemory(in->child[i], mem);
+  }
+}
+
+template <typename Data>
+ulong SetBTree<Data>::Weight(const Node* node) noexcept {
+  if (node->leaf)
+    return node->count;
+  const Inner* in = static_cast<const Inner*>(node);
+  ulong tot = 0;
+  for (ulong i = 0; i <= in->count; ++i) {
+    tot += in->sizes[i];
+  }
+  return tot;
+}
+
+// Scende fino alla foglia: con upper i separatori uguali a val portano a destra
+// (foglia che contiene val), altrimenti a sinistra (foglia con le chiavi < val)
+template <typename Data>
+const typename SetBTree<Data>::Leaf* SetBTree<Data>::FindLeaf(const Data& val, bool upper) const noexcept {
+  const Node* node = root;
+  if (node == nullptr)
+    return nullptr;
+  while (!node->leaf) {
+    ulong i = upper ? UpperIdx(node, val) : LowerIdx(node, val);
+    node = static_cast<const Inner*>(node)->child[i];
+  }
+  return static_cast<const Leaf*>(node);
+}
+
+/* ************************************************************************ */
+
+// Inserimento: discesa ricorsiva; un nodo che supera cap chiavi si divide e
+// restituisce al padre il nuovo fratello destro e il separatore
+
+template <typename Data>
+template <typename Val>
+bool SetBTree<Data>::InsertKey(Val&& val) {
+  if (root == nullptr) {
+    head = tail = new Leaf();
+    root = head;
+  }
+  Node* sib = nullptr;
+  Data sep;
+  if (!InsertAt(root, std::forward<Val>(val), sib, sep))
+    return false;
+  if (sib != nullptr) {
+    Inner* in = new Inner();
+    in->child[0] = root;
+    in->child[1] = sib;
+    in->sizes[1] = Weight(sib);
+    in->sizes[0] = size + 1 - in->sizes[1];
+    in->keys[0] = std::move(sep);
+    in->count = 1;
+    root = in;
+  }
+  ++size;
+  return true;
+}
+
+template <typename Data>
+template <typename Val>
+bool SetBTree<Data>::InsertAt(Node* node, Val&& val, Node*& sib, Data& sep) {
+  if (node->leaf) {
+    ulong p = LowerIdx(node, val);
+    if (p < node->count && !(val < node->keys[p]))
+      return false;
+    for (ulong k = node->count; k > p; --k) {
+      node->keys[k] = std::move(node->keys[k - 1]);
+    }
+    node->keys[p] = std::forward<Val>(val);
+    if (++node->count > cap)
+      sib = SplitLeaf(static_cast<Leaf*>(node), sep);
+    return true;
+  }
+
+  Inner* in = static_cast<Inner*>(node);
+  ulong i = UpperIdx(in, val);
+  Node* csib = nullptr;
+  Data csep;
+  if (!InsertAt(in->child[i], std::forward<Val>(val), csib, csep))
+    return false;
+  ++in->sizes[i];
+  if (csib != nullptr) {
+    for (ulong k = in->count; k > i; --k) {
+      in->keys[k] = std::move(in->keys[k - 1]);
+      in->child[k + 1] = in->child[k];
+      in->sizes[k + 1] = in->sizes[k];
+    }
+    in->keys[i] = std::move(csep);
+    in->child[i + 1] = csib;
+    in->sizes[i + 1] = Weight(csib);
+    in->sizes[i] -= in->sizes[i + 1];
+    if (++in->count > cap)
+      sib = SplitInner(in, sep);
+  }
+  return true;
+}
+
+// Foglia con cap + 1 chiavi: la metà alta passa a una nuova foglia
+template <typename Data>
+typename SetBTree<Data>::Leaf* SetBTree<Data>::SplitLeaf(Leaf* leaf, Data& sep) {
+  Leaf* rig = new Leaf();
+  ulong mid = leaf->count / 2;
+  for (ulong k = mid; k < leaf->count; ++k) {
+    rig->keys[k - mid] = std::move(leaf->keys[k]);
+  }
+  rig->count = leaf->count - mid;
+  leaf->count = mid;
+
+  rig->prev = leaf;
+  rig->next = leaf->next;
+  if (leaf->next != nullptr)
+    leaf->next->prev = rig;
+  else
+    tail = rig;
+  leaf->next = rig;
+
+  sep = rig->keys[0];
+  return rig;
+}
+
+// Nodo interno con cap + 1 separatori: quello centrale sale al padre
+template <typename Data>
+typename SetBTree<Data>::Inner* SetBTree<Data>::SplitInner(Inner* in, Data& sep) {
+  Inner* rig = new Inner();
+  ulong mid = in->count / 2;
+  for (ulong k = mid + 1; k < in->count; ++k) {
+    rig->keys[k - mid - 1] = std::move(in->keys[k]);
+  }
+  for (ulong k = mid + 1; k <= in->count; ++k) {
+    rig->child[k - mid - 1] = in->child[k];
+    rig->sizes[k - mid - 1] = in->sizes[k];
+    in->child[k] = nullptr;
+  }
+  rig->count = in->count - mid - 1;
+  sep = std::move(in->keys[mid]);
+  in->count = mid;
+  return rig;
+}
+
+/* ************************************************************************ */
+
+// Rimozione: discesa ricorsiva; un figlio rimasto con meno di minkeys chiavi
+// prende una chiave da un fratello o si fonde con esso. I separatori possono
+// restare uguali a chiavi rimosse: separano comunque correttamente i figli.
+
+template <typename Data>
+bool SetBTree<Data>::RemoveAt(Node* node, const Data& val) {
+  if (node->leaf) {
+    ulong p = LowerIdx(node, val);
+    if (p == node->count || val < node->keys[p])
+      return false;
+    for (ulong k = p + 1; k < node->count; ++k) {
+      node->keys[k - 1] = std::move(node->keys[k]);
+    }
+    --node->count;
+    return true;
+  }
+
+  Inner* in = static_cast<Inner*>(node);
+  ulong i = UpperIdx(in, val);
+  if (!RemoveAt(in->child[i], val))
+    return false;
+  --in->sizes[i];
+  if (in->child[i]->count < minkeys)
+    Fix(in, i);
+  return true;
+}
+
+template <typename Data>
+void SetBTree<Data>::Fix(Inner* in, ulong i) {
+  if (i > 0 && in->child[i - 1]->count > minkeys)
+    BorrowLeft(in, i);
+  else if (i < in->count && in->child[i + 1]->count > minkeys)
+    BorrowRight(in, i);
+  else if (i > 0)
+    Merge(in, i - 1);
+  else
+    Merge(in, i);
+}
+
+// Sposta l'ultima chiave (o l'ultimo figlio) del fratello sinistro nel figlio i
+template <typename Data>
+void SetBTree<Data>::BorrowLeft(Inner* in, ulong i) {
+  Node* lef = in->child[i - 1];
+  Node* cur = in->child[i];
+  for (ulong k = cur->count; k > 0; --k) {
+    cur->keys[k] = std::move(cur->keys[k - 1]);
+  }
+  ulong moved = 1;
+  if (cur->leaf) {
+    cur->keys[0] = std::move(lef->keys[lef->count - 1]);
+    in->keys[i - 1] = cur->keys[0];
+  } else {
+    Inner* l = static_cast<Inner*>(lef);
+    Inner* c = static_cast<Inner*>(cur);
+    for (ulong k = c->count + 1; k > 0; --k) {
+      c->child[k] = c->child[k - 1];
+      c->sizes[k] = c->sizes[k - 1];
+    }
+    c->keys[0] = std::move(in->keys[i - 1]);
+    c->child[0] = l->child[l->count];
+    c->sizes[0] = moved = l->sizes[l->count];
+    l->child[l->count] = nullptr;
+    in->keys[i - 1] = std::move(l->keys[l->count - 1]);
+  }
+  --lef->count;
+  ++cur->count;
+  in->sizes[i - 1] -= moved;
+  in->sizes[i] += moved;
+}
+
+// Sposta la prima chiave (o il primo figlio) del fratello destro nel figlio i
+template <typename Data>
+void SetBTree<Data>::BorrowRight(Inner* in, ulong i) {
+  Node* cur = in->child[i];
+  Node* rig = in->child[i + 1];
+  ulong moved = 1;
+  if (cur->leaf) {
+    cur->keys[cur->count] = std::move(rig->keys[0]);
+    for (ulong k = 1; k < rig->count; ++k) {
+      rig->keys[k - 1] = std::move(rig->keys[k]);
+    }
+    in->keys[i] = rig->keys[0];
+  } else {
+    Inner* c = static_cast<Inner*>(cur);
+    Inner* r = static_cast<Inner*>(rig);
+    c->keys[c->count] = std::move(in->keys[i]);
+    c->child[c->count + 1] = r->child[0];
+    c->sizes[c->count + 1] = moved = r->sizes[0];
+    in->keys[i] = std::move(r->keys[0]);
+    for (ulong k = 1; k < r->count; ++k) {
+      r->keys[k - 1] = std::move(r->keys[k]);
+    }
+    for (ulong k = 1; k <= r->count; ++k) {
+      r->child[k - 1] = r->child[k];
+      r->sizes[k - 1] = r->sizes[k];
+    }
+    r->child[r->count] = nullptr;
+  }
+  ++cur->count;
+  --rig->count;
+  in->sizes[i] += moved;
+  in->sizes[i + 1] -= moved;
+}
+
+// Fonde il figlio i + 1 nel figlio i e toglie il separatore tra i due
+template <typename Data>
+void SetBTree<Data>::Merge(Inner* in, ulong i) {
+  Node* lef = in->child[i];
+  Node* rig = in->child[i + 1];
+  if (lef->leaf) {
+    for (ulong k = 0; k < rig->count; ++k) {
+      lef->keys[lef->count + k] = std::move(rig->keys[k]);
+    }
+    lef->count += rig->count;
+    Leaf* l = static_cast<Leaf*>(lef);
+    Leaf* r = static_cast<Leaf*>(rig);
+    l->next = r->next;
+    if (r->next != nullptr)
+      r->next->prev = l;
+    else
+      tail = l;
+  } else {
+    Inner* l = static_cast<Inner*>(lef);
+    Inner* r = static_cast<Inner*>(rig);
+    l->keys[l->count] = std::move(in->keys[i]);
+    for (ulong k = 0; k < r->count; ++k) {
+      l->keys[l->count + 1 + k] = std::move(r->keys[k]);
+    }
+    for (ulong k = 0; k <= r->count; ++k) {
+      l->child[l->count + 1 + k] = r->child[k];
+      l->sizes[l->count + 1 + k] = r->sizes[k];
+      r->child[k] = nullptr;
+    }
+    l->count += r->count + 1;
+  }
+  rig->count = 0;
+  delete rig;
+
+  in->sizes[i] += in->sizes[i + 1];
+  for (ulong k = i + 1; k < in->count; ++k) {
+    in->keys[k - 1] = std::move(in->keys[k]);
+    in->child[k] = in->child[k + 1];
+    in->sizes[k] = in->sizes[k + 1];
+  }
+  in->child[in->count] = nullptr;
+  --in->count;
+}
+
+/* ************************************************************************ */
+
+// Caricamento in blocco
+
+template <typename Data>
+bool SetBTree<Data>::IsSorted(const TraversableContainer<Data>& con, ulong& distinct) {
+  bool sorted = true;
+  bool first = true;
+  Data prev;
+  distinct = 0;
+  con.Traverse(
+    [&](const Data& dat) {
+      if (first || prev < dat)
+        ++distinct;
+      else if (dat < prev)
+        sorted = false;
+      prev = dat;
+      first = false;
+    }
+  );
+  return sorted;
+}
+
+// Riempie n chiavi ordinate in foglie distribuite in modo uniforme (ognuna con
+// almeno minkeys chiavi), poi costruisce i livelli interni dal basso. fill
+// riceve la funzione push, da chiamare su ogni chiave in ordine non
+// decrescente: i duplicati vengono scartati.
+template <typename Data>
+template <typename Fill>
+void SetBTree<Data>::BulkLoad(ulong n, Fill fill) {
+  if (n == 0)
+    return;
+
+  ulong cnt = (n + cap - 1) / cap;
+  Node** level = new Node*[cnt];
+  Leaf* prev = nullptr;
+  for (ulong j = 0; j < cnt; ++j) {
+    Leaf* leaf = new Leaf();
+    leaf->prev = prev;
+    if (prev != nullptr)
+      prev->next = leaf;
+    level[j] = prev = leaf;
+  }
+  head = static_cast<Leaf*>(level[0]);
+  tail = prev;
+  root = level[0];
+  size = n;
+
+  Leaf* cur = head;
+  ulong tgt = n / cnt + (0 < n % cnt);
+  ulong j = 0;
+  const Data* last = nullptr;
+  auto push = [&](auto&& dat) {
+    if (last != nullptr && !(*last < dat))
+      return;
+    if (cur->count == tgt) {
+      cur = cur->next;
+      ++j;
+      tgt = n / cnt + (j < n % cnt);
+    }
+    cur->keys[cur->count] = std::forward<decltype(dat)>(dat);
+    last = &cur->keys[cur->count++];
+  };
+  fill(push);
+
+  // Ogni livello raggruppa i nodi del precedente in gruppi di cap + 1 al più
+  while (cnt > 1) {
+    ulong par = (cnt + cap) / (cap + 1);
+    Node** upper = new Node*[par];
+    ulong c = 0;
+    for (ulong p = 0; p < par; ++p) {
+      Inner* in = new Inner();
+      ulong num = cnt / par + (p < cnt % par);
+      for (ulong k = 0; k < num; ++k, ++c) {
+        in->child[k] = level[c];
+        in->sizes[k] = Weight(level[c]);
+        if (k > 0) {
+          const Node* node = level[c];
+          while (!node->leaf) {
+            node = static_cast<const Inner*>(node)->child[0];
+          }
+          in->keys[k - 1] = node->keys[0];
+        }
+      }
+      in->count = num - 1;
+      upper[p] = in;
+    }
+    delete[] level;
+    level = upper;
+    cnt = par;
+  }
+  root = level[0];
+  delete[] level;
+}
+
+/* ************************************************************************ */
+
+}
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef SETBTREE_HPP
+#define SETBTREE_HPP
+
+/* ************************************************************************** */
+/*
+  setbtree.hpp - Definizione della classe SetBTree
+
+  Insieme ordinato implementato come B+-tree: tutte le chiavi stanno nelle
+  foglie, collegate tra loro in una lista doppia (visita in ordine e
+  Predecessor/Successor senza risalire l'albero), mentre i nodi interni
+  contengono solo separatori e, per ogni figlio, il numero di chiavi del suo
+  sottoalbero (così operator[] costa O(log n)).
+
+  Ogni nodo ha fino a "cap" chiavi contigue, scelte in modo da occupare
+  qualche linea di cache: una ricerca costa O(log_B n) miss invece di uno
+  per confronto, e una visita completa O(n / B).
+
+  Invarianti: ogni nodo diverso dalla radice ha almeno cap / 2 chiavi; il
+  separatore keys[i] di un nodo interno è maggiore di tutte le chiavi del
+  figlio i e minore o uguale a tutte quelle del figlio i + 1.
+*/
+
+/* ************************************************************************** */
+
+#include <stdexcept>
+
+#include "../set.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+class SetBTree : public virtual Set<Data> {
+protected:
+  using Container::size;
+
+  // Chiavi per nodo: circa 256 byte di chiavi, almeno 8, sempre pari
+  static constexpr ulong cap = ((256 / sizeof(Data)) < 8) ? 8 : ((256 / sizeof(Data)) & ~1ul);
+  static constexpr ulong minkeys = cap / 2;
+
+  struct Node {
+    ulong count = 0;
+    bool leaf;
+    Data keys[cap + 1]; // una posizione in più per l'overflow che precede lo split
+
+    Node(bool lf) : leaf(lf) {}
+    virtual ~Node() = default;
+  };
+
+  struct Leaf : Node {
+    Leaf* prev = nullptr;
+    Leaf* next = nullptr;
+
+    Leaf() : Node(true) {}
+  };
+
+  struct Inner : Node {
+    Node* child[cap + 2] = {};
+    ulong sizes[cap + 2] = {}; // chiavi nel sottoalbero di ciascun figlio
+
+    Inner() : Node(false) {}
+    ~Inner();
+  };
+
+  Node* root = nullptr;
+  Leaf* head = nullptr; // foglia con il minimo
+  Leaf* tail = nullptr; // foglia con il massimo
+
+public:
+
+  // Default constructor
+  SetBTree() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  SetBTree(const TraversableContainer<Data> &); // Input ordinato: caricamento in blocco O(n)
+  SetBTree(MappableContainer<Data> &&);
+
+  /* ************************************************************************ */
+
+  SetBTree(const SetBTree &); // Copy constructor
+
+  SetBTree(SetBTree &&) noexcept; // Move constructor
+
+  virtual ~SetBTree(); // Destructor
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  SetBTree & operator=(const SetBTree &);
+
+  // Move assignment
+  SetBTree & operator=(SetBTree &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const SetBTree &) const noexcept;
+  inline bool operator!=(const SetBTree &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  const Data& Min() const override; // (std::length_error se vuoto)
+  Data MinNRemove() override;
+  void RemoveMin() override;
+
+  const Data& Max() const override; // (std::length_error se vuoto)
+  Data MaxNRemove() override;
+  void RemoveMax() override;
+
+  const Data& Predecessor(const Data&) const override; // (std::length_error se non esiste)
+  Data PredecessorNRemove(const Data&) override;
+  void RemovePredecessor(const Data&) override;
+
+  const Data& Successor(const Data&) const override; // (std::length_error se non esiste)
+  Data SuccessorNRemove(const Data&) override;
+  void RemoveSuccessor(const Data&) override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data&) override;
+  bool Insert(Data&&) override;
+  bool Remove(const Data&) override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // O(log n) (std::out_of_range se fuori indice)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+
+  void Traverse(TraverseFun) const override; // Lungo la lista delle foglie
+  void PreOrderTraverse(TraverseFun) const override;
+  void PostOrderTraverse(TraverseFun) const override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data&) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override; // I separatori sono overhead, le posizioni libere dei nodi slack
+
+protected:
+
+  // Auxiliary functions
+
+  static ulong LowerIdx(const Node*, const Data&) noexcept; // Prima chiave >= val
+  static ulong UpperIdx(const Node*, const Data&) noexcept; // Prima chiave > val
+  static ulong Weight(const Node*) noexcept; // Chiavi nel sottoalbero
+  static void NodeMemory(const Node*, MemStats&) noexcept; // Overhead, slack e allocazioni di un sottoalbero
+
+  const Leaf* FindLeaf(const Data&, bool) const noexcept; // Discesa per separatori < val (false) o <= val (true)
+
+  template <typename Val>
+  bool InsertKey(Val&&);
+  template <typename Val>
+  bool InsertAt(Node*, Val&&, Node*&, Data&);
+  Leaf* SplitLeaf(Leaf*, Data&);
+  Inner* SplitInner(Inner*, Data&);
+
+  bool RemoveAt(Node*, const Data&);
+  void Fix(Inner*, ulong);
+  void BorrowLeft(Inner*, ulong);
+  void BorrowRight(Inner*, ulong);
+  void Merge(Inner*, ulong);
+
+  static bool IsSorted(const TraversableContainer<Data>&, ulong&); // Non decrescente? (conta le chiavi distinte)
+  template <typename Fill>
+  void BulkLoad(ulong, Fill);
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "setbtree.cpp"
+
+#endif
@@ -0,0 +1,226 @@
+#ifndef FROZENSET_CPP
+#define FROZENSET_CPP
+
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************ */
+
+// Costruttore da LinearContainer ordinato
+template <typename Data>
+FrozenSet<Data>::FrozenSet(const LinearContainer<Data>& con) {
+  ulong n = con.Size();
+  for (ulong i = 1; i < n; ++i) {
+    if (!(con[i - 1] < con[i])) {
+      throw std::invalid_argument("FrozenSet requires strictly increasing keys");
+    }
+  }
+
+  keys = new Data[n + 1];
+  size = n;
+
+  // Le posizioni in ordine crescente sono quelle di una visita in-order
+  ulong k = First();
+  con.Traverse(
+    [this, &k](const Data& dat) {
+      keys[k] = dat;
+      k = Next(k);
+    }
+  );
+}
+
+// Copy constructor
+template <typename Data>
+FrozenSet<Data>::FrozenSet(const FrozenSet<Data>& other) {
+  if (other.size > 0) {
+    keys = new Data[other.size + 1];
+    for (ulong k = 1; k <= other.size; ++k) {
+      keys[k] = other.keys[k];
+    }
+    size = other.size;
+  }
+}
+
+// Move constructor
+template <typename Data>
+FrozenSet<Data>::FrozenSet(FrozenSet<Data>&& other) noexcept {
+  std::swap(keys, other.keys);
+  std::swap(size, other.size);
+}
+
+// Destructor
+template <typename Data>
+FrozenSet<Data>::~FrozenSet() {
+  delete[] keys;
+}
+
+// Copy assignment
+template <typename Data>
+FrozenSet<Data>& FrozenSet<Data>::operator=(const FrozenSet<Data>& other) {
+  FrozenSet<Data> tmp(other);
+  std::swap(keys, tmp.keys);
+  std::swap(size, tmp.size);
+  return *this;
+}
+
+// Move assignment
+template <typename Data>
+FrozenSet<Data>& FrozenSet<Data>::operator=(FrozenSet<Data>&& other) noexcept {
+  std::swap(keys, other.keys);
+  std::swap(size, other.size);
+  return *this;
+}
+
+// Equality (stesse chiavi implica stesso layout)
+template <typename Data>
+bool FrozenSet<Data>::operator==(const FrozenSet<Data>& other) const noexcept {
+  if (size != other.size)
+    return false;
+  for (ulong k = 1; k <= size; ++k)
+    if (keys[k] != other.keys[k])
+      return false;
+  return true;
+}
+
+template <typename Data>
+inline bool FrozenSet<Data>::operator!=(const FrozenSet<Data>& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************ */
+
+// Min / Max: nodo più a sinistra / più a destra
+
+template <typename Data>
+const Data& FrozenSet<Data>::Min() const {
+  if (size == 0) throw std::length_error("Empty container");
+  return keys[First()];
+}
+
+template <typename Data>
+const Data& FrozenSet<Data>::Max() const {
+  if (size == 0) throw std::length_error("Empty container");
+  ulong k = 1;
+  while (2 * k + 1 <= size) {
+    k = 2 * k + 1;
+  }
+  return keys[k];
+}
+
+// Predecessor / Successor
+
+template <typename Data>
+const Data& FrozenSet<Data>::Predecessor(const Data& val) const {
+  ulong k = LastLess(val);
+  if (k == 0) throw std::length_error("No predecessor");
+  return keys[k];
+}
+
+template <typename Data>
+const Data& FrozenSet<Data>::Successor(const Data& val) const {
+  ulong k = UpperBound(val);
+  if (k == 0) throw std::length_error("No successor");
+  return keys[k];
+}
+
+/* ************************************************************************ */
+
+// Exists
+template <typename Data>
+bool FrozenSet<Data>::Exists(const Data& val) const noexcept {
+  ulong k = LowerBound(val);
+  return (k != 0 && !(val < keys[k]));
+}
+
+// Traverse (in ordine crescente)
+template <typename Data>
+void FrozenSet<Data>::Traverse(TraverseFun fun) const {
+  for (ulong k = First(); k != 0; k = Next(k)) {
+    fun(keys[k]);
+  }
+}
+
+// MemoryUsage
+template <typename Data>
+MemStats FrozenSet<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this);
+  if (keys != nullptr) {
+    mem.slack = sizeof(Data);
+    mem.allocations = 1;
+  }
+  return mem;
+}
+
+/* ************************************************************************ */
+
+// Ricerche senza salti: a ogni livello si scende a sinistra (bit 0) o a destra
+// (bit 1), e nel frattempo si precaricano i discendenti "block" livelli sotto.
+// Alla fine k codifica il cammino: togliendo gli ultimi passi a destra e il
+// passo a sinistra che li precede si ottiene l'ultimo nodo in cui si è andati
+// a sinistra, cioè la prima chiave che ha soddisfatto il confronto.
+
+template <typename Data>
+ulong FrozenSet<Data>::LowerBound(const Data& val) const noexcept {
+  ulong k = 1;
+  while (k <= size) {
+    __builtin_prefetch(keys + ((block * k <= size) ? block * k : 0));
+    k = 2 * k + (keys[k] < val);
+  }
+  return k >> std::countr_one(k) >> 1;
+}
+
+template <typename Data>
+ulong FrozenSet<Data>::UpperBound(const Data& val) const noexcept {
+  ulong k = 1;
+  while (k <= size) {
+    __builtin_prefetch(keys + ((block * k <= size) ? block * k : 0));
+    k = 2 * k + !(val < keys[k]);
+  }
+  return k >> std::countr_one(k) >> 1;
+}
+
+// Simmetrico: togliendo gli ultimi passi a sinistra e il passo a destra che li
+// precede si ottiene l'ultimo nodo con chiave < val
+template <typename Data>
+ulong FrozenSet<Data>::LastLess(const Data& val) const noexcept {
+  ulong k = 1;
+  while (k <= size) {
+    __builtin_prefetch(keys + ((block * k <= size) ? block * k : 0));
+    k = 2 * k + (keys[k] < val);
+  }
+  return k >> std::countr_zero(k) >> 1;
+}
+
+template <typename Data>
+ulong FrozenSet<Data>::First() const noexcept {
+  if (size == 0) return 0;
+  ulong k = 1;
+  while (2 * k <= size) {
+    k = 2 * k;
+  }
+  return k;
+}
+
+template <typename Data>
+ulong FrozenSet<Data>::Next(ulong k) const noexcept {
+  if (2 * k + 1 <= size) {
+    // Minimo del sottoalbero destro
+    k = 2 * k + 1;
+    while (2 * k <= size) {
+      k = 2 * k;
+    }
+    return k;
+  }
+  // Risale finché si arriva da un figlio destro
+  while (k & 1) {
+    k >>= 1;
+  }
+  return k >> 1;
+}
+
+} // namespace lasd
+
+#endif
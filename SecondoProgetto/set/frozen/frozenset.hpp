@@ -0,0 +1,125 @@
+#ifndef FROZENSET_HPP
+#define FROZENSET_HPP
+
+/* ************************************************************************** */
+/*
+  frozenset.hpp - Definizione della classe FrozenSet
+
+  Insieme ordinato immutabile, costruito una volta sola a partire da un
+  contenitore lineare ordinato (tipicamente un SetVec) e poi soltanto letto.
+
+  Le chiavi sono memorizzate in ordine di Eytzinger (l'ordine in ampiezza di
+  un albero binario di ricerca completo, radice in posizione 1, figli di k in
+  2k e 2k+1): i primi livelli della ricerca stanno in poche linee di cache e i
+  discendenti di un nodo a distanza d sono contigui, quindi si possono
+  precaricare (prefetch) mentre si confronta il livello corrente.
+  La ricerca non ha salti condizionati: il confronto decide solo l'indice
+  del figlio.
+*/
+
+/* ************************************************************************** */
+
+#include <bit>
+#include <stdexcept>
+
+#include "../../container/traversable.hpp"
+#include "../../container/linear.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+class FrozenSet : public virtual TraversableContainer<Data> {
+protected:
+  using Container::size;
+
+  Data* keys = nullptr; // keys[1..size] in ordine di Eytzinger (keys[0] inutilizzato)
+
+  // Nodi per linea di cache: si precarica il blocco dei discendenti a questa distanza
+  static constexpr ulong block = std::bit_floor((sizeof(Data) < 32) ? (64 / sizeof(Data)) : 2ul);
+
+public:
+
+  // Default constructor
+  FrozenSet() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  FrozenSet(const LinearContainer<Data> &); // Da un contenitore con chiavi strettamente crescenti (std::invalid_argument altrimenti)
+
+  /* ************************************************************************ */
+
+  FrozenSet(const FrozenSet &); // Copy constructor
+
+  FrozenSet(FrozenSet &&) noexcept; // Move constructor
+
+  virtual ~FrozenSet(); // Destructor
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FrozenSet & operator=(const FrozenSet &);
+
+  // Move assignment
+  FrozenSet & operator=(FrozenSet &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const FrozenSet &) const noexcept;
+  inline bool operator!=(const FrozenSet &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  const Data & Min() const; // std::length_error se vuoto
+  const Data & Max() const; // std::length_error se vuoto
+
+  const Data & Predecessor(const Data &) const; // Massima chiave minore (std::length_error se non esiste)
+  const Data & Successor(const Data &) const; // Minima chiave maggiore (std::length_error se non esiste)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data &) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+
+  void Traverse(TraverseFun) const override; // In ordine crescente
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override; // keys[0] inutilizzato è slack
+
+protected:
+
+  // Auxiliary functions
+
+  ulong LowerBound(const Data &) const noexcept; // Posizione della prima chiave >= val (0 se non esiste)
+  ulong UpperBound(const Data &) const noexcept; // Posizione della prima chiave > val (0 se non esiste)
+  ulong LastLess(const Data &) const noexcept;   // Posizione dell'ultima chiave < val (0 se non esiste)
+
+  ulong First() const noexcept; // Posizione della chiave minima in ordine (0 se vuoto)
+  ulong Next(ulong) const noexcept; // Posizione successiva in ordine (0 alla fine)
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "frozenset.cpp"
+
+#endif
@@ -229,6 +229,15 @@ namespace lasd
     List<Data>::Clear();
   }
 
+  // MemoryUsage: i nodi della lista, più la parte dell'oggetto che non è List
+  template <typename Data>
+  MemStats SetLst<Data>::MemoryUsage() const noexcept
+  {
+    MemStats mem = List<Data>::MemoryUsage();
+    mem.overhead += sizeof(*this) - sizeof(List<Data>);
+    return mem;
+  }
+
   // operator[] const
   template <typename Data>
   const Data &SetLst<Data>::operator[](ulong index) const
@@ -104,6 +104,18 @@ namespace lasd
 
     const Data &operator[](ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
 
+    /* ************************************************************************ */
+
+    // Iteratori STL in sola lettura (modificare gli elementi romperebbe l'ordinamento)
+
+    using iterator = typename List<Data>::const_iterator;
+    using const_iterator = typename List<Data>::const_iterator;
+
+    inline const_iterator begin() const noexcept { return List<Data>::cbegin(); }
+    inline const_iterator end() const noexcept { return List<Data>::cend(); }
+    inline const_iterator cbegin() const noexcept { return List<Data>::cbegin(); }
+    inline const_iterator cend() const noexcept { return List<Data>::cend(); }
+
     /* ************************************************************************** */
 
     // Specific member function (inherited from TestableContainer)
@@ -116,6 +128,12 @@ namespace lasd
 
     void Clear() override; // Override ClearableContainer member
 
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from Container)
+
+    MemStats MemoryUsage() const noexcept override; // Override Container member
+
     /* ************************************************************************ */
     // Specific member functions (inherited from ListContainer)
     void InsertAtFront(const Data &) override;
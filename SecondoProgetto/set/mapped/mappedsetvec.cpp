@@ -0,0 +1,83 @@
+#ifndef MAPPEDSETVEC_CPP
+#define MAPPEDSETVEC_CPP
+
+#include <stdexcept>
+
+namespace lasd {
+
+/* ************************************************************************ */
+
+// Costruttore da file
+template <typename Data>
+MappedSetVec<Data>::MappedSetVec(const std::string& path) : MappedVector<Data>(path) {
+  if (this->Tag() != 'S') {
+    throw std::runtime_error("Not a SetVec binary file: " + path);
+  }
+}
+
+/* ************************************************************************ */
+
+// Min / Max: estremi dell'array
+
+template <typename Data>
+const Data& MappedSetVec<Data>::Min() const {
+  if (size == 0) throw std::length_error("Empty container");
+  return Elements[0];
+}
+
+template <typename Data>
+const Data& MappedSetVec<Data>::Max() const {
+  if (size == 0) throw std::length_error("Empty container");
+  return Elements[size - 1];
+}
+
+// Predecessor / Successor
+
+template <typename Data>
+const Data& MappedSetVec<Data>::Predecessor(const Data& val) const {
+  ulong pos = LowerBound(val);
+  if (pos == 0) throw std::length_error("No predecessor");
+  return Elements[pos - 1];
+}
+
+template <typename Data>
+const Data& MappedSetVec<Data>::Successor(const Data& val) const {
+  ulong pos = LowerBound(val);
+  if (pos < size && !(val < Elements[pos])) {
+    ++pos;
+  }
+  if (pos == size) throw std::length_error("No successor");
+  return Elements[pos];
+}
+
+/* ************************************************************************ */
+
+// Exists
+template <typename Data>
+bool MappedSetVec<Data>::Exists(const Data& val) const noexcept {
+  ulong pos = LowerBound(val);
+  return (pos < size && !(val < Elements[pos]));
+}
+
+/* ************************************************************************ */
+
+template <typename Data>
+ulong MappedSetVec<Data>::LowerBound(const Data& val) const noexcept {
+  ulong lo = 0;
+  ulong hi = size;
+  while (lo < hi) {
+    ulong mid = lo + (hi - lo) / 2;
+    if (Elements[mid] < val) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/* ************************************************************************ */
+
+}
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef MAPPEDSETVEC_HPP
+#define MAPPEDSETVEC_HPP
+
+/* ************************************************************************** */
+/*
+  mappedsetvec.hpp - Definizione della classe MappedSetVec
+
+  Insieme ordinato in sola lettura su un file scritto da SetVec::Save,
+  mappato in memoria (vedi MappedVector): le chiavi sono già in ordine
+  crescente nel file, quindi le interrogazioni sono ricerche binarie dirette
+  sulle pagine mappate, senza ricostruire l'insieme.
+  Si rifiutano (std::runtime_error) i file scritti da altri contenitori.
+*/
+/* ************************************************************************** */
+
+#include "../../vector/mapped/mappedvector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+class MappedSetVec : public MappedVector<Data> {
+protected:
+  using Container::size;
+  using MappedVector<Data>::Elements;
+
+public:
+
+  // Default constructor
+  MappedSetVec() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructor
+  explicit MappedSetVec(const std::string &); // std::runtime_error se il file non è di un SetVec
+
+  /* ************************************************************************ */
+
+  MappedSetVec(MappedSetVec &&) noexcept = default; // Move constructor
+
+  virtual ~MappedSetVec() = default; // Destructor
+
+  MappedSetVec & operator=(MappedSetVec &&) noexcept = default; // Move assignment
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  const Data & Min() const; // std::length_error se vuoto
+  const Data & Max() const; // std::length_error se vuoto
+
+  const Data & Predecessor(const Data &) const; // Massima chiave minore (std::length_error se non esiste)
+  const Data & Successor(const Data &) const; // Minima chiave maggiore (std::length_error se non esiste)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data &) const noexcept override;
+
+protected:
+
+  // Auxiliary functions
+
+  ulong LowerBound(const Data &) const noexcept; // Posizione della prima chiave >= val (size se non esiste)
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "mappedsetvec.cpp"
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <stdexcept>
 #include <functional>
+#include <algorithm>
 namespace lasd {
 
 /* ************************************************************************ */
@@ -81,7 +82,7 @@ inline bool SetVec<Data>::operator==(const SetVec<Data>& other) const noexcept {
   if (size != other.size)
     return false;
   for (ulong i = 0; i < size; ++i)
-    if ((*this)[i] != other[i])
+    if (UncheckedAt(i) != other.UncheckedAt(i))
       return false;
   return true;
 }
@@ -107,8 +108,11 @@ void SetVec<Data>::Resize(ulong newCap) {
     
     // Copy existing elements
     for (ulong i = 0; i < size; i++) {
-        temp[i] = vec[(head + i) % vec.Size()];
+        temp.UncheckedAt(i) = UncheckedAt(i);
     }
+    CountOp(StatOp::Resize);
+    CountOp(StatOp::Allocation);
+    CountOp(StatOp::Copy, size);
     
     // Update vector and indices
     std::swap(vec, temp);
@@ -123,7 +127,8 @@ ulong SetVec<Data>::LowerBoundIndex(const Data& val) const {
 
   while (low < high) {
     ulong mid = low + (high - low) / 2;
-    if ((*this)[mid] < val)
+    CountOp(StatOp::Comparison);
+    if (UncheckedAt(mid) < val)
       low = mid + 1;
     else
       high = mid;
@@ -148,11 +153,13 @@ bool SetVec<Data>::Insert(const Data& val) {
   // Shift elements to make space // valutare un'ottimizzazione scegliendo la direzione dello shift più efficiente
 
   for (ulong i = size; i > pos; --i) {
-    vec[(head + i) % vec.Size()] = std::move(vec[(head + i - 1) % vec.Size()]);
+    UncheckedAt(i) = std::move(UncheckedAt(i - 1));
   }
+  CountOp(StatOp::Move, size - pos);
 
   // Insert the new element
-  vec[(head + pos) % vec.Size()] = val;
+  UncheckedAt(pos) = val;
+  CountOp(StatOp::Copy);
   ++size;
   tail = (head + size) % vec.Size();
   
@@ -170,17 +177,19 @@ bool SetVec<Data>::Insert(Data&& val) {
 
   // Find insertion point
   ulong i = 0;
-  while (i < size && vec[(head + i) % vec.Size()] < val) {
+  while (i < size && UncheckedAt(i) < val) {
     ++i;
   }
+  CountOp(StatOp::Comparison, (i < size) ? i + 1 : i);
 
   // Shift elements to make space
   for (ulong j = size; j > i; --j) {
-    vec[(head + j) % vec.Size()] = std::move(vec[(head + j - 1) % vec.Size()]);
+    UncheckedAt(j) = std::move(UncheckedAt(j - 1));
   }
 
   // Insert the new element
-  vec[(head + i) % vec.Size()] = std::move(val);
+  UncheckedAt(i) = std::move(val);
+  CountOp(StatOp::Move, size - i + 1);
   ++size;
   tail = (head + size) % vec.Size();
   return true;
@@ -195,14 +204,16 @@ bool SetVec<Data>::Remove(const Data& val) {
   ulong idx = LowerBoundIndex(val);
 
   // Check if the element exists
-  if (idx == size || (*this)[idx] != val) {
+  CountOp(StatOp::Comparison, idx < size);
+  if (idx == size || UncheckedAt(idx) != val) {
     return false;
   }
 
   // Shift elements to fill the gap // Valutare un'ottimizzazione scegliendo la direzione dello shift più efficiente
   for (ulong j = idx; j < size - 1; ++j) {
-    (*this)[j] = std::move((*this)[j + 1]);
+    UncheckedAt(j) = std::move(UncheckedAt(j + 1));
   }
+  CountOp(StatOp::Move, size - 1 - idx);
 
   --size;
 
@@ -227,13 +238,20 @@ const Data& SetVec<Data>::operator[](ulong index) const {
   if (index >= size) {
     throw std::out_of_range("Index out of bounds");
   }
-  return vec[(head + index) % vec.Size()];
+  return UncheckedAt(index);
 }
 // Operator[] non-const
 template <typename Data>
 Data& SetVec<Data>::operator[](ulong index) {
   if (index >= size) throw std::out_of_range("Index out of bounds");
-  return vec[(head + index) % vec.Size()];
+  return UncheckedAt(index);
+}
+
+// Tratti contigui: da head alla fine del buffer, poi dall'inizio
+template <typename Data>
+std::pair<std::span<const Data>, std::span<const Data>> SetVec<Data>::Spans() const noexcept {
+  ulong fst = (head + size <= vec.Size()) ? size : (vec.Size() - head);
+  return {std::span<const Data>(vec.data() + head, fst), std::span<const Data>(vec.data(), size - fst)};
 }
 
 /* ************************************************************************ */
@@ -246,7 +264,23 @@ bool SetVec<Data>::Exists(const Data& val) const noexcept {
   ulong index = LowerBoundIndex(val);
   
   // Check if index is valid and the element at index equals val
-  return (index < size && (*this)[index] == val);
+  CountOp(StatOp::Comparison, index < size);
+  return (index < size && UncheckedAt(index) == val);
+}
+
+// Visite
+template <typename Data>
+void SetVec<Data>::PreOrderTraverse(TraverseFun fun) const {
+  auto [fst, snd] = Spans();
+  for (const Data& dat : fst) fun(dat);
+  for (const Data& dat : snd) fun(dat);
+}
+
+template <typename Data>
+void SetVec<Data>::PostOrderTraverse(TraverseFun fun) const {
+  auto [fst, snd] = Spans();
+  for (auto cur = snd.rbegin(); cur != snd.rend(); ++cur) fun(*cur);
+  for (auto cur = fst.rbegin(); cur != fst.rend(); ++cur) fun(*cur);
 }
 
 // Clear
@@ -258,12 +292,118 @@ void SetVec<Data>::Clear() {
 
 /* ************************************************************************ */
 
+// Serializzazione binaria
+
+template <typename Data>
+void SetVec<Data>::Save(const std::string& path) const {
+  // Il buffer circolare si scrive in (al più) due tratti contigui
+  auto [fst, snd] = Spans();
+  SaveBinary<Data>(path, 'S', fst.data(), fst.size(), snd.data(), snd.size());
+}
+
+template <typename Data>
+void SetVec<Data>::Load(const std::string& path) {
+  Vector<Data> tmp;
+  tmp.Load(path);
+  for (ulong i = 1; i < tmp.Size(); ++i) {
+    if (!(tmp[i - 1] < tmp[i])) {
+      throw std::runtime_error("SetVec requires strictly increasing keys: " + path);
+    }
+  }
+  vec = std::move(tmp);
+  size = vec.Size();
+  head = 0;
+  tail = (size == 0) ? 0 : (size % vec.Size());
+}
+
+/* ************************************************************************ */
+
+// Costruzione in streaming
+
+template <typename Data>
+template <typename Source>
+void SetVec<Data>::Build(Source&& src, ulong hint) {
+  Vector<Data> tmp;
+  tmp.Build(src, hint);
+  std::sort(tmp.begin(), tmp.end());
+  ulong num = std::unique(tmp.begin(), tmp.end()) - tmp.begin();
+  tmp.Resize(num);
+  vec = std::move(tmp);
+  size = num;
+  head = tail = 0; // (buffer pieno: tail torna a 0)
+}
+
+/* ************************************************************************ */
+
+// Operazioni insiemistiche
+
+template <typename Data>
+void SetVec<Data>::Union(const SetVec<Data>& other, SetVec<Data>& result) const {
+  Merge(other, result, true, true, true, size + other.size);
+}
+
+template <typename Data>
+void SetVec<Data>::Intersect(const SetVec<Data>& other, SetVec<Data>& result) const {
+  Merge(other, result, false, true, false, (size < other.size) ? size : other.size);
+}
+
+template <typename Data>
+void SetVec<Data>::Difference(const SetVec<Data>& other, SetVec<Data>& result) const {
+  Merge(other, result, true, false, false, size);
+}
+
+template <typename Data>
+void SetVec<Data>::Merge(const SetVec<Data>& other, SetVec<Data>& result,
+                         bool onlyThis, bool both, bool onlyOther, ulong cap) const {
+  // Se result è uno degli operandi si scrive in un set temporaneo
+  if (&result == this || &result == &other) {
+    SetVec<Data> tmp;
+    Merge(other, tmp, onlyThis, both, onlyOther, cap);
+    result = std::move(tmp);
+    return;
+  }
+
+  // Rialloca solo se la capacità attuale non basta (i vecchi valori vengono sovrascritti)
+  if (result.vec.Size() < cap) {
+    result.vec = Vector<Data>(cap);
+  }
+
+  ulong i = 0, j = 0, k = 0;
+  while (i < size && j < other.size) {
+    const Data& a = UncheckedAt(i);
+    const Data& b = other.UncheckedAt(j);
+    if (a < b) {
+      if (onlyThis) result.vec.UncheckedAt(k++) = a;
+      ++i;
+    } else if (b < a) {
+      if (onlyOther) result.vec.UncheckedAt(k++) = b;
+      ++j;
+    } else {
+      if (both) result.vec.UncheckedAt(k++) = a;
+      ++i;
+      ++j;
+    }
+  }
+  for (; onlyThis && i < size; ++i) {
+    result.vec.UncheckedAt(k++) = UncheckedAt(i);
+  }
+  for (; onlyOther && j < other.size; ++j) {
+    result.vec.UncheckedAt(k++) = other.UncheckedAt(j);
+  }
+
+  result.head = 0;
+  result.size = k;
+  result.tail = (result.vec.Size() == 0) ? 0 : k % result.vec.Size();
+}
+
+/* ************************************************************************ */
+
 // Min/Max/Predecessor/Successor e versioni NRemove / Remove
 
 template <typename Data>
 const Data& SetVec<Data>::Min() const {
   if (size == 0) throw std::length_error("Empty container");
-  return (*this)[0];
+  return UncheckedAt(0);
 }
 
 template <typename Data>
@@ -300,7 +440,7 @@ void SetVec<Data>::RemoveMin() {
 template <typename Data>
 const Data& SetVec<Data>::Max() const {
   if (size == 0) throw std::length_error("Empty container");
-  return (*this)[size-1];
+  return UncheckedAt(size-1);
 }
 
 template <typename Data>
@@ -339,7 +479,7 @@ const Data& SetVec<Data>::Predecessor(const Data& val) const {
   ulong index = LowerBoundIndex(val);
   
   // If index is 0 or val is not found, there's no predecessor
-  if (index == 0 || (index < size && !((*this)[index] < val) && !(val < (*this)[index]))) {
+  if (index == 0 || (index < size && !(UncheckedAt(index) < val) && !(val < UncheckedAt(index)))) {
     if (index == 0) throw std::length_error("No predecessor");
     index--;
   } else {
@@ -350,7 +490,7 @@ const Data& SetVec<Data>::Predecessor(const Data& val) const {
   // If we reach here, index should be pointing to predecessor
   if (index >= size) throw std::length_error("Predecessor not found");
   
-  return (*this)[index];
+  return UncheckedAt(index);
 }
 
 template <typename Data>
@@ -377,14 +517,14 @@ const Data& SetVec<Data>::Successor(const Data& val) const {
   ulong index = LowerBoundIndex(val);
   
   // If val exists in the set, get the next element
-  if (index < size && !((*this)[index] < val) && !(val < (*this)[index])) {
+  if (index < size && !(UncheckedAt(index) < val) && !(val < UncheckedAt(index))) {
     index++;
   }
   
   // Check if successor exists
   if (index >= size) throw std::length_error("No successor");
   
-  return (*this)[index];
+  return UncheckedAt(index);
 }
 
 template <typename Data>
@@ -405,6 +545,37 @@ void SetVec<Data>::RemoveSuccessor(const Data& val) {
   Remove(Successor(val));
 }
 
+/* ************************************************************************ */
+
+// Occupazione di memoria
+
+template <typename Data>
+MemStats SetVec<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this); // vec compreso
+  mem.slack = (vec.Size() - size) * sizeof(Data);
+  mem.allocations = vec.MemoryUsage().allocations;
+  return mem;
+}
+
+/* ************************************************************************ */
+
+// Contatori delle operazioni
+
+template <typename Data>
+OpStats SetVec<Data>::Stats() const noexcept {
+  OpStats sts = StatsPolicy::Stats();
+  sts += vec.Stats();
+  return sts;
+}
+
+template <typename Data>
+void SetVec<Data>::ResetStats() noexcept {
+  StatsPolicy::ResetStats();
+  vec.ResetStats();
+}
+
 } // namespace lasd
 
 #endif // SETVEC_CPP
\ No newline at end of file
@@ -20,6 +20,14 @@
 */
 
 /* ************************************************************************** */
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <utility>
+
+#include <string>
+
 #include "../set.hpp"
 #include "../../vector/vector.hpp"
 
@@ -31,7 +39,8 @@ namespace lasd {
 
 template <typename Data>
 class SetVec : public virtual Set<Data>,
-               public virtual ResizableContainer {
+               public virtual ResizableContainer,
+               public StatsPolicy {
 protected:
   using Container::size;
 
@@ -111,6 +120,73 @@ public:
   const Data& operator[](ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
   Data& operator[](ulong); // Non-const version for internal use
 
+  // Lettura non controllata della posizione logica index (index < Size() a
+  // carico del chiamante): niente controllo dei limiti e niente modulo
+  inline const Data& UncheckedAt(ulong index) const noexcept { return vec.UncheckedAt(Slot(index)); }
+
+  // Gli elementi in ordine come (al più) due tratti contigui del buffer circolare
+  std::pair<std::span<const Data>, std::span<const Data>> Spans() const noexcept;
+
+  /* ************************************************************************ */
+
+  // Iteratore STL ad accesso casuale, in sola lettura, sul buffer circolare:
+  // la posizione logica pos corrisponde a buf[(head + pos) mod cap]
+  class ConstIterator {
+
+    friend class SetVec;
+
+    const Data* buf = nullptr;
+    ulong cap = 0;
+    ulong head = 0;
+    std::ptrdiff_t pos = 0;
+
+    ConstIterator(const Data* b, ulong c, ulong h, std::ptrdiff_t p) noexcept : buf(b), cap(c), head(h), pos(p) {}
+
+  public:
+
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = Data;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Data*;
+    using reference = const Data&;
+
+    ConstIterator() = default;
+
+    // Con head < cap e pos <= cap basta una sottrazione al posto del modulo
+    reference operator*() const noexcept {
+      ulong idx = head + pos;
+      return buf[(idx < cap) ? idx : (idx - cap)];
+    }
+    pointer operator->() const noexcept { return &**this; }
+    reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+    ConstIterator& operator++() noexcept { ++pos; return *this; }
+    ConstIterator operator++(int) noexcept { ConstIterator tmp(*this); ++pos; return tmp; }
+    ConstIterator& operator--() noexcept { --pos; return *this; }
+    ConstIterator operator--(int) noexcept { ConstIterator tmp(*this); --pos; return tmp; }
+
+    ConstIterator& operator+=(difference_type n) noexcept { pos += n; return *this; }
+    ConstIterator& operator-=(difference_type n) noexcept { pos -= n; return *this; }
+
+    friend ConstIterator operator+(ConstIterator it, difference_type n) noexcept { return it += n; }
+    friend ConstIterator operator+(difference_type n, ConstIterator it) noexcept { return it += n; }
+    friend ConstIterator operator-(ConstIterator it, difference_type n) noexcept { return it -= n; }
+    friend difference_type operator-(const ConstIterator& a, const ConstIterator& b) noexcept { return a.pos - b.pos; }
+
+    friend bool operator==(const ConstIterator& a, const ConstIterator& b) noexcept { return a.pos == b.pos; }
+    friend std::strong_ordering operator<=>(const ConstIterator& a, const ConstIterator& b) noexcept { return a.pos <=> b.pos; }
+
+  };
+
+  using iterator = ConstIterator;
+  using const_iterator = ConstIterator;
+
+  inline const_iterator begin() const noexcept { return ConstIterator(vec.begin(), vec.Size(), head, 0); }
+  inline const_iterator end() const noexcept { return ConstIterator(vec.begin(), vec.Size(), head, size); }
+  inline const_iterator cbegin() const noexcept { return begin(); }
+  inline const_iterator cend() const noexcept { return end(); }
+
   /* ************************************************************************** */
 
   // Specific member function (inherited from TestableContainer)
@@ -119,6 +195,15 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member functions (inherited from PreOrderTraversableContainer and PostOrderTraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+
+  void PreOrderTraverse(TraverseFun) const override; // Sui due tratti contigui (Spans), senza operator[]
+  void PostOrderTraverse(TraverseFun) const override;
+
+  /* ************************************************************************ */
+
   // Specific member function (inherited from ClearableContainer)
 
   void Clear() override; // Override ClearableContainer member
@@ -126,6 +211,47 @@ public:
   // Specific member function (inherited from ResizableContainer)
     void Resize(ulong) override ; // Resize the vector to a new capacity
 
+  // Specific member function (inherited from Container)
+  MemStats MemoryUsage() const noexcept override; // Le posizioni libere del buffer circolare sono slack
+
+  /* ************************************************************************ */
+
+  // Serializzazione binaria (formato in serial/serial.hpp): gli elementi sono
+  // scritti in ordine crescente, quindi il file si può anche mappare in memoria
+  // (MappedSetVec). Load accetta ogni file con chiavi strettamente crescenti
+  // e lascia il set invariato in caso di errore (std::runtime_error).
+
+  void Save(const std::string&) const;
+  void Load(const std::string&);
+
+  /* ************************************************************************ */
+
+  // Costruzione in streaming (sorgenti in stream/stream.hpp): i record sono
+  // letti in un vettore, ordinati una volta sola e privati dei duplicati,
+  // invece di un inserimento ordinato per record. Sostituisce il contenuto
+  // (invariato se la sorgente lancia un'eccezione).
+
+  template <typename Source>
+  void Build(Source&&, ulong = 0);
+
+  /* ************************************************************************ */
+
+  // Operazioni insiemistiche (merge lineare, O(n + m))
+  // Il risultato riusa il buffer di result se ha già capacità sufficiente;
+  // result può anche coincidere con uno dei due operandi.
+
+  void Union(const SetVec&, SetVec& result) const; // result = this U other
+  void Intersect(const SetVec&, SetVec& result) const; // result = this ∩ other
+  void Difference(const SetVec&, SetVec& result) const; // result = this \ other
+
+  /* ************************************************************************ */
+
+  // Contatori delle operazioni (stats/stats.hpp): quelli del set più quelli
+  // del vettore di supporto
+
+  OpStats Stats() const noexcept;
+  void ResetStats() noexcept;
+
 
 protected:
 
@@ -134,6 +260,21 @@ protected:
   //Binary search helper
   ulong LowerBoundIndex(const Data& val) const; // Find the index of a value using binary search
 
+  // Indice nel buffer della posizione logica index: con head < capacità e
+  // index < capacità basta una sottrazione al posto del modulo
+  inline ulong Slot(ulong index) const noexcept {
+    ulong idx = head + index;
+    return (idx < vec.Size()) ? idx : (idx - vec.Size());
+  }
+
+  // Versione modificabile di UncheckedAt, solo per Insert/Remove e gli
+  // algoritmi insiemistici (index < capacità): chi scrive deve mantenere l'ordine
+  inline Data& UncheckedAt(ulong index) noexcept { return vec.UncheckedAt(Slot(index)); }
+
+  // Merge ordinato con other: copia gli elementi solo in this, comuni, solo in other
+  // secondo i flag, scrivendo in result (capacità richiesta: cap)
+  void Merge(const SetVec&, SetVec&, bool, bool, bool, ulong) const;
+
 
 };
 
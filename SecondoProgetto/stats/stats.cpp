@@ -0,0 +1,44 @@
+#ifndef STATS_CPP
+#define STATS_CPP
+
+namespace lasd {
+
+/* ************************************************************************ */
+
+inline OpStats& OpStats::operator+=(const OpStats& oth) noexcept {
+  comparisons += oth.comparisons;
+  moves += oth.moves;
+  copies += oth.copies;
+  allocations += oth.allocations;
+  probes += oth.probes;
+  rotations += oth.rotations;
+  resizes += oth.resizes;
+  return *this;
+}
+
+/* ************************************************************************ */
+
+inline OpStats CountingStats::Stats() const noexcept {
+  auto get = [this](StatOp op) { return counters[static_cast<int>(op)].load(std::memory_order_relaxed); };
+  OpStats sts;
+  sts.comparisons = get(StatOp::Comparison);
+  sts.moves = get(StatOp::Move);
+  sts.copies = get(StatOp::Copy);
+  sts.allocations = get(StatOp::Allocation);
+  sts.probes = get(StatOp::Probe);
+  sts.rotations = get(StatOp::Rotation);
+  sts.resizes = get(StatOp::Resize);
+  return sts;
+}
+
+inline void CountingStats::ResetStats() noexcept {
+  for (std::atomic<ulong>& cnt : counters) {
+    cnt.store(0, std::memory_order_relaxed);
+  }
+}
+
+/* ************************************************************************ */
+
+}
+
+#endif
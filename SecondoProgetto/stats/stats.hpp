@@ -0,0 +1,95 @@
+#ifndef STATS_HPP
+#define STATS_HPP
+
+/* ************************************************************************** */
+/*
+  stats.hpp - Contatori delle operazioni dei contenitori
+
+  Strumentazione attivabile in compilazione per capire quanto lavoro fa un
+  contenitore: confronti, spostamenti e copie di elementi, allocazioni,
+  passi di scansione, rotazioni e ridimensionamenti.
+    - Con LASD_STATS definita (make stats=1) i contenitori strumentati
+      derivano da CountingStats, che accumula i contatori; Stats()
+      restituisce una fotografia dei valori e ResetStats() li azzera.
+    - Senza LASD_STATS derivano da NoStats, una classe vuota: CountOp() non fa
+      nulla, Stats() restituisce sempre zero e il costo è nullo.
+  La macro va definita (o no) allo stesso modo in tutte le unità di
+  traduzione del programma.
+
+  I contatori appartengono all'oggetto: una copia parte da zero e un
+  assegnamento non li cambia. Sono atomici (rilassati), così anche le
+  funzioni const usate da più thread possono contare.
+*/
+/* ************************************************************************** */
+
+#include <atomic>
+
+#include "../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+struct OpStats {
+  ulong comparisons = 0; // Confronti tra elementi
+  ulong moves = 0;       // Spostamenti di elementi (uno scambio ne vale tre)
+  ulong copies = 0;      // Copie di elementi
+  ulong allocations = 0; // Allocazioni di buffer
+  ulong probes = 0;      // Passi di scansione
+  ulong rotations = 0;   // Rotazioni (alberi bilanciati)
+  ulong resizes = 0;     // Ridimensionamenti
+
+  OpStats& operator+=(const OpStats&) noexcept;
+  bool operator==(const OpStats&) const noexcept = default;
+};
+
+enum class StatOp { Comparison, Move, Copy, Allocation, Probe, Rotation, Resize };
+
+/* ************************************************************************** */
+
+class CountingStats {
+private:
+  mutable std::atomic<ulong> counters[7] = {};
+
+public:
+  static constexpr bool Enabled = true;
+
+  CountingStats() = default;
+  CountingStats(const CountingStats&) noexcept {}
+  CountingStats& operator=(const CountingStats&) noexcept { return *this; }
+
+  OpStats Stats() const noexcept;
+  void ResetStats() noexcept;
+
+protected:
+  inline void CountOp(StatOp op, ulong num = 1) const noexcept {
+    counters[static_cast<int>(op)].fetch_add(num, std::memory_order_relaxed);
+  }
+};
+
+class NoStats {
+public:
+  static constexpr bool Enabled = false;
+
+  inline OpStats Stats() const noexcept { return OpStats(); }
+  inline void ResetStats() noexcept {}
+
+protected:
+  inline void CountOp(StatOp, ulong = 1) const noexcept {}
+};
+
+#ifdef LASD_STATS
+using StatsPolicy = CountingStats;
+#else
+using StatsPolicy = NoStats;
+#endif
+
+/* ************************************************************************** */
+
+}
+
+#include "stats.cpp"
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef STREAM_HPP
+#define STREAM_HPP
+
+/* ************************************************************************** */
+/*
+  stream.hpp - Sorgenti di record per la costruzione in streaming
+
+  Una sorgente è un oggetto chiamabile bool src(Data&): scrive il record
+  successivo e restituisce false alla fine. Un generatore qualsiasi (una
+  lambda) è già una sorgente; quelle definite qui leggono da uno std::istream
+  a blocchi (chunk), senza contenitori intermedi:
+    - TextSource: numeri separati da spazi, convertiti con std::from_chars
+      (niente locale, niente allocazioni per record);
+    - BinarySource: record grezzi di sizeof(Data) byte.
+  Una sorgente può offrire SizeHint() (numero di record previsto, 0 se non
+  noto): i metodi Build dei contenitori lo usano per riservare lo spazio una
+  volta sola.
+
+  Un testo non valido lancia std::invalid_argument, un file binario che
+  termina a metà di un record lancia std::runtime_error.
+*/
+/* ************************************************************************** */
+
+#include <istream>
+#include <memory>
+#include <type_traits>
+
+#include "../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Record previsti da una sorgente (0 se non offre SizeHint)
+template <typename Source>
+ulong SizeHintOf(const Source &) noexcept;
+
+/* ************************************************************************** */
+
+template <typename Data>
+class TextSource {
+
+  static_assert(std::is_arithmetic_v<Data> && !std::is_same_v<Data, bool>, "TextSource parses numbers only");
+
+protected:
+
+  std::istream& in;
+  ulong chunk;
+  std::unique_ptr<char[]> buf; // chunk byte, più il resto di un numero spezzato tra due blocchi
+  ulong pos = 0;               // Prossimo carattere da leggere
+  ulong len = 0;               // Caratteri validi nel buffer
+  bool eof = false;
+
+public:
+
+  explicit TextSource(std::istream &, ulong = 1 << 16);
+
+  bool operator()(Data &); // std::invalid_argument se un elemento non è un numero
+
+  inline ulong SizeHint() const noexcept { return 0; } // (non noto senza leggere il testo)
+
+protected:
+
+  bool Refill(); // Sposta in testa il resto del blocco e legge il successivo (false se il flusso è finito)
+
+};
+
+/* ************************************************************************** */
+
+template <typename Data>
+class BinarySource {
+
+  static_assert(std::is_trivially_copyable_v<Data>, "BinarySource needs a trivially copyable Data");
+
+protected:
+
+  std::istream& in;
+  ulong chunk;
+  std::unique_ptr<Data[]> buf;
+  ulong pos = 0; // Prossimo record da restituire
+  ulong num = 0; // Record validi nel buffer
+  ulong hint = 0;
+
+public:
+
+  explicit BinarySource(std::istream &, ulong = 1 << 14); // (chunk in record)
+
+  bool operator()(Data &); // std::runtime_error se il flusso termina a metà di un record
+
+  inline ulong SizeHint() const noexcept { return hint; } // Record rimasti nel flusso, se posizionabile
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "stream.cpp"
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef MAPPEDVECTOR_CPP
+#define MAPPEDVECTOR_CPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************ */
+
+// Costruttore da file
+template <typename Data>
+MappedVector<Data>::MappedVector(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot open " + path);
+  }
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || static_cast<ulong>(st.st_size) < sizeof(BinaryHeader)) {
+    ::close(fd);
+    throw std::runtime_error("Truncated binary file " + path);
+  }
+  length = st.st_size;
+  base = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // La mappatura resta valida anche dopo la chiusura
+  if (base == MAP_FAILED) {
+    base = nullptr;
+    throw std::runtime_error("Cannot map " + path);
+  }
+
+  const BinaryHeader* hdr = static_cast<const BinaryHeader*>(base);
+  try {
+    CheckHeader<Data>(*hdr, length, path);
+  } catch (...) {
+    Unmap();
+    throw;
+  }
+  size = hdr->count;
+  tag = static_cast<char>(hdr->tag);
+  Elements = reinterpret_cast<const Data*>(static_cast<const char*>(base) + sizeof(BinaryHeader));
+}
+
+// Move constructor
+template <typename Data>
+MappedVector<Data>::MappedVector(MappedVector<Data>&& other) noexcept {
+  std::swap(base, other.base);
+  std::swap(length, other.length);
+  std::swap(Elements, other.Elements);
+  std::swap(size, other.size);
+  std::swap(tag, other.tag);
+}
+
+// Destructor
+template <typename Data>
+MappedVector<Data>::~MappedVector() {
+  Unmap();
+}
+
+// Move assignment
+template <typename Data>
+MappedVector<Data>& MappedVector<Data>::operator=(MappedVector<Data>&& other) noexcept {
+  std::swap(base, other.base);
+  std::swap(length, other.length);
+  std::swap(Elements, other.Elements);
+  std::swap(size, other.size);
+  std::swap(tag, other.tag);
+  return *this;
+}
+
+/* ************************************************************************ */
+
+// Accesso agli elementi
+template <typename Data>
+const Data& MappedVector<Data>::operator[](ulong index) const {
+  if (index >= size) {
+    throw std::out_of_range("Access at index " + std::to_string(index) + "; mapped vector size " + std::to_string(size) + ".");
+  }
+  return Elements[index];
+}
+
+// Visite direttamente sul file mappato (senza i controlli di operator[])
+template <typename Data>
+void MappedVector<Data>::Traverse(TraverseFun fun) const {
+  PreOrderTraverse(fun);
+}
+
+template <typename Data>
+void MappedVector<Data>::PreOrderTraverse(TraverseFun fun) const {
+  for (const Data* cur = Elements; cur != Elements + size; ++cur) {
+    fun(*cur);
+  }
+}
+
+template <typename Data>
+void MappedVector<Data>::PostOrderTraverse(TraverseFun fun) const {
+  for (const Data* cur = Elements + size; cur != Elements; ) {
+    fun(*--cur);
+  }
+}
+
+/* ************************************************************************ */
+
+template <typename Data>
+MemStats MappedVector<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this);
+  if (base != nullptr) {
+    ulong page = ::sysconf(_SC_PAGESIZE);
+    mem.overhead += sizeof(BinaryHeader);
+    mem.slack = (length + page - 1) / page * page - length;
+    mem.allocations = 1;
+  }
+  return mem;
+}
+
+/* ************************************************************************ */
+
+template <typename Data>
+void MappedVector<Data>::Unmap() noexcept {
+  if (base != nullptr) {
+    ::munmap(base, length);
+  }
+  base = nullptr;
+  length = 0;
+  Elements = nullptr;
+  size = 0;
+  tag = 0;
+}
+
+/* ************************************************************************ */
+
+}
+
+#endif
@@ -0,0 +1,138 @@
+#ifndef MAPPEDVECTOR_HPP
+#define MAPPEDVECTOR_HPP
+
+/* ************************************************************************** */
+/*
+  mappedvector.hpp - Definizione della classe MappedVector
+
+  Vista in sola lettura su un file scritto da Vector/SetVec/HeapVec::Save
+  (formato in serial/serial.hpp), mappato in memoria con mmap: gli elementi
+  non sono copiati, le pagine del file sono caricate solo quando si leggono.
+  Apertura e chiusura costano O(1) qualunque sia la dimensione del file.
+
+  Solo per tipi banalmente copiabili (le stringhe hanno lunghezza variabile e
+  vanno lette con Load). Il file non deve essere modificato finché la vista
+  è aperta. Una vista si può spostare ma non copiare.
+*/
+/* ************************************************************************** */
+
+#include <span>
+#include <string>
+#include <type_traits>
+
+#include "../../container/linear.hpp"
+#include "../../serial/serial.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+class MappedVector : virtual public LinearContainer<Data> {
+
+  static_assert(std::is_trivially_copyable_v<Data>, "MappedVector needs a trivially copyable Data");
+  static_assert(alignof(Data) <= sizeof(BinaryHeader), "MappedVector: the payload is aligned to the header size only");
+
+protected:
+  using Container::size;
+
+  void* base = nullptr;       // Inizio della mappatura (intestazione compresa)
+  ulong length = 0;           // Byte mappati
+  const Data* Elements = nullptr;
+  char tag = 0;               // Contenitore che ha scritto il file
+
+public:
+
+  // Default constructor
+  MappedVector() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructor
+  explicit MappedVector(const std::string &); // std::runtime_error se il file non è valido
+
+  /* ************************************************************************ */
+
+  MappedVector(const MappedVector &) = delete; // Copy constructor
+
+  MappedVector(MappedVector &&) noexcept; // Move constructor
+
+  virtual ~MappedVector(); // Destructor (chiude la mappatura)
+
+  /* ************************************************************************ */
+
+  MappedVector & operator=(const MappedVector &) = delete; // Copy assignment
+
+  MappedVector & operator=(MappedVector &&) noexcept; // Move assignment
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  using LinearContainer<Data>::operator==;
+  using LinearContainer<Data>::operator!=;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline char Tag() const noexcept { return tag; } // 'V', 'S' o 'H'
+
+  // Iteratori STL (contigui, in sola lettura)
+  using iterator = const Data*;
+  using const_iterator = const Data*;
+
+  inline const_iterator begin() const noexcept { return Elements; }
+  inline const_iterator end() const noexcept { return Elements + size; }
+  inline const_iterator cbegin() const noexcept { return Elements; }
+  inline const_iterator cend() const noexcept { return Elements + size; }
+
+  // Accesso non controllato (index < Size() a carico del chiamante), puntatore
+  // agli elementi e vista come span
+  inline const Data& UncheckedAt(ulong index) const noexcept { return Elements[index]; }
+  inline const Data* data() const noexcept { return Elements; }
+  inline std::span<const Data> Span() const noexcept { return std::span<const Data>(Elements, size); }
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data & operator[](ulong) const override; // std::out_of_range se fuori dai limiti
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+
+  void Traverse(TraverseFun) const override;
+  void PreOrderTraverse(TraverseFun) const override;
+  void PostOrderTraverse(TraverseFun) const override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from Container)
+
+  // La mappatura conta come un'allocazione; il resto dell'ultima pagina è slack
+  MemStats MemoryUsage() const noexcept override;
+
+protected:
+
+  // Specific member function (inherited from LinearContainer)
+
+  inline const Data* Contiguous() const noexcept override { return Elements; }
+
+  // Auxiliary functions
+
+  void Unmap() noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "mappedvector.cpp"
+
+#endif
@@ -46,6 +46,8 @@ Vector<Data>::Vector(MappableContainer<Data> &&con) : Vector(con.Size()) {
     size = vec.size;
     Elements = new Data[size];
     std::copy(vec.Elements, vec.Elements + size, Elements);
+    CountOp(StatOp::Allocation);
+    CountOp(StatOp::Copy, size);
   }
 
   // Move constructor (Vector)
@@ -76,6 +78,8 @@ Vector<Data>::Vector(MappableContainer<Data> &&con) : Vector(con.Size()) {
     Vector<Data> *tmpvec = new Vector<Data>(vec);
     std::swap(*tmpvec, *this);
     delete tmpvec;
+    CountOp(StatOp::Allocation);
+    CountOp(StatOp::Copy, size);
     return *this;
   }
 
@@ -125,27 +129,21 @@ Vector<Data>::Vector(MappableContainer<Data> &&con) : Vector(con.Size()) {
   template <typename Data>
   const Data &Vector<Data>::operator[](const ulong index) const
   {
-    if (index < size)
+    if (index >= size) [[unlikely]]
     {
-      return Elements[index];
-    }
-    else
-    {
-      throw std::out_of_range("Access at index " + std::to_string(index) + "; vector size " + std::to_string(size) + ".");
+      OutOfRange(index, size);
     }
+    return Elements[index];
   }
 
   template <typename Data>
   Data &Vector<Data>::operator[](const ulong index)
   {
-    if (index < size)
-    {
-      return Elements[index];
-    }
-    else
+    if (index >= size) [[unlikely]]
     {
-      throw std::out_of_range("Access at index " + std::to_string(index) + "; vector size " + std::to_string(size) + ".");
+      OutOfRange(index, size);
     }
+    return Elements[index];
   }
 
   template <typename Data>
@@ -202,8 +200,72 @@ Vector<Data>::Vector(MappableContainer<Data> &&con) : Vector(con.Size()) {
 
   /* ************************************************************************** */
 
+  // Binary serialization (Vector)
+
+  template <typename Data>
+  void Vector<Data>::Save(const std::string &path) const
+  {
+    SaveBinary<Data>(path, 'V', Elements, size);
+  }
+
+  template <typename Data>
+  void Vector<Data>::Load(const std::string &path)
+  {
+    // The new elements are left uninitialized: the read overwrites all of them
+    Vector<Data> tmp;
+    LoadBinary<Data>(path,
+        [&tmp](ulong num)
+        {
+          if (num != 0)
+          {
+            tmp.Elements = new Data[num];
+            tmp.size = num;
+          }
+          return tmp.Elements;
+        });
+    std::swap(size, tmp.size);
+    std::swap(Elements, tmp.Elements);
+  }
+
+  /* ************************************************************************** */
+
   // Specific member functions (Vector) (inherited from ResizableContainer)
 
+  template <typename Data>
+  template <typename Source>
+  void Vector<Data>::Build(Source &&src, ulong hint)
+  {
+    // The records are read in place; the array doubles only when the hint was too small
+    ulong cap = (hint < SizeHintOf(src)) ? SizeHintOf(src) : hint;
+    Vector<Data> tmp((cap != 0) ? cap : 16);
+    ulong num = 0;
+    while (true)
+    {
+      if (num < tmp.size)
+      {
+        if (!src(tmp.Elements[num]))
+        {
+          break;
+        }
+      }
+      else
+      {
+        // Grow only for a record that exists (an exact hint never doubles)
+        Data dat;
+        if (!src(dat))
+        {
+          break;
+        }
+        tmp.Resize(2 * tmp.size);
+        tmp.Elements[num] = std::move(dat);
+      }
+      ++num;
+    }
+    tmp.Resize(num);
+    std::swap(size, tmp.size);
+    std::swap(Elements, tmp.Elements);
+  }
+
   template <typename Data>
   void Vector<Data>::Resize(const ulong newsize)
   {
@@ -222,6 +284,9 @@ Vector<Data>::Vector(MappableContainer<Data> &&con) : Vector(con.Size()) {
       std::swap(Elements, TmpElements);
       size = newsize;
       delete[] TmpElements;
+      CountOp(StatOp::Resize);
+      CountOp(StatOp::Allocation);
+      CountOp(StatOp::Move, 3 * minsize);
     }
   }
 
@@ -239,6 +304,30 @@ Vector<Data>::Vector(MappableContainer<Data> &&con) : Vector(con.Size()) {
 
   /* ************************************************************************** */
 
+  // Specific member function (Vector) (inherited from Container)
+
+  template <typename Data>
+  MemStats Vector<Data>::MemoryUsage() const noexcept
+  {
+    MemStats mem;
+    mem.payload = size * sizeof(Data);
+    mem.overhead = sizeof(*this);
+    mem.allocations = (Elements != nullptr) ? 1 : 0;
+    return mem;
+  }
+
+  /* ************************************************************************** */
+
+  // Auxiliary member function (Vector)
+
+  template <typename Data>
+  void Vector<Data>::OutOfRange(const ulong index, const ulong num)
+  {
+    throw std::out_of_range("Access at index " + std::to_string(index) + "; vector size " + std::to_string(num) + ".");
+  }
+
+  /* ************************************************************************** */
+
   // Specific constructors (SortableVector)
 
   template <typename Data>
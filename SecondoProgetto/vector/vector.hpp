@@ -4,8 +4,14 @@
 
 /* ************************************************************************** */
 
+#include <span>
+#include <string>
+
 #include "../container/container.hpp"
 #include "../container/linear.hpp"
+#include "../serial/serial.hpp"
+#include "../stream/stream.hpp"
+#include "../stats/stats.hpp"
 
 /* ************************************************************************** */
 
@@ -15,7 +21,7 @@ namespace lasd
   /* ************************************************************************** */
 
   template <typename Data>
-  class Vector : virtual public ResizableContainer, virtual public MutableLinearContainer<Data>
+  class Vector : virtual public ResizableContainer, virtual public MutableLinearContainer<Data>, public StatsPolicy
   {
 
   protected:
@@ -80,6 +86,51 @@ namespace lasd
 
     /* ************************************************************************ */
 
+    // STL iterators (plain pointers to the elements: contiguous, unchecked)
+
+    using iterator = Data *;
+    using const_iterator = const Data *;
+
+    inline iterator begin() noexcept { return Elements; }
+    inline iterator end() noexcept { return Elements + size; }
+    inline const_iterator begin() const noexcept { return Elements; }
+    inline const_iterator end() const noexcept { return Elements + size; }
+    inline const_iterator cbegin() const noexcept { return Elements; }
+    inline const_iterator cend() const noexcept { return Elements + size; }
+
+    /* ************************************************************************ */
+
+    // Unchecked access (non-virtual, no bounds check: the caller guarantees
+    // index < Size()), raw pointer to the elements and span views
+
+    inline Data &UncheckedAt(const ulong index) noexcept { return Elements[index]; }
+    inline const Data &UncheckedAt(const ulong index) const noexcept { return Elements[index]; }
+
+    inline Data *data() noexcept { return Elements; }
+    inline const Data *data() const noexcept { return Elements; }
+
+    inline std::span<Data> Span() noexcept { return std::span<Data>(Elements, size); }
+    inline std::span<const Data> Span() const noexcept { return std::span<const Data>(Elements, size); }
+
+    /* ************************************************************************ */
+
+    // Binary serialization (format in serial/serial.hpp)
+
+    void Save(const std::string &) const; // (must throw std::runtime_error on failure)
+    void Load(const std::string &);       // (must throw std::runtime_error on failure, leaving the vector unchanged)
+
+    /* ************************************************************************ */
+
+    // Streaming construction (sources in stream/stream.hpp)
+
+    // Replaces the elements with the records of the source, reserving the
+    // larger of the given hint and the source SizeHint (the vector is left
+    // unchanged if the source throws)
+    template <typename Source>
+    void Build(Source &&, ulong = 0);
+
+    /* ************************************************************************ */
+
     // Specific member function (inherited from ResizableContainer)
 
     void Resize(const ulong) override;
@@ -89,6 +140,25 @@ namespace lasd
     // Specific member function (inherited from ClearableContainer)
 
     void Clear() override;
+
+    /* ************************************************************************ */
+
+    // Specific member function (inherited from Container)
+
+    MemStats MemoryUsage() const noexcept override;
+
+  protected:
+    // Specific member function (inherited from LinearContainer)
+
+    inline const Data *Contiguous() const noexcept override { return Elements; }
+
+    // Specific member function (inherited from MutableLinearContainer)
+
+    inline Data *MutableContiguous() noexcept override { return Elements; }
+
+    // Auxiliary member function (out of line: keeps operator[] small enough to inline)
+
+    [[noreturn]] static void OutOfRange(const ulong, const ulong);
   };
 
   /* ************************************************************************** */
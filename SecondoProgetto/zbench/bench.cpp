@@ -0,0 +1,55 @@
+#include "ops/ops.hpp"
+#include "set/frozenSet.hpp"
+#include "set/setBTree.hpp"
+#include "ranges/ranges.hpp"
+#include "serial/serial.hpp"
+#include "stream/stream.hpp"
+#include "stats/stats.hpp"
+#include "memory/memory.hpp"
+#include "flat/flat.hpp"
+
+#include <iostream>
+
+// Uso: ./bench [--json FILE] [--reps N] [--warmup N] [--filter TESTO] [--counters on|off]
+int main(int argc, char* argv[]) {
+  if (!ParseBenchArgs(argc, argv)) {
+    return 1;
+  }
+  std::cout << "LASD Libraries 2025 (Benchmarks)" << std::endl;
+
+  if (Suite("Ops")) {
+    BenchOps();
+  }
+
+  if (Suite("Set")) {
+    BenchFrozenSet();
+    BenchSetBTree();
+  }
+
+  if (Suite("Ranges")) {
+    BenchRanges();
+  }
+
+  if (Suite("Serialization")) {
+    BenchSerial();
+  }
+
+  if (Suite("Streaming")) {
+    BenchStream();
+  }
+
+  if (Suite("Stats")) {
+    BenchStats(5000);
+  }
+
+  if (Suite("Memory")) {
+    BenchMemory();
+  }
+
+  if (Suite("Flat")) {
+    BenchFlat();
+  }
+
+  WriteResults();
+  return 0;
+}
@@ -0,0 +1,155 @@
+#ifndef BENCH_FLAT_HPP
+#define BENCH_FLAT_HPP
+
+#include <string>
+#include "../util/bench_utils.hpp"
+#include "../ops/ops.hpp"
+
+#include "../../flat/vector/flatvector.hpp"
+#include "../../flat/list/flatlist.hpp"
+#include "../../flat/set/flatsetvec.hpp"
+#include "../../flat/heap/flatheapvec.hpp"
+#include "../../flat/pq/flatpqheap.hpp"
+#include "../../flat/adapter.hpp"
+
+using namespace lasd;
+
+// Stesse operazioni, con gli stessi algoritmi (salvo dove indicato), sui
+// contenitori della libreria chiamati tramite le loro interfacce
+// (LinearContainer, TestableContainer, Set, PQ: chiamate virtuali, size
+// tramite la base virtuale, visite con std::function) e sui contenitori flat
+// (vedi flat/flat.hpp): la differenza è il costo della dispatch dinamica.
+// L'ultima riga misura l'adattatore, che riporta un contenitore flat alle
+// interfacce polimorfe.
+
+inline unsigned long FlatWeight(const int& val) { return static_cast<unsigned long>(val); }
+inline unsigned long FlatWeight(const std::string& val) { return val.size(); }
+
+template <typename T>
+void BenchFlatType(const std::string& type, unsigned long num, const OpsKeys<T>& keys) {
+  const unsigned long passes = 20;
+  std::cout << "  Data = " << type << std::endl;
+
+  // Accesso per indice con il controllo dei limiti
+  Vector<T> vec(keys.present);
+  FlatVector<T> fvec(keys.present);
+  const LinearContainer<T>& lin = vec;
+  Report("Vector operator[] (LinearContainer&)", num, MeasureNs(passes * num, [&]() {
+    unsigned long sum = 0;
+    for (unsigned long p = 0; p < passes; ++p) {
+      for (unsigned long i = 0; i < lin.Size(); ++i) sum += FlatWeight(lin[i]);
+    }
+    DoNotOptimize(sum);
+  }));
+  Report("FlatVector operator[]", num, MeasureNs(passes * num, [&]() {
+    unsigned long sum = 0;
+    for (unsigned long p = 0; p < passes; ++p) {
+      for (unsigned long i = 0; i < fvec.Size(); ++i) sum += FlatWeight(fvec[i]);
+    }
+    DoNotOptimize(sum);
+  }));
+
+  // Visita: std::function contro una lambda espansa inline
+  Report("Vector Fold", num, MeasureNs(passes * num, [&]() {
+    unsigned long sum = 0;
+    for (unsigned long p = 0; p < passes; ++p) {
+      sum += vec.template Fold<unsigned long>([](const T& val, const unsigned long& acc) { return acc + FlatWeight(val); }, 0);
+    }
+    DoNotOptimize(sum);
+  }));
+  Report("FlatVector Fold", num, MeasureNs(passes * num, [&]() {
+    unsigned long sum = 0;
+    for (unsigned long p = 0; p < passes; ++p) {
+      sum += fvec.template Fold<unsigned long>([](const T& val, unsigned long acc) { return acc + FlatWeight(val); }, 0ul);
+    }
+    DoNotOptimize(sum);
+  }));
+
+  // Ricerca lineare (chiavi assenti: lista intera)
+  List<T> lst(keys.present);
+  FlatList<T> flst(keys.present);
+  const TestableContainer<T>& tst = lst;
+  unsigned long few = 50;
+  Report("List Exists (TestableContainer&)", num, MeasureNs(few * num, [&]() {
+    unsigned long cnt = 0;
+    for (unsigned long i = 0; i < few; ++i) cnt += tst.Exists(keys.absent[i]);
+    DoNotOptimize(cnt);
+  }));
+  Report("FlatList Exists", num, MeasureNs(few * num, [&]() {
+    unsigned long cnt = 0;
+    for (unsigned long i = 0; i < few; ++i) cnt += flst.Exists(keys.absent[i]);
+    DoNotOptimize(cnt);
+  }));
+
+  // Set ordinato: ricerche e poi inserimenti e rimozioni (questi ultimi non
+  // misurano solo la dispatch: FlatSetVec sposta la parte più corta della
+  // finestra, SetVec scorre il buffer circolare)
+  SetVec<T> set(keys.sorted);
+  FlatSetVec<T> fset(keys.sorted);
+  Set<T>& iset = set;
+  Report("SetVec Exists (Set&)", num, MeasureNs(num, [&]() {
+    unsigned long cnt = 0;
+    for (unsigned long i = 0; i < num; ++i) cnt += iset.Exists(keys.probe[i]);
+    DoNotOptimize(cnt);
+  }));
+  Report("FlatSetVec Exists", num, MeasureNs(num, [&]() {
+    unsigned long cnt = 0;
+    for (unsigned long i = 0; i < num; ++i) cnt += fset.Exists(keys.probe[i]);
+    DoNotOptimize(cnt);
+  }));
+  unsigned long upd = std::min(num, 2000ul);
+  Report("SetVec Insert + Remove (Set&)", num, MeasureNs(2 * upd, [&]() {
+    for (unsigned long i = 0; i < upd; ++i) iset.Insert(keys.absent[i]);
+    for (unsigned long i = 0; i < upd; ++i) iset.Remove(keys.absent[i]);
+    DoNotOptimize(iset.Size());
+  }));
+  Report("FlatSetVec Insert + Remove", num, MeasureNs(2 * upd, [&]() {
+    for (unsigned long i = 0; i < upd; ++i) fset.Insert(keys.absent[i]);
+    for (unsigned long i = 0; i < upd; ++i) fset.Remove(keys.absent[i]);
+    DoNotOptimize(fset.Size());
+  }));
+
+  // Heap: HeapSort sullo stesso array
+  HeapVec<T> heap(keys.present);
+  FlatHeapVec<T> fheap(keys.present);
+  Report("HeapVec Sort", num, MeasureNs(num, [&]() { heap.Sort(); DoNotOptimize(heap.Front()); }));
+  Report("FlatHeapVec Sort", num, MeasureNs(num, [&]() { fheap.Sort(); DoNotOptimize(fheap.Front()); }));
+
+  // Coda con priorità: Change e Tip (senza ridimensionamenti)
+  PQHeap<T> pq(keys.present);
+  FlatPQHeap<T> fpq(keys.present);
+  PQ<T>& ipq = pq;
+  Report("PQHeap Change + Tip (PQ&)", num, MeasureNs(num, [&]() {
+    for (unsigned long i = 0; i < num; ++i) {
+      ipq.Change(keys.perm[i], keys.absent[i]);
+      DoNotOptimize(ipq.Tip());
+    }
+  }));
+  Report("FlatPQHeap Change + Tip", num, MeasureNs(num, [&]() {
+    for (unsigned long i = 0; i < num; ++i) {
+      fpq.Change(keys.perm[i], keys.absent[i]);
+      DoNotOptimize(fpq.Tip());
+    }
+  }));
+
+  // Il costo del ponte verso le interfacce: la visita torna a passare da std::function
+  LinearAdapter ad(fvec);
+  const TraversableContainer<T>& trv = ad;
+  Report("FlatVector Fold (LinearAdapter)", num, MeasureNs(passes * num, [&]() {
+    unsigned long sum = 0;
+    for (unsigned long p = 0; p < passes; ++p) {
+      sum += trv.template Fold<unsigned long>([](const T& val, const unsigned long& acc) { return acc + FlatWeight(val); }, 0);
+    }
+    DoNotOptimize(sum);
+  }));
+}
+
+inline void BenchFlat() {
+  std::cout << std::endl << "Interfacce polimorfe vs contenitori flat (CRTP/final)" << std::endl;
+  // (le liste restano entro 10^5 nodi: il distruttore di List è ricorsivo)
+  unsigned long num = 100000;
+  BenchFlatType<int>("int", num, MakeOpsKeys<int>(num, [](unsigned long i) { return static_cast<int>(i); }));
+  BenchFlatType<std::string>("string", num, MakeOpsKeys<std::string>(num, [](unsigned long i) { return "key_" + std::to_string(1000000000ul + i); }));
+}
+
+#endif
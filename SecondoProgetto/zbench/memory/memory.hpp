@@ -0,0 +1,78 @@
+#ifndef BENCH_MEMORY_HPP
+#define BENCH_MEMORY_HPP
+
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../set/lst/setlst.hpp"
+#include "../../set/btree/setbtree.hpp"
+#include "../../set/frozen/frozenset.hpp"
+#include "../../heap/vec/heapvec.hpp"
+#include "../../pq/heap/pqheap.hpp"
+
+using namespace lasd;
+
+// Occupazione di memoria (MemoryUsage) per elemento, a varie dimensioni:
+// il totale e le sue parti, più il numero di allocazioni (ognuna costa in
+// più l'intestazione di malloc, non compresa)
+
+inline void PrintMemory(const std::string& name, unsigned long num, const MemStats& mem) {
+  double div = (num != 0) ? static_cast<double>(num) : 1.0;
+  std::cout << "  " << std::left << std::setw(12) << name << " n=" << std::setw(7) << num << std::right
+            << std::fixed << std::setprecision(1)
+            << std::setw(9) << mem.Total() / div << " B/elem (payload " << std::setw(6) << mem.payload / div
+            << " overhead " << std::setw(7) << mem.overhead / div << " slack " << std::setw(6) << mem.slack / div
+            << ") allocs " << mem.allocations << std::endl;
+}
+
+template <typename Data, typename MakeKey>
+void BenchMemoryType(const std::string& type, MakeKey key) {
+  std::cout << "  Data = " << type << " (sizeof " << sizeof(Data) << ")" << std::endl;
+  for (unsigned long num : {10ul, 1000ul, 10000ul}) {
+    // Chiavi distinte in ordine sparso (num e 7919 sono primi tra loro)
+    Vector<Data> keys(num);
+    for (unsigned long i = 0; i < num; ++i) {
+      keys[i] = key((i * 7919) % num);
+    }
+    PrintMemory("Vector", num, keys.MemoryUsage());
+
+    List<Data> lst(keys);
+    PrintMemory("List", num, lst.MemoryUsage());
+
+    SetVec<Data> setvec(keys);
+    PrintMemory("SetVec", num, setvec.MemoryUsage());
+
+    SetLst<Data> setlst(setvec); // In ordine: inserimenti in coda
+    PrintMemory("SetLst", num, setlst.MemoryUsage());
+
+    SetBTree<Data> setbtr;
+    for (unsigned long i = 0; i < num; ++i) {
+      setbtr.Insert(keys[i]);
+    }
+    PrintMemory("SetBTree", num, setbtr.MemoryUsage());
+
+    FrozenSet<Data> frz(setvec);
+    PrintMemory("FrozenSet", num, frz.MemoryUsage());
+
+    HeapVec<Data> heap(keys);
+    PrintMemory("HeapVec", num, heap.MemoryUsage());
+
+    PQHeap<Data> pq;
+    for (unsigned long i = 0; i < num; ++i) {
+      pq.Insert(keys[i]);
+    }
+    PrintMemory("PQHeap", num, pq.MemoryUsage());
+  }
+}
+
+inline void BenchMemory() {
+  BenchMemoryType<int>("int", [](unsigned long i) { return static_cast<int>(i); });
+  BenchMemoryType<std::string>("string", [](unsigned long i) { return "key_" + std::to_string(1000000000ul + i); });
+}
+
+#endif
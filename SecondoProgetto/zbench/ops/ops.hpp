@@ -0,0 +1,130 @@
+#ifndef BENCH_OPS_HPP
+#define BENCH_OPS_HPP
+
+#include <string>
+#include <random>
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../set/lst/setlst.hpp"
+#include "../../heap/vec/heapvec.hpp"
+#include "../../pq/heap/pqheap.hpp"
+
+using namespace lasd;
+
+// Microbenchmark di ogni operazione dei contenitori, per dimensione e tipo.
+// Le operazioni lineari nella dimensione (inserimenti e rimozioni nei
+// contenitori ordinati, accesso per indice alla lista, inserimenti in PQHeap)
+// si misurano su meno ripetizioni della dimensione, perché una ripetizione
+// resti breve.
+
+// Chiavi per un benchmark: pari presenti, dispari assenti, in ordine casuale
+template <typename T>
+struct OpsKeys {
+  Vector<T> sorted;   // Chiavi pari, in ordine crescente
+  Vector<T> present;  // Le stesse, in ordine casuale
+  Vector<T> absent;   // Chiavi dispari, in ordine casuale
+  Vector<T> probe;    // Metà presenti e metà assenti, alternate
+  Vector<unsigned long> perm; // Permutazione casuale di [0, num)
+};
+
+template <typename T, typename MakeKey>
+OpsKeys<T> MakeOpsKeys(unsigned long num, MakeKey key) {
+  OpsKeys<T> keys{Vector<T>(num), Vector<T>(num), Vector<T>(num), Vector<T>(num), Vector<unsigned long>(num)};
+  for (unsigned long i = 0; i < num; ++i) {
+    keys.perm[i] = i;
+  }
+  std::mt19937_64 gen(num);
+  for (unsigned long i = num; i > 1; --i) {
+    std::swap(keys.perm[i - 1], keys.perm[gen() % i]);
+  }
+  for (unsigned long i = 0; i < num; ++i) {
+    keys.sorted[i] = key(2 * i);
+    keys.present[i] = key(2 * keys.perm[i]);
+    keys.absent[i] = key(2 * keys.perm[i] + 1);
+    keys.probe[i] = (i % 2 == 0) ? keys.present[i] : keys.absent[i];
+  }
+  return keys;
+}
+
+template <typename T>
+void BenchOpsLinear(const std::string& type, unsigned long num, const OpsKeys<T>& keys) {
+  unsigned long few = std::min(num, 200ul);
+
+  Vector<T> vec(keys.sorted);
+  Bench("Vector operator[] (random)", type, num, num, [] { return 0; },
+        [&](int&, unsigned long i) { DoNotOptimize(vec[keys.perm[i]]); });
+  Bench("Vector Resize (+1)", type, num, few, [num] { return Vector<T>(num); },
+        [](Vector<T>& v, unsigned long) { v.Resize(v.Size() + 1); });
+
+  Bench("List InsertAtBack", type, num, num, [] { return List<T>(); },
+        [&](List<T>& l, unsigned long i) { l.InsertAtBack(keys.present[i]); });
+  Bench("List InsertAtFront", type, num, num, [] { return List<T>(); },
+        [&](List<T>& l, unsigned long i) { l.InsertAtFront(keys.present[i]); });
+  Bench("List RemoveFromFront", type, num, num, [&] { return List<T>(keys.sorted); },
+        [](List<T>& l, unsigned long) { l.RemoveFromFront(); });
+  List<T> lst(keys.sorted);
+  Bench("List operator[] (random)", type, num, few, [] { return 0; },
+        [&](int&, unsigned long i) { DoNotOptimize(lst[keys.perm[i]]); });
+}
+
+template <typename T>
+void BenchOpsSet(const std::string& type, unsigned long num, const OpsKeys<T>& keys) {
+  unsigned long few = std::min(num, 200ul);
+
+  SetVec<T> set(keys.sorted);
+  Bench("SetVec Insert (random)", type, num, few, [&] { return SetVec<T>(set); },
+        [&](SetVec<T>& s, unsigned long i) { s.Insert(keys.absent[i]); });
+  Bench("SetVec Exists (random)", type, num, num, [] { return 0; },
+        [&](int&, unsigned long i) { DoNotOptimize(set.Exists(keys.probe[i])); });
+  Bench("SetVec Remove (random)", type, num, few, [&] { return SetVec<T>(set); },
+        [&](SetVec<T>& s, unsigned long i) { s.Remove(keys.present[i]); });
+
+  // SetLst: anche la ricerca è lineare
+  SetLst<T> lst(keys.sorted);
+  Bench("SetLst Insert (random)", type, num, few, [&] { return SetLst<T>(lst); },
+        [&](SetLst<T>& s, unsigned long i) { s.Insert(keys.absent[i]); });
+  Bench("SetLst Exists (random)", type, num, few, [] { return 0; },
+        [&](int&, unsigned long i) { DoNotOptimize(lst.Exists(keys.probe[i])); });
+  Bench("SetLst Remove (random)", type, num, few, [&] { return SetLst<T>(lst); },
+        [&](SetLst<T>& s, unsigned long i) { s.Remove(keys.present[i]); });
+}
+
+template <typename T>
+void BenchOpsHeap(const std::string& type, unsigned long num, const OpsKeys<T>& keys) {
+  unsigned long few = std::min(num, 200ul);
+
+  // Heapify da un array ordinato in modo crescente (nessun nodo rispetta il max-heap)
+  Bench("HeapVec Heapify", type, num, 1, [&] { HeapVec<T> h(keys.present); h.Sort(); return h; },
+        [](HeapVec<T>& h, unsigned long) { h.Heapify(); });
+  Bench("HeapVec Sort", type, num, 1, [&] { return HeapVec<T>(keys.present); },
+        [](HeapVec<T>& h, unsigned long) { h.Sort(); });
+
+  PQHeap<T> pq(keys.present);
+  Bench("PQHeap Insert", type, num, few, [&] { return PQHeap<T>(pq); },
+        [&](PQHeap<T>& q, unsigned long i) { q.Insert(keys.absent[i]); });
+  Bench("PQHeap RemoveTip", type, num, few, [&] { return PQHeap<T>(pq); },
+        [](PQHeap<T>& q, unsigned long) { q.RemoveTip(); });
+  Bench("PQHeap Change (random)", type, num, num, [&] { return PQHeap<T>(pq); },
+        [&](PQHeap<T>& q, unsigned long i) { q.Change(keys.perm[i], keys.absent[i]); });
+}
+
+template <typename T, typename MakeKey>
+void BenchOpsType(const std::string& type, MakeKey key) {
+  // (le liste restano entro 10^5 nodi: il loro distruttore è ricorsivo)
+  for (unsigned long num : {1000ul, 100000ul}) {
+    OpsKeys<T> keys = MakeOpsKeys<T>(num, key);
+    BenchOpsLinear<T>(type, num, keys);
+    BenchOpsSet<T>(type, num, keys);
+    BenchOpsHeap<T>(type, num, keys);
+  }
+}
+
+inline void BenchOps() {
+  BenchOpsType<int>("int", [](unsigned long i) { return static_cast<int>(i); });
+  BenchOpsType<std::string>("string", [](unsigned long i) { return "key_" + std::to_string(1000000000ul + i); });
+}
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef BENCH_RANGES_HPP
+#define BENCH_RANGES_HPP
+
+#include <string>
+#include <random>
+#include <algorithm>
+#include <ranges>
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
+#include "../../set/vec/setvec.hpp"
+
+using namespace lasd;
+
+// Stesse operazioni tramite le interfacce della libreria e tramite gli iteratori STL
+inline void BenchRanges() {
+  std::cout << std::endl << "Iteratori STL vs interfacce della libreria" << std::endl;
+  unsigned long num = 2000000;
+  std::mt19937_64 gen(41);
+
+  SortableVector<int> src(num);
+  for (unsigned long i = 0; i < num; ++i) {
+    src[i] = static_cast<int>(gen() % (4 * num));
+  }
+  SortableVector<int> vec(src);
+  Report("Vector Sort (SortableVector)", num, MeasureNs(num, [&]() { vec.Sort(); DoNotOptimize(vec[0]); }));
+  vec = src;
+  Report("Vector std::ranges::sort", num, MeasureNs(num, [&]() { std::ranges::sort(vec); DoNotOptimize(vec[0]); }));
+
+  Report("Vector Fold (Traverse)", num, MeasureNs(num, [&]() {
+    long sum = vec.Fold<long>([](const int& val, const long& acc) { return acc + val; }, 0);
+    DoNotOptimize(sum);
+  }));
+  Report("Vector somma (range-for)", num, MeasureNs(num, [&]() {
+    long sum = 0;
+    for (int val : vec) sum += val;
+    DoNotOptimize(sum);
+  }));
+
+  // Lista più corta: il distruttore dei nodi è ricorsivo e con milioni di nodi esaurisce lo stack
+  unsigned long lnum = 100000;
+  Vector<int> part(lnum);
+  for (unsigned long i = 0; i < lnum; ++i) {
+    part[i] = src[i];
+  }
+  List<int> lst(part);
+  Report("List Fold (Traverse)", lnum, MeasureNs(lnum, [&]() {
+    long sum = lst.Fold<long>([](const int& val, const long& acc) { return acc + val; }, 0);
+    DoNotOptimize(sum);
+  }));
+  Report("List somma (range-for)", lnum, MeasureNs(lnum, [&]() {
+    long sum = 0;
+    for (int val : lst) sum += val;
+    DoNotOptimize(sum);
+  }));
+
+  // SetVec con head spostato: il buffer circolare è attraversato a cavallo della fine
+  SetVec<int> set(vec);
+  for (unsigned long i = 0, cnt = set.Size() / 3; i < cnt; ++i) {
+    set.RemoveMin();
+  }
+  for (unsigned long i = 0, cnt = set.Size() / 3; i < cnt; ++i) {
+    const int key = static_cast<int>(4 * num + i); // (in coda: nessuno spostamento)
+    set.Insert(key);
+  }
+  unsigned long qry = 1000000;
+  Vector<int> qs(qry);
+  for (unsigned long i = 0; i < qry; ++i) {
+    qs[i] = static_cast<int>(gen() % (5 * num));
+  }
+  Report("SetVec Exists", qry, MeasureNs(qry, [&]() {
+    unsigned long cnt = 0;
+    for (unsigned long i = 0; i < qry; ++i) cnt += set.Exists(qs[i]);
+    DoNotOptimize(cnt);
+  }));
+  Report("SetVec std::ranges::binary_search", qry, MeasureNs(qry, [&]() {
+    unsigned long cnt = 0;
+    for (unsigned long i = 0; i < qry; ++i) cnt += std::ranges::binary_search(set, qs[i]);
+    DoNotOptimize(cnt);
+  }));
+  unsigned long cnt = set.Size();
+  Report("SetVec somma (operator[])", cnt, MeasureNs(cnt, [&]() {
+    long sum = 0;
+    for (unsigned long i = 0; i < cnt; ++i) sum += set[i];
+    DoNotOptimize(sum);
+  }));
+  Report("SetVec somma (range-for)", cnt, MeasureNs(cnt, [&]() {
+    long sum = 0;
+    for (int val : set) sum += val;
+    DoNotOptimize(sum);
+  }));
+}
+
+#endif
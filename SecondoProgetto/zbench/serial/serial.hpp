@@ -0,0 +1,59 @@
+#ifndef BENCH_SERIAL_HPP
+#define BENCH_SERIAL_HPP
+
+#include <string>
+#include <cstdio>
+#include <type_traits>
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../vector/mapped/mappedvector.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../set/mapped/mappedsetvec.hpp"
+
+using namespace lasd;
+
+// Salvataggio e caricamento di un SetVec, contro la ricostruzione per inserimenti
+// e (per i tipi banalmente copiabili) l'apertura della vista mappata
+template <typename T, typename MakeKey>
+void BenchSerialType(const std::string& name, unsigned long num, MakeKey key) {
+  std::string path = "/tmp/lasd_bench_serial.bin";
+  Vector<T> vec(num);
+  for (unsigned long i = 0; i < num; ++i) {
+    vec[i] = key(i);
+  }
+  SetVec<T> set(vec);
+
+  Report(name + " SetVec rebuild (Insert)", num, MeasureNs(num, [&]() {
+    SetVec<T> tmp(vec);
+    DoNotOptimize(tmp.Size());
+  }));
+  Report(name + " SetVec Save", num, MeasureNs(num, [&]() {
+    set.Save(path);
+  }));
+  Report(name + " SetVec Load", num, MeasureNs(num, [&]() {
+    SetVec<T> tmp;
+    tmp.Load(path);
+    DoNotOptimize(tmp.Size());
+  }));
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    // Apertura più una ricerca: si caricano solo le pagine toccate
+    Report(name + " MappedSetVec open + Exists", num, MeasureNs(num, [&]() {
+      MappedSetVec<T> map(path);
+      DoNotOptimize(map.Exists(key(num / 2)));
+    }));
+  }
+  std::remove(path.c_str());
+}
+
+inline void BenchSerial() {
+  std::cout << std::endl << "Serializzazione binaria (ns per elemento)" << std::endl;
+  for (unsigned long num : {100000ul, 4000000ul}) {
+    BenchSerialType<int>("int n=" + std::to_string(num), num,
+                         [](unsigned long i) { return static_cast<int>(i); });
+  }
+  BenchSerialType<std::string>("string n=100000", 100000,
+                               [](unsigned long i) { return "key_" + std::to_string(1000000000ul + i); });
+}
+
+#endif
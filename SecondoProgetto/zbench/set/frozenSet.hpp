@@ -0,0 +1,68 @@
+#ifndef BENCH_FROZENSET_HPP
+#define BENCH_FROZENSET_HPP
+
+#include <string>
+#include <random>
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../set/frozen/frozenset.hpp"
+
+using namespace lasd;
+
+// Ricerche casuali (metà presenti, metà assenti) su SetVec e sul FrozenSet costruito da esso
+template <typename T, typename MakeKey>
+void BenchFrozenSetType(const std::string& name, unsigned long num, MakeKey key) {
+  // Chiavi pari in ordine: il SetVec si costruisce con inserimenti in coda
+  Vector<T> vec(num);
+  for (unsigned long i = 0; i < num; ++i) {
+    vec[i] = key(2 * i);
+  }
+  SetVec<T> set(vec);
+  FrozenSet<T> frz(set);
+
+  unsigned long qry = 1000000;
+  Vector<T> qs(qry);
+  std::mt19937_64 gen(5);
+  for (unsigned long i = 0; i < qry; ++i) {
+    qs[i] = key(gen() % (2 * num));
+  }
+
+  Report(name + " SetVec Exists", qry, MeasureNs(qry, [&]() {
+    unsigned long cnt = 0;
+    for (unsigned long i = 0; i < qry; ++i) cnt += set.Exists(qs[i]);
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " FrozenSet Exists", qry, MeasureNs(qry, [&]() {
+    unsigned long cnt = 0;
+    for (unsigned long i = 0; i < qry; ++i) cnt += frz.Exists(qs[i]);
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " SetVec Successor", qry, MeasureNs(qry, [&]() {
+    unsigned long cnt = 0;
+    for (unsigned long i = 0; i < qry; ++i) {
+      try { cnt += (set.Successor(qs[i]) < qs[i]); } catch (const std::length_error&) {}
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " FrozenSet Successor", qry, MeasureNs(qry, [&]() {
+    unsigned long cnt = 0;
+    for (unsigned long i = 0; i < qry; ++i) {
+      try { cnt += (frz.Successor(qs[i]) < qs[i]); } catch (const std::length_error&) {}
+    }
+    DoNotOptimize(cnt);
+  }));
+}
+
+inline void BenchFrozenSet() {
+  std::cout << std::endl << "FrozenSet vs SetVec (ricerche casuali)" << std::endl;
+  for (unsigned long num : {1000ul, 100000ul, 4000000ul}) {
+    BenchFrozenSetType<int>("int n=" + std::to_string(num), num,
+                            [](unsigned long i) { return static_cast<int>(i); });
+  }
+  BenchFrozenSetType<std::string>("string n=100000", 100000,
+                                  [](unsigned long i) { return "key_" + std::to_string(1000000000ul + i); });
+}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef BENCH_SETBTREE_HPP
+#define BENCH_SETBTREE_HPP
+
+#include <string>
+#include <random>
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../set/btree/setbtree.hpp"
+
+using namespace lasd;
+
+// Inserimenti casuali, ricerche (metà presenti, metà assenti), visita completa
+// e caricamento in blocco: SetBTree contro SetVec
+template <typename T, typename MakeKey>
+void BenchSetBTreeType(const std::string& name, unsigned long num, MakeKey key, bool withvec) {
+  std::mt19937_64 gen(37);
+  Vector<T> ins(num);
+  for (unsigned long i = 0; i < num; ++i) {
+    ins[i] = key(2 * (gen() % num));
+  }
+  unsigned long qry = 1000000;
+  Vector<T> qs(qry);
+  for (unsigned long i = 0; i < qry; ++i) {
+    qs[i] = key(gen() % (2 * num));
+  }
+
+  SetVec<T> set;
+  SetBTree<T> bt;
+  if (withvec) {
+    Report(name + " SetVec Insert", num, MeasureNs(num, [&]() {
+      for (unsigned long i = 0; i < num; ++i) set.Insert(ins[i]);
+    }));
+  }
+  Report(name + " SetBTree Insert", num, MeasureNs(num, [&]() {
+    for (unsigned long i = 0; i < num; ++i) bt.Insert(ins[i]);
+  }));
+
+  if (withvec) {
+    Report(name + " SetVec Exists", qry, MeasureNs(qry, [&]() {
+      unsigned long cnt = 0;
+      for (unsigned long i = 0; i < qry; ++i) cnt += set.Exists(qs[i]);
+      DoNotOptimize(cnt);
+    }));
+  }
+  Report(name + " SetBTree Exists", qry, MeasureNs(qry, [&]() {
+    unsigned long cnt = 0;
+    for (unsigned long i = 0; i < qry; ++i) cnt += bt.Exists(qs[i]);
+    DoNotOptimize(cnt);
+  }));
+
+  if (withvec) {
+    Report(name + " SetVec Traverse", set.Size(), MeasureNs(set.Size(), [&]() {
+      unsigned long cnt = 0;
+      const T* prv = nullptr;
+      set.Traverse([&](const T& val) { cnt += (prv != nullptr && *prv < val); prv = &val; });
+      DoNotOptimize(cnt);
+    }));
+  }
+  Report(name + " SetBTree Traverse", bt.Size(), MeasureNs(bt.Size(), [&]() {
+    unsigned long cnt = 0;
+    const T* prv = nullptr;
+    bt.Traverse([&](const T& val) { cnt += (prv != nullptr && *prv < val); prv = &val; });
+    DoNotOptimize(cnt);
+  }));
+
+  // Chiavi già ordinate: caricamento in blocco
+  Vector<T> srt(num);
+  for (unsigned long i = 0; i < num; ++i) {
+    srt[i] = key(i);
+  }
+  Report(name + " SetBTree bulk load", num, MeasureNs(num, [&]() {
+    SetBTree<T> blk(srt);
+    DoNotOptimize(blk.Size());
+  }));
+}
+
+inline void BenchSetBTree() {
+  std::cout << std::endl << "SetBTree vs SetVec" << std::endl;
+  BenchSetBTreeType<int>("int n=100000", 100000, [](unsigned long i) { return static_cast<int>(i); }, true);
+  BenchSetBTreeType<int>("int n=2000000", 2000000, [](unsigned long i) { return static_cast<int>(i); }, false);
+  BenchSetBTreeType<std::string>("string n=100000", 100000,
+                                 [](unsigned long i) { return "key_" + std::to_string(1000000000ul + i); }, true);
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef BENCH_STATS_HPP
+#define BENCH_STATS_HPP
+
+#include <string>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../heap/vec/heapvec.hpp"
+#include "../../pq/heap/pqheap.hpp"
+#include "../../stats/stats.hpp"
+
+using namespace lasd;
+
+// Conteggi delle operazioni (solo con make stats=1): lavoro medio per
+// operazione, da confrontare con i tempi delle altre suite
+
+inline void PrintStats(const std::string& name, unsigned long ops, const OpStats& sts) {
+  double div = (ops != 0) ? static_cast<double>(ops) : 1.0;
+  std::cout << "  " << std::left << std::setw(32) << name << " ops=" << std::setw(7) << ops << std::right
+            << std::fixed << std::setprecision(1)
+            << " cmp " << std::setw(8) << sts.comparisons / div << " mov " << std::setw(8) << sts.moves / div
+            << " cpy " << std::setw(8) << sts.copies / div << " alloc " << std::setw(6) << sts.allocations / div
+            << " resize " << std::setw(6) << sts.resizes / div << " (per op)" << std::endl;
+}
+
+inline void BenchStats(unsigned long num) {
+  if constexpr (!StatsPolicy::Enabled) {
+    std::cout << "  (contatori disattivati: ricompilare con make clean && make bench stats=1)" << std::endl;
+  } else {
+    Vector<int> keys(num);
+    std::mt19937 gen(num);
+    for (unsigned long i = 0; i < num; ++i) {
+      keys[i] = static_cast<int>(gen() % (4 * num));
+    }
+
+    Vector<int> vec;
+    for (unsigned long i = 0; i < num; ++i) {
+      vec.Resize(vec.Size() + 1);
+    }
+    PrintStats("Vector Resize (+1)", num, vec.Stats());
+
+    SetVec<int> set;
+    for (unsigned long i = 0; i < num; ++i) {
+      set.Insert(keys[i]);
+    }
+    PrintStats("SetVec Insert (random)", num, set.Stats());
+    set.ResetStats();
+    for (unsigned long i = 0; i < num; ++i) {
+      DoNotOptimize(set.Exists(keys[i]));
+    }
+    PrintStats("SetVec Exists", num, set.Stats());
+    set.ResetStats();
+    for (unsigned long i = 0; i < num; ++i) {
+      set.Remove(keys[i]);
+    }
+    PrintStats("SetVec Remove", num, set.Stats());
+
+    HeapVec<int> heap(keys);
+    PrintStats("HeapVec Heapify", num, heap.Stats());
+    heap.ResetStats();
+    heap.Sort();
+    PrintStats("HeapVec Sort", num, heap.Stats());
+
+    PQHeap<int> pq;
+    for (unsigned long i = 0; i < num; ++i) {
+      pq.Insert(keys[i]);
+    }
+    PrintStats("PQHeap Insert", num, pq.Stats());
+    pq.ResetStats();
+    while (!pq.Empty()) {
+      pq.RemoveTip();
+    }
+    PrintStats("PQHeap RemoveTip", num, pq.Stats());
+  }
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef BENCH_STREAM_HPP
+#define BENCH_STREAM_HPP
+
+#include <string>
+#include <sstream>
+#include <random>
+#include "../util/bench_utils.hpp"
+
+#include "../../list/list.hpp"
+#include "../../vector/vector.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../heap/vec/heapvec.hpp"
+#include "../../stream/stream.hpp"
+
+using namespace lasd;
+
+// Lettura di num interi da testo: prima in una List e poi nel contenitore
+// (come si faceva senza sorgenti), contro Build direttamente dal flusso
+template <typename Con>
+void BenchStreamText(const std::string& name, const std::string& txt, unsigned long num) {
+  Report(name + " via List", num, MeasureNs(num, [&]() {
+    std::istringstream str(txt);
+    List<int> lst;
+    int val;
+    while (str >> val) lst.InsertAtBack(val);
+    Con con(lst);
+    DoNotOptimize(con.Size());
+  }));
+  Report(name + " Build (TextSource)", num, MeasureNs(num, [&]() {
+    std::istringstream str(txt);
+    Con con;
+    con.Build(TextSource<int>(str));
+    DoNotOptimize(con.Size());
+  }));
+}
+
+inline void BenchStream() {
+  std::cout << std::endl << "Costruzione in streaming (ns per record)" << std::endl;
+  // (la List intermedia resta sotto i 10^5 nodi: il suo distruttore è ricorsivo)
+  unsigned long num = 100000;
+  unsigned long big = 2000000;
+  std::mt19937 gen(3);
+  std::string stxt;
+  std::string txt;
+  std::string bigtxt;
+  std::string raw;
+  for (unsigned long i = 0; i < big; ++i) {
+    int val = static_cast<int>(gen() % 100000000);
+    if (i < num / 5) {
+      stxt += std::to_string(val) + '\n';
+    }
+    if (i < num) {
+      txt += std::to_string(val) + '\n';
+    }
+    bigtxt += std::to_string(val) + '\n';
+    raw.append(reinterpret_cast<const char*>(&val), sizeof(val));
+  }
+
+  BenchStreamText<Vector<int>>("Vector<int> testo", txt, num);
+  BenchStreamText<HeapVec<int>>("HeapVec<int> testo", txt, num);
+  // (SetVec da List: un inserimento ordinato per record, O(n^2): meno record)
+  BenchStreamText<SetVec<int>>("SetVec<int> testo", stxt, num / 5);
+
+  std::string suf = " n=" + std::to_string(big);
+  Report("Vector<int> testo" + suf + " Build", big, MeasureNs(big, [&]() {
+    std::istringstream str(bigtxt);
+    Vector<int> vec;
+    vec.Build(TextSource<int>(str));
+    DoNotOptimize(vec.Size());
+  }));
+  Report("SetVec<int> testo" + suf + " Build", big, MeasureNs(big, [&]() {
+    std::istringstream str(bigtxt);
+    SetVec<int> set;
+    set.Build(TextSource<int>(str));
+    DoNotOptimize(set.Size());
+  }));
+
+  // Record binari: il suggerimento riserva lo spazio una volta sola
+  Report("Vector<int> binario" + suf + " Build", big, MeasureNs(big, [&]() {
+    std::istringstream str(raw);
+    Vector<int> vec;
+    vec.Build(BinarySource<int>(str));
+    DoNotOptimize(vec.Size());
+  }));
+  Report("Vector<int> generatore" + suf + " (senza hint)", big, MeasureNs(big, [&]() {
+    Vector<int> vec;
+    unsigned long i = 0;
+    vec.Build([&i, big](int& dat) { dat = static_cast<int>(i); return i++ < big; });
+    DoNotOptimize(vec.Size());
+  }));
+  Report("Vector<int> generatore" + suf + " (con hint)", big, MeasureNs(big, [&]() {
+    Vector<int> vec;
+    unsigned long i = 0;
+    vec.Build([&i, big](int& dat) { dat = static_cast<int>(i); return i++ < big; }, big);
+    DoNotOptimize(vec.Size());
+  }));
+}
+
+#endif
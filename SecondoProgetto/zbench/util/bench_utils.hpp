@@ -0,0 +1,257 @@
+#ifndef BENCH_UTILS_HPP
+#define BENCH_UTILS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "perf_counters.hpp"
+
+// ===================
+// Utilità per i benchmark
+// ===================
+
+// Impedisce al compilatore di eliminare un valore misurato
+template <typename T>
+inline void DoNotOptimize(const T& val) {
+  asm volatile("" : : "r,m"(val) : "memory");
+}
+
+// Opzioni da riga di comando (vedi ParseBenchArgs)
+struct BenchConfig {
+  unsigned long warmup = 1;   // Ripetizioni di riscaldamento (non misurate)
+  unsigned long reps = 7;     // Ripetizioni misurate
+  std::string filter;         // Solo le suite il cui nome contiene filter
+  std::string json;           // File dei risultati in JSON (vuoto: nessuno)
+  bool counters = true;       // Contatori hardware (vedi perf_counters.hpp)
+};
+
+inline BenchConfig& Config() {
+  static BenchConfig cfg;
+  return cfg;
+}
+
+// Un risultato: tempi in nanosecondi (e conteggi hardware) per operazione
+struct BenchResult {
+  std::string suite;
+  std::string name;
+  std::string type;
+  unsigned long num;  // Dimensione del contenitore
+  unsigned long ops;  // Operazioni per ripetizione
+  unsigned long reps;
+  double median;
+  double p99;
+  double mean;
+  PerfCounts counts;
+};
+
+inline std::vector<BenchResult>& Results() {
+  static std::vector<BenchResult> res;
+  return res;
+}
+
+inline std::string& CurrentSuite() {
+  static std::string suite;
+  return suite;
+}
+
+// Opzioni: --json FILE, --reps N, --warmup N, --filter TESTO, --counters on|off
+// (false se non valide)
+inline bool ParseBenchArgs(int argc, char* argv[]) {
+  BenchConfig& cfg = Config();
+  for (int i = 1; i < argc; ++i) {
+    std::string opt = argv[i];
+    if (i + 1 == argc) {
+      std::cerr << "Missing value for " << opt << std::endl;
+      return false;
+    }
+    std::string val = argv[++i];
+    if (opt == "--json") {
+      cfg.json = val;
+    } else if (opt == "--filter") {
+      cfg.filter = val;
+    } else if (opt == "--counters" && (val == "on" || val == "off")) {
+      cfg.counters = (val == "on");
+    } else if (opt == "--reps" || opt == "--warmup") {
+      unsigned long num = std::strtoul(val.c_str(), nullptr, 10);
+      if (opt == "--reps") {
+        cfg.reps = (num == 0) ? 1 : num;
+      } else {
+        cfg.warmup = num;
+      }
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--json FILE] [--reps N] [--warmup N] [--filter TEXT] [--counters on|off]" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Inizia una suite, con la sua intestazione; false se esclusa dal filtro
+inline bool Suite(const std::string& name) {
+  if (!Config().filter.empty() && name.find(Config().filter) == std::string::npos) {
+    return false;
+  }
+  CurrentSuite() = name;
+  std::cout << std::endl << "~*~#~*~ " << name << " ~*~#~*~" << std::endl;
+  return true;
+}
+
+// Conteggi hardware dell'ultima MeasureNs, presi dalla Report successiva
+inline PerfCounts& PendingCounts() {
+  static PerfCounts cnt;
+  return cnt;
+}
+
+inline bool CountersOn() {
+  return Config().counters && PerfCounters::Instance().Available();
+}
+
+// Stampa i conteggi per operazione sotto un risultato (niente se non disponibili)
+inline void PrintCounts(const PerfCounts& cnt) {
+  if (!cnt.Any()) {
+    return;
+  }
+  const char* const labels[PerfEvents] = {"cyc", "ins", "L1d-miss", "LLC-miss", "br-miss", "dTLB-miss"};
+  std::cout << "  " << std::setw(50) << "" << std::fixed << std::setprecision(2);
+  for (unsigned long evt = 0; evt < PerfEvents; ++evt) {
+    std::cout << " " << labels[evt] << " ";
+    if (cnt.valid[evt]) {
+      std::cout << cnt.value[evt];
+    } else {
+      std::cout << "-";
+    }
+  }
+  if (cnt.valid[Cycles] && cnt.valid[Instructions] && cnt.value[Cycles] > 0) {
+    std::cout << " IPC " << cnt.value[Instructions] / cnt.value[Cycles];
+  }
+  std::cout << " /op" << std::endl;
+}
+
+// Esegue fun una volta e restituisce i nanosecondi per operazione (i
+// conteggi hardware, se disponibili, vanno alla Report successiva)
+template <typename Fun>
+double MeasureNs(unsigned long ops, Fun fun) {
+  bool cnton = CountersOn();
+  if (cnton) {
+    PerfCounters::Instance().Start();
+  }
+  auto start = std::chrono::steady_clock::now();
+  fun();
+  auto stop = std::chrono::steady_clock::now();
+  PendingCounts() = cnton ? PerfCounters::Instance().Stop(ops) : PerfCounts();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  return (ops != 0) ? (ns / ops) : ns;
+}
+
+// Misura singola (una ripetizione, senza percentili)
+inline void Report(const std::string& name, unsigned long num, double nsop) {
+  std::cout << "  " << std::left << std::setw(48) << name << " n=" << std::setw(9) << num
+            << std::right << std::fixed << std::setprecision(2) << std::setw(10) << nsop << " ns/op" << std::endl;
+  PrintCounts(PendingCounts());
+  Results().push_back({CurrentSuite(), name, "", num, num, 1, nsop, nsop, nsop, PendingCounts()});
+  PendingCounts() = PerfCounts();
+}
+
+// Microbenchmark di un'operazione: op(st, i) per i in [0, ops), dove st è
+// lo stato creato da setup() (non misurato) a ogni ripetizione. I tempi si
+// prendono a blocchi di poche operazioni, così mediana e p99 descrivono la
+// distribuzione del costo per operazione e non solo la sua media. I contatori
+// hardware si leggono in una ripetizione in più, senza tempi nel ciclo.
+template <typename Setup, typename Op>
+void Bench(const std::string& name, const std::string& type, unsigned long num, unsigned long ops, Setup setup, Op op) {
+  const BenchConfig& cfg = Config();
+  unsigned long batch = std::clamp(ops / 16, 1ul, 64ul);
+  std::vector<double> samples;
+  samples.reserve(cfg.reps * ((ops + batch - 1) / batch));
+  double total = 0;
+  for (unsigned long r = 0; r < cfg.warmup + cfg.reps; ++r) {
+    auto st = setup();
+    for (unsigned long i = 0; i < ops; ) {
+      unsigned long end = std::min(i + batch, ops);
+      unsigned long cnt = end - i;
+      auto start = std::chrono::steady_clock::now();
+      for (; i < end; ++i) {
+        op(st, i);
+      }
+      auto stop = std::chrono::steady_clock::now();
+      if (r >= cfg.warmup) {
+        double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+        samples.push_back(ns / cnt);
+        total += ns;
+      }
+    }
+  }
+  std::sort(samples.begin(), samples.end());
+  unsigned long cnt = samples.size();
+  BenchResult res{CurrentSuite(), name, type, num, ops, cfg.reps, 0, 0, 0, PerfCounts()};
+  if (CountersOn()) {
+    auto st = setup();
+    PerfCounters::Instance().Start();
+    for (unsigned long i = 0; i < ops; ++i) {
+      op(st, i);
+    }
+    res.counts = PerfCounters::Instance().Stop(ops);
+  }
+  if (cnt != 0) {
+    res.median = samples[cnt / 2];
+    res.p99 = samples[std::min(cnt - 1, (99 * cnt + 99) / 100 - 1)];
+    res.mean = total / (static_cast<double>(ops) * cfg.reps);
+  }
+  std::cout << "  " << std::left << std::setw(40) << (name + "<" + type + ">") << " n=" << std::setw(9) << num
+            << std::right << std::fixed << std::setprecision(2)
+            << " med " << std::setw(10) << res.median << " p99 " << std::setw(10) << res.p99
+            << " mean " << std::setw(10) << res.mean << " ns/op" << std::endl;
+  PrintCounts(res.counts);
+  Results().push_back(res);
+}
+
+// Scrive i risultati in JSON, se richiesto con --json
+inline void WriteResults() {
+  const std::string& path = Config().json;
+  if (path.empty()) {
+    return;
+  }
+  auto quote = [](const std::string& str) {
+    std::string out = "\"";
+    for (char chr : str) {
+      if (chr == '"' || chr == '\\') out += '\\';
+      out += chr;
+    }
+    return out + "\"";
+  };
+  std::ofstream out(path);
+  out << "{\n  \"warmup\": " << Config().warmup << ",\n  \"reps\": " << Config().reps << ",\n  \"results\": [";
+  for (unsigned long i = 0; i < Results().size(); ++i) {
+    const BenchResult& res = Results()[i];
+    out << ((i == 0) ? "\n" : ",\n") << "    {\"suite\": " << quote(res.suite) << ", \"name\": " << quote(res.name)
+        << ", \"type\": " << quote(res.type) << ", \"n\": " << res.num << ", \"ops\": " << res.ops
+        << ", \"reps\": " << res.reps << std::fixed << std::setprecision(3)
+        << ", \"median_ns\": " << res.median << ", \"p99_ns\": " << res.p99 << ", \"mean_ns\": " << res.mean;
+    if (res.counts.Any()) {
+      out << ", \"counters\": {";
+      const char* sep = "";
+      for (unsigned long evt = 0; evt < PerfEvents; ++evt) {
+        if (res.counts.valid[evt]) {
+          out << sep << quote(PerfEventName(evt)) << ": " << res.counts.value[evt];
+          sep = ", ";
+        }
+      }
+      out << "}";
+    }
+    out << "}";
+  }
+  out << "\n  ]\n}\n";
+  if (!out) {
+    std::cerr << "Cannot write " << path << std::endl;
+    return;
+  }
+  std::cout << std::endl << "Results written to " << path << std::endl;
+}
+
+#endif
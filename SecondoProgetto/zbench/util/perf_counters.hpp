@@ -0,0 +1,173 @@
+#ifndef BENCH_PERF_COUNTERS_HPP
+#define BENCH_PERF_COUNTERS_HPP
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <iostream>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// ===================
+// Contatori hardware
+// ===================
+
+// Contatori di prestazioni hardware (perf_event_open di Linux), letti attorno
+// al codice misurato. Si contano solo gli eventi in spazio utente, del thread
+// chiamante e dei thread che avvia dopo. Ogni evento è aperto da solo, così
+// si usa il sottoinsieme che la macchina offre; se non se ne apre nessuno
+// (niente PMU, perf_event_paranoid, container senza CAP_PERFMON, altro
+// sistema operativo) i benchmark misurano solo i tempi.
+
+enum PerfEvent : unsigned long { Cycles, Instructions, L1DMisses, LLCMisses, BranchMisses, DTLBMisses, PerfEvents };
+
+inline const char* PerfEventName(unsigned long evt) {
+  static const char* const names[PerfEvents] = {"cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses", "dtlb_misses"};
+  return names[evt];
+}
+
+// Conteggi per operazione (valid[evt] è false per gli eventi non disponibili)
+struct PerfCounts {
+  double value[PerfEvents] = {};
+  bool valid[PerfEvents] = {};
+
+  bool Any() const noexcept {
+    for (unsigned long evt = 0; evt < PerfEvents; ++evt) {
+      if (valid[evt]) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+class PerfCounters {
+
+private:
+
+  int fds[PerfEvents];
+  std::string error; // Perché nessun contatore è disponibile
+
+  PerfCounters() {
+    for (int& fd : fds) {
+      fd = -1;
+    }
+#if defined(__linux__)
+    const std::pair<unsigned long, unsigned long> events[PerfEvents] = {
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+      {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    };
+    int err = 0;
+    for (unsigned long evt = 0; evt < PerfEvents; ++evt) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = events[evt].first;
+      attr.config = events[evt].second;
+      attr.disabled = 1;
+      attr.inherit = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      // Scalati con il tempo abilitato/attivo quando la PMU è condivisa
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      fds[evt] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+      if (fds[evt] < 0 && err == 0) {
+        err = errno;
+      }
+    }
+    if (!Available()) {
+      error = std::string("perf_event_open: ") + std::strerror(err);
+      if (err == EACCES || err == EPERM) {
+        error += ", vedi /proc/sys/kernel/perf_event_paranoid";
+      }
+    }
+#else
+    error = "perf_event_open esiste solo su Linux";
+#endif
+  }
+
+public:
+
+  ~PerfCounters() {
+#if defined(__linux__)
+    for (int fd : fds) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+#endif
+  }
+
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  // Aperti al primo uso; la loro assenza è segnalata una volta, su std::cerr
+  static PerfCounters& Instance() {
+    static PerfCounters pfc;
+    static bool told = false;
+    if (!told && !pfc.Available()) {
+      std::cerr << "Contatori hardware non disponibili (" << pfc.Error() << "): solo tempi" << std::endl;
+      told = true;
+    }
+    return pfc;
+  }
+
+  bool Available() const noexcept {
+    for (int fd : fds) {
+      if (fd >= 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const std::string& Error() const noexcept {
+    return error;
+  }
+
+  void Start() noexcept {
+#if defined(__linux__)
+    for (int fd : fds) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+#endif
+  }
+
+  // Ferma il conteggio e restituisce i conteggi divisi per ops
+  PerfCounts Stop(unsigned long ops) noexcept {
+    PerfCounts cnt;
+#if defined(__linux__)
+    for (int fd : fds) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      }
+    }
+    double div = (ops != 0) ? static_cast<double>(ops) : 1.0;
+    for (unsigned long evt = 0; evt < PerfEvents; ++evt) {
+      std::uint64_t buf[3]; // valore, tempo abilitato, tempo attivo
+      if (fds[evt] >= 0 && read(fds[evt], buf, sizeof(buf)) == sizeof(buf) && buf[2] != 0) {
+        cnt.value[evt] = static_cast<double>(buf[0]) * (static_cast<double>(buf[1]) / buf[2]) / div;
+        cnt.valid[evt] = true;
+      }
+    }
+#endif
+    return cnt;
+  }
+
+};
+
+#endif
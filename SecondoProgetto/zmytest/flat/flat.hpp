@@ -0,0 +1,343 @@
+#ifndef TEST_FLAT_HPP
+#define TEST_FLAT_HPP
+#include <iostream>
+#include <string>
+#include <cassert>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../heap/vec/heapvec.hpp"
+#include "../../pq/heap/pqheap.hpp"
+#include "../../flat/vector/flatvector.hpp"
+#include "../../flat/list/flatlist.hpp"
+#include "../../flat/set/flatsetvec.hpp"
+#include "../../flat/heap/flatheapvec.hpp"
+#include "../../flat/pq/flatpqheap.hpp"
+#include "../../flat/adapter.hpp"
+
+using namespace lasd;
+
+// Niente vtable né basi virtuali: l'oggetto è fatto solo dei suoi campi
+template <typename T>
+void TestFlatLayout() {
+  static_assert(!std::is_polymorphic_v<FlatVector<T>>);
+  static_assert(!std::is_polymorphic_v<FlatList<T>>);
+  static_assert(!std::is_polymorphic_v<FlatSetVec<T>>);
+  static_assert(!std::is_polymorphic_v<FlatHeapVec<T>>);
+  static_assert(!std::is_polymorphic_v<FlatPQHeap<T>>);
+  ASSERT_EQ(sizeof(FlatVector<T>), sizeof(T*) + sizeof(ulong));
+  ASSERT_EQ(sizeof(FlatHeapVec<T>), sizeof(FlatVector<T>));
+  ASSERT_TRUE(sizeof(FlatVector<T>) < sizeof(Vector<T>));
+}
+
+template <typename T>
+void TestFlatVector() {
+  const ulong n = 200;
+  SortableVector<T> ref(n);
+  for (ulong i = 0; i < n; ++i) {
+    ref[i] = MakeValue<T>(static_cast<int>((i * 7919) % n));
+  }
+
+  FlatVector<T> vec(ref); // Da TraversableContainer
+  ASSERT_EQ(vec.Size(), n);
+  ASSERT_FALSE(vec.Empty());
+  for (ulong i = 0; i < n; ++i) {
+    ASSERT_TRUE(vec[i] == ref[i]);
+  }
+  ASSERT_TRUE(vec.Front() == ref.Front());
+  ASSERT_TRUE(vec.Back() == ref.Back());
+  ASSERT_THROW(vec[n], std::out_of_range);
+  ASSERT_TRUE(vec.Exists(ref[5]));
+  ASSERT_EQ(vec.Span().size(), n);
+
+  // Visite in ordine e al contrario
+  ulong idx = 0;
+  bool ok = true;
+  vec.PreOrderTraverse([&](const T& val) { ok = ok && (val == ref[idx++]); });
+  vec.PostOrderTraverse([&](const T& val) { ok = ok && (val == ref[--idx]); });
+  ASSERT_TRUE(ok);
+  ASSERT_EQ(vec.template Fold<ulong>([](const T&, ulong acc) { return acc + 1; }, 0ul), n);
+
+  // Stesso ordinamento di SortableVector
+  ref.Sort();
+  vec.Sort();
+  for (ulong i = 0; i < n; ++i) {
+    ASSERT_TRUE(vec.UncheckedAt(i) == ref[i]);
+  }
+
+  // Copia, move, Resize e Clear
+  FlatVector<T> cpy(vec);
+  ASSERT_TRUE(cpy == vec);
+  cpy.Front() = cpy.Back();
+  ASSERT_TRUE(cpy != vec);
+  FlatVector<T> mvd(std::move(cpy));
+  ASSERT_EQ(cpy.Size(), 0ul);
+  ASSERT_EQ(mvd.Size(), n);
+  mvd.Resize(10);
+  ASSERT_EQ(mvd.Size(), 10ul);
+  ASSERT_TRUE(mvd[9] == vec[9]);
+  mvd.Clear();
+  ASSERT_TRUE(mvd.Empty());
+  ASSERT_THROW(mvd.Front(), std::length_error);
+  ASSERT_EQ(mvd.MemoryUsage().allocations, 0ul);
+
+  // Da MappableContainer e da un altro contenitore flat
+  Vector<T> src(ref);
+  FlatVector<T> frm(std::move(src));
+  ASSERT_TRUE(frm == vec);
+  FlatList<T> lst(vec);
+  ASSERT_TRUE(FlatVector<T>(lst) == vec);
+  ulong cnt = 0;
+  frm.PostOrderMap([&cnt](T& val) { val = MakeValue<T>(static_cast<int>(cnt++)); });
+  ASSERT_TRUE(frm.Back() == MakeValue<T>(0));
+}
+
+template <typename T>
+void TestFlatList() {
+  List<T> ref;
+  FlatList<T> lst;
+  for (int i = 0; i < 50; ++i) {
+    ref.InsertAtBack(MakeValue<T>(i));
+    lst.InsertAtBack(MakeValue<T>(i));
+    ref.InsertAtFront(MakeValue<T>(-i));
+    T val = MakeValue<T>(-i);
+    lst.InsertAtFront(std::move(val));
+  }
+  ASSERT_EQ(lst.Size(), ref.Size());
+  for (ulong i = 0; i < ref.Size(); ++i) {
+    ASSERT_TRUE(lst[i] == ref[i]);
+  }
+  ASSERT_THROW(lst[lst.Size()], std::out_of_range);
+
+  ulong idx = ref.Size();
+  bool ok = true;
+  lst.PostOrderTraverse([&](const T& val) { ok = ok && (val == ref[--idx]); });
+  ASSERT_TRUE(ok);
+
+  ASSERT_TRUE(lst.FrontNRemove() == ref.FrontNRemove());
+  ASSERT_TRUE(lst.BackNRemove() == ref.BackNRemove());
+  lst.RemoveFromBack();
+  ref.RemoveFromBack();
+  lst.RemoveFromFront();
+  ref.RemoveFromFront();
+  ASSERT_TRUE(lst.Front() == ref.Front());
+  ASSERT_TRUE(lst.Back() == ref.Back());
+  ASSERT_TRUE(lst.Exists(ref[10]));
+
+  FlatList<T> cpy(lst);
+  ASSERT_TRUE(cpy == lst);
+  cpy.Back() = cpy.Front();
+  ASSERT_TRUE(cpy != lst);
+  cpy = std::move(lst);
+  ASSERT_TRUE(FlatList<T>(ref) == cpy); // Da TraversableContainer
+  while (!cpy.Empty()) {
+    cpy.RemoveFromBack();
+  }
+  ASSERT_THROW(cpy.FrontNRemove(), std::length_error);
+  ASSERT_THROW(cpy.Back(), std::length_error);
+  cpy.InsertAtBack(MakeValue<T>(1));
+  ASSERT_TRUE(cpy.Front() == cpy.Back());
+}
+
+template <typename T>
+void CheckSorted(const FlatSetVec<T>& set) {
+  for (ulong i = 1; i < set.Size(); ++i) {
+    ASSERT_TRUE(set[i - 1] < set[i]);
+  }
+}
+
+// Stessa sequenza casuale di operazioni su FlatSetVec e SetVec
+template <typename T>
+void TestFlatSetVec() {
+  const int n = 300;
+  std::mt19937 gen(13);
+  SetVec<T> ref;
+  FlatSetVec<T> set;
+  for (int step = 0; step < 3000; ++step) {
+    T val = MakeValue<T>(static_cast<int>(gen() % n));
+    switch (gen() % 6) {
+      case 0:
+      case 1:
+        ASSERT_EQ(set.Insert(val), ref.Insert(val));
+        break;
+      case 2:
+        ASSERT_EQ(set.Remove(val), ref.Remove(val));
+        break;
+      case 3:
+        if (!ref.Empty()) {
+          ASSERT_TRUE(set.MinNRemove() == ref.MinNRemove());
+        }
+        break;
+      case 4:
+        if (ref.Size() > 1) {
+          ASSERT_TRUE(set.MaxNRemove() == ref.MaxNRemove());
+          ASSERT_TRUE(set.Min() == ref.Min());
+        }
+        break;
+      default:
+        ASSERT_EQ(set.Exists(val), ref.Exists(val));
+        try {
+          T pred = ref.Predecessor(val);
+          ASSERT_TRUE(set.Predecessor(val) == pred);
+        } catch (const std::length_error&) {
+          ASSERT_THROW(set.Predecessor(val), std::length_error);
+        }
+        try {
+          T succ = ref.Successor(val);
+          ASSERT_TRUE(set.Successor(val) == succ);
+        } catch (const std::length_error&) {
+          ASSERT_THROW(set.Successor(val), std::length_error);
+        }
+    }
+    ASSERT_EQ(set.Size(), ref.Size());
+  }
+  for (ulong i = 0; i < ref.Size(); ++i) {
+    ASSERT_TRUE(set[i] == ref[i]);
+  }
+  CheckSorted(set);
+
+  // Costruzione: ordina e toglie i duplicati
+  Vector<T> dup(6);
+  for (ulong i = 0; i < dup.Size(); ++i) {
+    dup[i] = MakeValue<T>(static_cast<int>(i % 3));
+  }
+  FlatSetVec<T> frm(dup);
+  ASSERT_EQ(frm.Size(), 3ul);
+  ASSERT_TRUE(frm == FlatSetVec<T>(SetVec<T>(dup)));
+  ASSERT_FALSE(frm.InsertAll(dup));
+  ASSERT_TRUE(frm.RemoveSome(FlatVector<T>(dup)));
+  ASSERT_TRUE(frm.Empty());
+  ASSERT_THROW(frm.Min(), std::length_error);
+  ASSERT_THROW(frm.RemoveMax(), std::length_error);
+
+  FlatSetVec<T> cpy(set);
+  ASSERT_TRUE(cpy == set);
+  cpy.Clear();
+  ASSERT_EQ(cpy.MemoryUsage().allocations, 0ul);
+  cpy = std::move(set);
+  ASSERT_EQ(cpy.Size(), ref.Size());
+}
+
+template <typename T>
+void TestFlatHeap() {
+  const ulong n = 150;
+  SortableVector<T> src(n);
+  for (ulong i = 0; i < n; ++i) {
+    src[i] = MakeValue<T>(static_cast<int>((i * 31) % 97));
+  }
+
+  FlatHeapVec<T> heap(src);
+  HeapVec<T> ref(src);
+  ASSERT_TRUE(heap.IsHeap());
+  ASSERT_TRUE(heap.Front() == ref.Front());
+  heap.Sort();
+  src.Sort();
+  for (ulong i = 0; i < n; ++i) {
+    ASSERT_TRUE(heap[i] == src[i]);
+  }
+  ASSERT_FALSE(heap.IsHeap() && n > 1 && src[0] != src[n - 1]);
+  heap.Heapify();
+  ASSERT_TRUE(heap.IsHeap());
+
+  // Coda con priorità: stessa sequenza su FlatPQHeap e PQHeap
+  std::mt19937 gen(7);
+  FlatPQHeap<T> pq;
+  PQHeap<T> pqr;
+  for (int step = 0; step < 2000; ++step) {
+    ulong op = gen() % 4;
+    if (op < 2 || pqr.Empty()) {
+      T val = MakeValue<T>(static_cast<int>(gen() % 500));
+      pq.Insert(val);
+      pqr.Insert(val);
+    } else if (op == 2) {
+      ASSERT_TRUE(pq.TipNRemove() == pqr.TipNRemove());
+    } else {
+      ulong idx = gen() % pq.Size();
+      T val = MakeValue<T>(static_cast<int>(gen() % 500));
+      pq.Change(idx, val);
+      pqr.Change(idx, val);
+    }
+    // Stessi confronti nello stesso ordine: anche la disposizione dello heap coincide
+    ASSERT_EQ(pq.Size(), pqr.Size());
+    ASSERT_TRUE(LinearAdapter(pq) == static_cast<const LinearContainer<T>&>(pqr));
+  }
+  ASSERT_THROW(FlatPQHeap<T>().Tip(), std::length_error);
+  ASSERT_THROW(pq.Change(pq.Size(), MakeValue<T>(0)), std::out_of_range);
+  while (!pq.Empty()) {
+    T tip = pq.TipNRemove();
+    ASSERT_TRUE(pq.Empty() || !(tip < pq.Tip()));
+  }
+  ASSERT_THROW(pq.RemoveTip(), std::length_error);
+}
+
+// Gli adattatori verso le interfacce polimorfe
+template <typename T>
+void TestFlatAdapters() {
+  FlatVector<T> vec(5);
+  for (ulong i = 0; i < vec.Size(); ++i) {
+    vec[i] = MakeValue<T>(static_cast<int>(4 - i));
+  }
+  LinearAdapter vad(vec);
+  Vector<T> cls(vad); // Costruttore da TraversableContainer
+  const LinearContainer<T>& lin = vad;
+  ASSERT_TRUE(lin == static_cast<const LinearContainer<T>&>(cls));
+  ASSERT_EQ(lin.Size(), 5ul);
+  ASSERT_TRUE(lin.Exists(MakeValue<T>(2)));
+  ASSERT_THROW(lin[5], std::out_of_range);
+
+  MutableLinearAdapter mut(vec);
+  MutableLinearContainer<T>& mlc = mut;
+  mlc[0] = MakeValue<T>(9);
+  ASSERT_TRUE(vec[0] == MakeValue<T>(9));
+  ulong cnt = 0;
+  mlc.Map([&cnt](T& val) { val = MakeValue<T>(static_cast<int>(cnt++)); });
+  ASSERT_TRUE(vec.Back() == MakeValue<T>(4));
+
+  FlatList<T> lst(vec);
+  MutableLinearAdapter lad(lst);
+  ASSERT_TRUE(static_cast<const LinearContainer<T>&>(lad) == lin);
+  SetVec<T> fromlst(lad);
+  ASSERT_EQ(fromlst.Size(), 5ul);
+
+  // Set: le operazioni di DictionaryContainer (InsertAll, ...) passano dall'adattatore
+  FlatSetVec<T> fset;
+  SetAdapter sad(fset);
+  Set<T>& set = sad;
+  ASSERT_TRUE(set.InsertAll(cls));
+  ASSERT_FALSE(set.InsertSome(cls));
+  ASSERT_TRUE(set.Min() == fset.Min());
+  set.RemoveMax();
+  ASSERT_EQ(fset.Size(), 4ul);
+  ASSERT_TRUE(set.Exists(fset[2]));
+  LinearAdapter fad(fset);
+  SetVec<T> back(fad);
+  ASSERT_TRUE(static_cast<const LinearContainer<T>&>(set) == static_cast<const LinearContainer<T>&>(back));
+
+  // PQ
+  FlatPQHeap<T> fpq(vec);
+  PQAdapter pad(fpq);
+  PQ<T>& pq = pad;
+  pq.Insert(MakeValue<T>(7));
+  ASSERT_TRUE(pq.Tip() == fpq.Tip());
+  ASSERT_EQ(pq.Size(), 6ul);
+  pq.Clear();
+  ASSERT_TRUE(fpq.Empty());
+}
+
+template <typename T>
+void RunFlatTests() {
+  TestFlatLayout<T>();
+  TestFlatVector<T>();
+  TestFlatList<T>();
+  TestFlatSetVec<T>();
+  TestFlatHeap<T>();
+  TestFlatAdapters<T>();
+  std::cout << "All flat tests passed for type: " << typeid(T).name() << "\n";
+}
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef TEST_MEMORY_HPP
+#define TEST_MEMORY_HPP
+#include <iostream>
+#include <string>
+#include <cassert>
+#include <cstdio>
+#include <type_traits>
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../vector/mapped/mappedvector.hpp"
+#include "../../list/list.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../set/lst/setlst.hpp"
+#include "../../set/btree/setbtree.hpp"
+#include "../../set/frozen/frozenset.hpp"
+#include "../../heap/vec/heapvec.hpp"
+#include "../../pq/heap/pqheap.hpp"
+
+using namespace lasd;
+
+// Controlli comuni: l'oggetto stesso è sempre contato, il payload è quello
+// degli elementi presenti
+template <typename T>
+void CheckMemory(const Container& con, ulong objsize) {
+  MemStats mem = con.MemoryUsage();
+  ASSERT_EQ(mem.payload, con.Size() * sizeof(T));
+  ASSERT_TRUE(mem.overhead >= objsize);
+  ASSERT_EQ(mem.Total(), mem.payload + mem.overhead + mem.slack);
+}
+
+template <typename T>
+void TestMemoryVector() {
+  Vector<T> vec;
+  MemStats mem = vec.MemoryUsage();
+  ASSERT_EQ(mem.payload, 0ul);
+  ASSERT_EQ(mem.overhead, sizeof(Vector<T>));
+  ASSERT_EQ(mem.allocations, 0ul);
+
+  vec.Resize(100);
+  mem = vec.MemoryUsage();
+  ASSERT_EQ(mem.payload, 100 * sizeof(T));
+  ASSERT_EQ(mem.slack, 0ul);
+  ASSERT_EQ(mem.allocations, 1ul);
+  vec.Clear();
+  ASSERT_EQ(vec.MemoryUsage().allocations, 0ul);
+
+  // Heap e coda con priorità: un solo blocco, senza capacità in eccesso
+  Vector<T> src(50);
+  for (ulong i = 0; i < 50; ++i) {
+    src[i] = MakeValue<T>(static_cast<int>(i));
+  }
+  HeapVec<T> heap(src);
+  CheckMemory<T>(heap, sizeof(HeapVec<T>));
+  ASSERT_EQ(heap.MemoryUsage().overhead, sizeof(HeapVec<T>));
+  ASSERT_EQ(heap.MemoryUsage().allocations, 1ul);
+  PQHeap<T> pq(src);
+  CheckMemory<T>(pq, sizeof(PQHeap<T>));
+  ASSERT_EQ(pq.MemoryUsage().overhead, sizeof(PQHeap<T>));
+}
+
+template <typename T>
+void TestMemoryLists() {
+  const ulong n = 100;
+  List<T> lst;
+  SetLst<T> set;
+  for (ulong i = 0; i < n; ++i) {
+    lst.InsertAtBack(MakeValue<T>(static_cast<int>(i)));
+    set.Insert(MakeValue<T>(static_cast<int>(i)));
+  }
+  // Un nodo per elemento, con almeno il puntatore next oltre all'elemento
+  for (const Container* con : {static_cast<const Container*>(&lst), static_cast<const Container*>(&set)}) {
+    CheckMemory<T>(*con, sizeof(List<T>));
+    MemStats mem = con->MemoryUsage();
+    ASSERT_EQ(mem.allocations, n);
+    ASSERT_EQ(mem.slack, 0ul);
+    ASSERT_TRUE(mem.overhead >= sizeof(List<T>) + n * sizeof(void*));
+  }
+  ASSERT_EQ(set.MemoryUsage().overhead - sizeof(SetLst<T>), lst.MemoryUsage().overhead - sizeof(List<T>));
+}
+
+template <typename T>
+void TestMemorySets() {
+  // SetVec: capacità raddoppiata, le posizioni libere sono slack
+  SetVec<T> set;
+  for (int i = 0; i < 5; ++i) {
+    set.Insert(MakeValue<T>(i));
+  }
+  CheckMemory<T>(set, sizeof(SetVec<T>));
+  ASSERT_EQ(set.MemoryUsage().slack, 3 * sizeof(T)); // capacità 8
+  ASSERT_EQ(set.MemoryUsage().allocations, 1ul);
+
+  // FrozenSet: la sola posizione 0 inutilizzata
+  FrozenSet<T> frz(set);
+  CheckMemory<T>(frz, sizeof(FrozenSet<T>));
+  ASSERT_EQ(frz.MemoryUsage().slack, sizeof(T));
+  ASSERT_EQ(FrozenSet<T>().MemoryUsage().allocations, 0ul);
+
+  // SetBTree: i nodi sono pieni almeno a metà
+  const ulong n = 2000;
+  SetBTree<T> btr;
+  for (ulong i = 0; i < n; ++i) {
+    btr.Insert(MakeValue<T>(static_cast<int>((i * 7919) % n)));
+  }
+  CheckMemory<T>(btr, sizeof(SetBTree<T>));
+  MemStats mem = btr.MemoryUsage();
+  ASSERT_TRUE(mem.allocations > 1 && mem.allocations <= n);
+  ASSERT_TRUE(mem.slack < mem.payload + mem.allocations * 2 * sizeof(T));
+  btr.Clear();
+  ASSERT_EQ(btr.MemoryUsage().allocations, 0ul);
+  ASSERT_EQ(btr.MemoryUsage().slack, 0ul);
+}
+
+template <typename T>
+void TestMemoryMapped() {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::string path = "/tmp/lasd_memory_int.bin";
+    Vector<T> vec(1000);
+    vec.Save(path);
+    MappedVector<T> map(path);
+    MemStats mem = map.MemoryUsage();
+    ASSERT_EQ(mem.payload, 1000 * sizeof(T));
+    ASSERT_EQ(mem.overhead, sizeof(MappedVector<T>) + sizeof(BinaryHeader));
+    ASSERT_EQ(mem.allocations, 1ul);
+    ASSERT_EQ((mem.payload + sizeof(BinaryHeader) + mem.slack) % 4096, 0ul);
+    std::remove(path.c_str());
+  }
+}
+
+template <typename T>
+void RunMemoryTests() {
+  TestMemoryVector<T>();
+  TestMemoryLists<T>();
+  TestMemorySets<T>();
+  TestMemoryMapped<T>();
+  std::cout << "All memory tests passed for type: " << typeid(T).name() << "\n";
+}
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef TEST_RANGES_HPP
+#define TEST_RANGES_HPP
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <ranges>
+#include <iterator>
+#include <random>
+#include <typeinfo>
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../set/lst/setlst.hpp"
+#include "../../heap/vec/heapvec.hpp"
+
+using namespace lasd;
+
+// Le categorie richieste dai concetti C++20 (verificate a tempo di compilazione)
+static_assert(std::contiguous_iterator<Vector<int>::iterator>);
+static_assert(std::ranges::contiguous_range<SortableVector<int>>);
+static_assert(std::ranges::sized_range<const Vector<int>>);
+static_assert(std::forward_iterator<List<int>::iterator>);
+static_assert(std::forward_iterator<List<int>::const_iterator>);
+static_assert(std::ranges::forward_range<List<std::string>>);
+static_assert(std::random_access_iterator<SetVec<int>::const_iterator>);
+static_assert(std::ranges::random_access_range<const SetVec<int>>);
+static_assert(std::ranges::forward_range<const SetLst<int>>);
+static_assert(std::ranges::contiguous_range<const HeapVec<int>>);
+static_assert(std::sortable<Vector<MyObject>::iterator>);
+static_assert(std::convertible_to<List<int>::iterator, List<int>::const_iterator>);
+
+template <typename T>
+void RunRangesTests() {
+  std::mt19937 gen(41);
+
+  // Vector: ranges::sort, lower_bound e transform direttamente sugli elementi
+  {
+    Vector<T> empty;
+    ASSERT_TRUE(empty.begin() == empty.end());
+    std::ranges::sort(empty);
+
+    const int n = 2000;
+    Vector<T> vec(n);
+    std::vector<T> ref;
+    for (int i = 0; i < n; ++i) {
+      vec[i] = MakeValue<T>(gen() % 500);
+      ref.push_back(vec[i]);
+    }
+    ASSERT_EQ(std::ranges::distance(vec), n);
+    std::ranges::sort(vec);
+    std::ranges::sort(ref);
+    ASSERT_TRUE(std::ranges::equal(vec, ref));
+    for (int v = -1; v <= 500; ++v) {
+      T key = MakeValue<T>(v);
+      ASSERT_EQ(std::ranges::lower_bound(vec, key) - vec.begin(), std::ranges::lower_bound(ref, key) - ref.begin());
+    }
+
+    Vector<T> out(n);
+    std::ranges::transform(vec, out.begin(), [](const T& val) { return val; });
+    ASSERT_TRUE(out == vec);
+    ulong cnt = 0;
+    for (T& val : vec) {
+      val = MakeValue<T>(cnt++);
+    }
+    ASSERT_EQ(cnt, vec.Size());
+    ASSERT_EQ(vec[n - 1], MakeValue<T>(n - 1));
+    const Vector<T>& cvec = vec;
+    ASSERT_TRUE(cvec.begin() == vec.begin() && cvec.cend() == vec.end());
+  }
+
+  // List: iteratori in avanti (mutabili e costanti), con viste e algoritmi
+  {
+    List<T> lst;
+    ASSERT_TRUE(lst.begin() == lst.end());
+    for (int i = 0; i < 300; ++i) {
+      lst.InsertAtBack(MakeValue<T>(i));
+    }
+    int i = 0;
+    for (const T& val : std::as_const(lst)) {
+      ASSERT_EQ(val, MakeValue<T>(i++));
+    }
+    ASSERT_EQ(i, 300);
+    ASSERT_EQ(std::ranges::distance(lst), 300);
+    auto it = std::ranges::find(lst, MakeValue<T>(150));
+    ASSERT_TRUE(it != lst.end());
+    *it = MakeValue<T>(1000);
+    ASSERT_EQ(lst[150], MakeValue<T>(1000));
+    typename List<T>::const_iterator cit = it;
+    ASSERT_TRUE(cit == std::ranges::next(lst.cbegin(), 150));
+    ASSERT_EQ(std::ranges::count_if(lst | std::views::take(100), [](const T& val) { return val < MakeValue<T>(50); }),
+              std::ranges::count_if(std::views::iota(0, 100), [](int v) { return MakeValue<T>(v) < MakeValue<T>(50); }));
+    auto post = lst.begin();
+    ASSERT_TRUE(post++ == lst.begin());
+    ASSERT_EQ(*post, MakeValue<T>(1));
+  }
+
+  // SetVec: ricerche e visite sul buffer circolare, anche dopo aver spostato head
+  {
+    SetVec<T> set;
+    ASSERT_TRUE(set.begin() == set.end());
+    for (int i = 0; i < 400; ++i) {
+      set.Insert(MakeValue<T>((i * 37) % 400));
+    }
+    for (int i = 0; i < 150; ++i) {
+      set.RemoveMin();
+    }
+    for (int i = 400; i < 460; ++i) {
+      set.Insert(MakeValue<T>(i));
+    }
+    std::vector<T> ref;
+    set.Traverse([&](const T& val) { ref.push_back(val); });
+    ASSERT_EQ(set.end() - set.begin(), static_cast<std::ptrdiff_t>(set.Size()));
+    ASSERT_TRUE(std::ranges::equal(set, ref));
+    ASSERT_TRUE(std::ranges::equal(set | std::views::reverse, ref | std::views::reverse));
+    ASSERT_TRUE(std::ranges::is_sorted(set));
+    for (ulong k = 0; k < set.Size(); ++k) {
+      ASSERT_EQ(set.begin()[k], set[k]);
+    }
+    for (const T& key : ref) {
+      auto pos = std::ranges::lower_bound(set, key);
+      ASSERT_TRUE(pos != set.end() && *pos == key);
+      ASSERT_TRUE(std::ranges::binary_search(set, key));
+    }
+    ASSERT_TRUE(std::ranges::lower_bound(set, MakeValue<T>(-1)) == set.begin());
+    auto fst = set.begin();
+    auto lst = set.end();
+    ASSERT_TRUE(fst < lst && lst > fst && fst + set.Size() == lst && lst - set.Size() == fst);
+    --lst;
+    ASSERT_EQ(*lst, set.Max());
+  }
+
+  // SetLst e HeapVec: visite in sola lettura
+  {
+    SetLst<T> set;
+    for (int i = 0; i < 200; ++i) {
+      set.Insert(MakeValue<T>((i * 7) % 200));
+    }
+    ASSERT_EQ(std::ranges::distance(set), 200);
+    ASSERT_TRUE(std::ranges::is_sorted(set));
+    ASSERT_TRUE(std::ranges::find(set, MakeValue<T>(199)) != set.end());
+    ASSERT_TRUE(std::ranges::find(set, MakeValue<T>(200)) == set.end());
+
+    Vector<T> vec(100);
+    for (int i = 0; i < 100; ++i) {
+      vec[i] = MakeValue<T>((i * 13) % 100);
+    }
+    HeapVec<T> heap(vec);
+    ASSERT_TRUE(std::ranges::is_heap(heap));
+    ASSERT_EQ(*std::ranges::max_element(heap), *heap.begin());
+    heap.Sort();
+    ASSERT_TRUE(std::ranges::is_sorted(heap));
+  }
+
+  std::cout << "All ranges tests passed for type: " << typeid(T).name() << "\n";
+}
+
+#endif
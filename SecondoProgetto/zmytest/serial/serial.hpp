@@ -0,0 +1,243 @@
+#ifndef TEST_SERIAL_HPP
+#define TEST_SERIAL_HPP
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+#include <cstdio>
+#include <algorithm>
+#include <type_traits>
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../vector/mapped/mappedvector.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../set/mapped/mappedsetvec.hpp"
+#include "../../heap/vec/heapvec.hpp"
+
+using namespace lasd;
+
+// Percorso di un file temporaneo per il tipo T
+template <typename T>
+std::string SerialPath(const std::string& name) {
+  return "/tmp/lasd_serial_" + name + (std::is_same_v<T, int> ? "_int.bin" : "_str.bin");
+}
+
+// Scrive un file lungo len byte con il contenuto di src troncato
+inline void TruncateCopy(const std::string& src, const std::string& dst, long len) {
+  std::FILE* in = std::fopen(src.c_str(), "rb");
+  std::FILE* out = std::fopen(dst.c_str(), "wb");
+  ASSERT_TRUE(in != nullptr && out != nullptr);
+  for (long i = 0; i < len; ++i) {
+    std::fputc(std::fgetc(in), out);
+  }
+  std::fclose(in);
+  std::fclose(out);
+}
+
+template <typename T>
+void TestSerialVector() {
+  std::string path = SerialPath<T>("vec");
+
+  // Andata e ritorno, anche con il vettore vuoto
+  for (ulong n : {0ul, 1ul, 1000ul}) {
+    Vector<T> vec(n);
+    for (ulong i = 0; i < n; ++i) {
+      vec[i] = MakeValue<T>(static_cast<int>((i * 7919) % 1000));
+    }
+    vec.Save(path);
+    Vector<T> res(3);
+    res.Load(path);
+    ASSERT_TRUE(res == vec);
+  }
+
+  // Errori: il vettore resta invariato
+  Vector<T> vec(4);
+  for (ulong i = 0; i < 4; ++i) {
+    vec[i] = MakeValue<T>(static_cast<int>(i));
+  }
+  Vector<T> old(vec);
+  ASSERT_THROW(vec.Load("/tmp/lasd_serial_missing.bin"), std::runtime_error);
+  ASSERT_TRUE(vec == old);
+
+  vec.Save(path);
+  TruncateCopy(path, path + ".cut", 40);
+  ASSERT_THROW(vec.Load(path + ".cut"), std::runtime_error);
+  TruncateCopy(path, path + ".cut", 10);
+  ASSERT_THROW(vec.Load(path + ".cut"), std::runtime_error);
+  ASSERT_TRUE(vec == old);
+  std::remove((path + ".cut").c_str());
+
+  // Tipo degli elementi diverso da quello salvato
+  if constexpr (std::is_same_v<T, int>) {
+    Vector<std::string> str;
+    ASSERT_THROW(str.Load(path), std::runtime_error);
+    Vector<double> dbl;
+    ASSERT_THROW(dbl.Load(path), std::runtime_error);
+  } else {
+    Vector<int> num;
+    ASSERT_THROW(num.Load(path), std::runtime_error);
+  }
+  std::remove(path.c_str());
+}
+
+template <typename T>
+void TestSerialSetVec() {
+  std::string path = SerialPath<T>("set");
+
+  // Buffer circolare: le rimozioni in testa spostano head
+  SetVec<T> set;
+  for (int i = 0; i < 40; ++i) {
+    set.Insert(MakeValue<T>(i));
+  }
+  for (int i = 0; i < 25; ++i) {
+    set.RemoveMin();
+  }
+  for (int i = 40; i < 60; ++i) {
+    set.Insert(MakeValue<T>(i));
+  }
+  set.Save(path);
+
+  SetVec<T> res;
+  res.Insert(MakeValue<T>(-1));
+  res.Load(path);
+  ASSERT_TRUE(res == set);
+  ASSERT_EQ(res.Min(), set.Min());
+  ASSERT_EQ(res.Max(), set.Max());
+  ASSERT_TRUE(res.Insert(MakeValue<T>(100)));
+  ASSERT_FALSE(res.Insert(set.Max()));
+  ASSERT_EQ(res.Size(), set.Size() + 1);
+
+  // Un vettore con chiavi ordinate è accettato, uno non ordinato no
+  Vector<T> vec(3);
+  vec[0] = MakeValue<T>(1);
+  vec[1] = MakeValue<T>(2);
+  vec[2] = MakeValue<T>(3);
+  if (!(vec[0] < vec[1] && vec[1] < vec[2])) {
+    std::swap(vec[0], vec[2]);
+  }
+  vec.Save(path);
+  res.Load(path);
+  ASSERT_EQ(res.Size(), 3ul);
+  std::swap(vec[0], vec[1]);
+  vec.Save(path);
+  SetVec<T> old(res);
+  ASSERT_THROW(res.Load(path), std::runtime_error);
+  ASSERT_TRUE(res == old);
+
+  // Insieme vuoto
+  SetVec<T> emp;
+  emp.Save(path);
+  res.Load(path);
+  ASSERT_TRUE(res.Empty());
+  ASSERT_TRUE(res.Insert(MakeValue<T>(5)));
+  ASSERT_TRUE(res.Exists(MakeValue<T>(5)));
+  std::remove(path.c_str());
+}
+
+template <typename T>
+void TestSerialHeapVec() {
+  std::string path = SerialPath<T>("heap");
+  Vector<T> vec(200);
+  for (ulong i = 0; i < 200; ++i) {
+    vec[i] = MakeValue<T>(static_cast<int>((i * 37) % 200));
+  }
+  HeapVec<T> heap(vec);
+  heap.Save(path);
+  HeapVec<T> res;
+  res.Load(path);
+  ASSERT_TRUE(res == heap);
+
+  // Un file che non è uno heap viene riordinato
+  vec.Save(path);
+  res.Load(path);
+  ASSERT_TRUE(res.IsHeap());
+  ASSERT_EQ(res.Size(), 200ul);
+  std::remove(path.c_str());
+}
+
+// Viste mappate (solo per tipi banalmente copiabili)
+inline void TestSerialMapped() {
+  std::string path = SerialPath<int>("map");
+  ASSERT_THROW(MappedVector<int>{"/tmp/lasd_serial_missing.bin"}, std::runtime_error);
+
+  Vector<int> vec(500);
+  for (ulong i = 0; i < 500; ++i) {
+    vec[i] = static_cast<int>(500 - i);
+  }
+  vec.Save(path);
+  {
+    MappedVector<int> map(path);
+    ASSERT_EQ(map.Tag(), 'V');
+    ASSERT_TRUE(std::equal(map.begin(), map.end(), vec.begin(), vec.end()));
+    ASSERT_EQ(map.Front(), 500);
+    ASSERT_EQ(map.Back(), 1);
+    ASSERT_THROW(map[500], std::out_of_range);
+    ulong idx = 500;
+    map.PostOrderTraverse([&idx](const int& dat) { ASSERT_EQ(dat, static_cast<int>(501 - idx--)); });
+    ASSERT_EQ(map.Fold<long>([](const int& dat, const long& acc) { return acc + dat; }, 0), 125250l);
+    ASSERT_THROW(MappedSetVec<int>{path}, std::runtime_error);
+    ASSERT_THROW(MappedVector<double>{path}, std::runtime_error);
+
+    MappedVector<int> mov(std::move(map));
+    ASSERT_TRUE(map.Empty());
+    ASSERT_EQ(mov.Size(), 500ul);
+    ASSERT_EQ(*(mov.end() - 1), 1);
+  }
+
+  // Insieme ordinato (con buffer circolare)
+  SetVec<int> set;
+  for (int i = 0; i < 300; i += 3) {
+    set.Insert(i);
+  }
+  for (int i = 0; i < 30; ++i) {
+    set.RemoveMin();
+  }
+  for (int i = 300; i < 330; i += 3) {
+    set.Insert(i);
+  }
+  set.Save(path);
+  {
+    MappedSetVec<int> map(path);
+    ASSERT_EQ(map.Size(), set.Size());
+    ASSERT_EQ(map.Min(), set.Min());
+    ASSERT_EQ(map.Max(), set.Max());
+    for (int v = 80; v <= 340; ++v) {
+      ASSERT_EQ(map.Exists(v), set.Exists(v));
+      if (v > set.Min()) {
+        ASSERT_EQ(map.Predecessor(v), set.Predecessor(v));
+      } else {
+        ASSERT_THROW(map.Predecessor(v), std::length_error);
+      }
+      if (v < set.Max()) {
+        ASSERT_EQ(map.Successor(v), set.Successor(v));
+      } else {
+        ASSERT_THROW(map.Successor(v), std::length_error);
+      }
+    }
+  }
+
+  SetVec<int> emp;
+  emp.Save(path);
+  {
+    MappedSetVec<int> map(path);
+    ASSERT_TRUE(map.Empty());
+    ASSERT_FALSE(map.Exists(0));
+    ASSERT_THROW(map.Min(), std::length_error);
+    ASSERT_THROW(map.Successor(0), std::length_error);
+  }
+  std::remove(path.c_str());
+}
+
+template <typename T>
+void RunSerialTests() {
+  TestSerialVector<T>();
+  TestSerialSetVec<T>();
+  TestSerialHeapVec<T>();
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    TestSerialMapped();
+  }
+  std::cout << "All serialization tests passed for type: " << typeid(T).name() << "\n";
+}
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef TEST_FROZENSET_HPP
+#define TEST_FROZENSET_HPP
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+#include <typeinfo>
+#include <random>
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../set/frozen/frozenset.hpp"
+
+using namespace lasd;
+
+// Confronta FrozenSet con il SetVec da cui è costruito, su chiavi presenti e assenti
+template <typename T>
+void CheckFrozenAgainstSetVec(const SetVec<T>& src, int range) {
+  FrozenSet<T> frz(src);
+  ASSERT_EQ(frz.Size(), src.Size());
+
+  ulong i = 0;
+  frz.Traverse([&](const T& val) { ASSERT_EQ(val, src[i++]); });
+  ASSERT_EQ(i, src.Size());
+
+  if (src.Size() == 0) {
+    ASSERT_TRUE(frz.Empty());
+    ASSERT_THROW(frz.Min(), std::length_error);
+    ASSERT_THROW(frz.Max(), std::length_error);
+    ASSERT_THROW(frz.Predecessor(MakeValue<T>(0)), std::length_error);
+    ASSERT_THROW(frz.Successor(MakeValue<T>(0)), std::length_error);
+    ASSERT_FALSE(frz.Exists(MakeValue<T>(0)));
+    return;
+  }
+  ASSERT_EQ(frz.Min(), src.Min());
+  ASSERT_EQ(frz.Max(), src.Max());
+
+  for (int v = -1; v <= range; ++v) {
+    T val = MakeValue<T>(v);
+    ASSERT_EQ(frz.Exists(val), src.Exists(val));
+
+    bool hasPred = true, hasSucc = true;
+    T pred{}, succ{};
+    try { pred = src.Predecessor(val); } catch (const std::length_error&) { hasPred = false; }
+    try { succ = src.Successor(val); } catch (const std::length_error&) { hasSucc = false; }
+    if (hasPred) {
+      ASSERT_EQ(frz.Predecessor(val), pred);
+    } else {
+      ASSERT_THROW(frz.Predecessor(val), std::length_error);
+    }
+    if (hasSucc) {
+      ASSERT_EQ(frz.Successor(val), succ);
+    } else {
+      ASSERT_THROW(frz.Successor(val), std::length_error);
+    }
+  }
+}
+
+template <typename T>
+void RunFrozenSetTests() {
+  // Tutte le forme dell'albero implicito fino a 70 chiavi (solo valori pari)
+  for (int n = 0; n <= 70; ++n) {
+    SetVec<T> src;
+    for (int i = 0; i < n; ++i) {
+      src.Insert(MakeValue<T>(2 * i));
+    }
+    CheckFrozenAgainstSetVec(src, 2 * n + 1);
+  }
+
+  // Chiavi casuali
+  {
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<int> dist(0, 3000);
+    SetVec<T> src;
+    for (int i = 0; i < 1000; ++i) {
+      src.Insert(MakeValue<T>(dist(gen)));
+    }
+    CheckFrozenAgainstSetVec(src, 3000);
+  }
+
+  // Copia, move, confronto
+  {
+    SetVec<T> src;
+    for (int i = 0; i < 10; ++i) {
+      src.Insert(MakeValue<T>(i));
+    }
+    FrozenSet<T> frz(src);
+    FrozenSet<T> cpy(frz);
+    ASSERT_TRUE(cpy == frz);
+    FrozenSet<T> mov(std::move(cpy));
+    ASSERT_TRUE(mov == frz);
+    ASSERT_TRUE(cpy.Empty());
+    ASSERT_TRUE(cpy != frz);
+    cpy = frz;
+    ASSERT_TRUE(cpy == frz);
+    cpy = FrozenSet<T>();
+    ASSERT_TRUE(cpy.Empty());
+    ASSERT_TRUE(frz.Exists(MakeValue<T>(9)));
+  }
+
+  // Da un Vector: deve essere strettamente crescente
+  {
+    Vector<T> vec(3);
+    vec[0] = MakeValue<T>(1);
+    vec[1] = MakeValue<T>(1);
+    vec[2] = MakeValue<T>(2);
+    ASSERT_THROW(FrozenSet<T>{vec}, std::invalid_argument);
+    vec[1] = MakeValue<T>(0);
+    ASSERT_THROW(FrozenSet<T>{vec}, std::invalid_argument);
+    vec[0] = MakeValue<T>(0);
+    vec[1] = MakeValue<T>(1);
+    FrozenSet<T> frz(vec);
+    ASSERT_EQ(frz.Size(), 3);
+    ASSERT_EQ(frz.Successor(MakeValue<T>(1)), MakeValue<T>(2));
+  }
+
+  std::cout << "All FrozenSet tests passed for type: " << typeid(T).name() << "\n";
+}
+
+#endif
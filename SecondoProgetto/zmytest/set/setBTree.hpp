@@ -0,0 +1,198 @@
+#ifndef TEST_SETBTREE_HPP
+#define TEST_SETBTREE_HPP
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+#include <typeinfo>
+#include <random>
+#include <set>
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
+#include "../../set/btree/setbtree.hpp"
+
+using namespace lasd;
+
+// Confronta SetBTree con std::set: visite, accesso per indice, Min/Max,
+// Exists e Predecessor/Successor su chiavi presenti e assenti
+template <typename T>
+void CheckBTreeAgainstStdSet(const SetBTree<T>& bt, const std::set<T>& ref, int range) {
+  ASSERT_EQ(bt.Size(), ref.size());
+
+  auto it = ref.begin();
+  bt.Traverse([&](const T& val) { ASSERT_TRUE(it != ref.end() && val == *it); ++it; });
+  ASSERT_TRUE(it == ref.end());
+  auto rit = ref.rbegin();
+  bt.PostOrderTraverse([&](const T& val) { ASSERT_TRUE(rit != ref.rend() && val == *rit); ++rit; });
+  ASSERT_TRUE(rit == ref.rend());
+
+  ulong i = 0;
+  for (const T& val : ref) {
+    ASSERT_EQ(bt[i++], val);
+  }
+  ASSERT_THROW(bt[i], std::out_of_range);
+
+  if (ref.empty()) {
+    ASSERT_TRUE(bt.Empty());
+    ASSERT_THROW(bt.Min(), std::length_error);
+    ASSERT_THROW(bt.Max(), std::length_error);
+    ASSERT_THROW(bt.Predecessor(MakeValue<T>(0)), std::length_error);
+    ASSERT_THROW(bt.Successor(MakeValue<T>(0)), std::length_error);
+    return;
+  }
+  ASSERT_EQ(bt.Min(), *ref.begin());
+  ASSERT_EQ(bt.Max(), *ref.rbegin());
+
+  for (int v = -1; v <= range; ++v) {
+    T val = MakeValue<T>(v);
+    ASSERT_EQ(bt.Exists(val), ref.count(val) == 1);
+    auto succ = ref.upper_bound(val);
+    if (succ != ref.end()) {
+      ASSERT_EQ(bt.Successor(val), *succ);
+    } else {
+      ASSERT_THROW(bt.Successor(val), std::length_error);
+    }
+    auto pred = ref.lower_bound(val);
+    if (pred != ref.begin()) {
+      ASSERT_EQ(bt.Predecessor(val), *(--pred));
+    } else {
+      ASSERT_THROW(bt.Predecessor(val), std::length_error);
+    }
+  }
+}
+
+template <typename T>
+void RunSetBTreeTests() {
+  // Inserimenti e rimozioni casuali: split, prestiti e fusioni a più livelli
+  {
+    std::mt19937 gen(37);
+    const int range = 5000;
+    std::uniform_int_distribution<int> dist(0, range - 1);
+    SetBTree<T> bt;
+    std::set<T> ref;
+    for (int step = 1; step <= 30000; ++step) {
+      T val = MakeValue<T>(dist(gen));
+      // Prima prevalgono gli inserimenti, poi le rimozioni (fino a svuotare quasi tutto)
+      bool ins = (gen() % 100) < ((step <= 15000) ? 70u : 25u);
+      if (ins) {
+        ASSERT_EQ(bt.Insert(val), ref.insert(val).second);
+      } else {
+        ASSERT_EQ(bt.Remove(val), ref.erase(val) == 1);
+      }
+      if (step % 5000 == 0) {
+        CheckBTreeAgainstStdSet(bt, ref, range);
+      }
+    }
+    bt.Clear();
+    ref.clear();
+    CheckBTreeAgainstStdSet(bt, ref, 10);
+  }
+
+  // Rimozioni di minimo, massimo, predecessore e successore fino allo svuotamento
+  {
+    SetBTree<T> bt;
+    std::set<T> ref;
+    for (int i = 0; i < 2000; ++i) {
+      T val = MakeValue<T>((i * 7919) % 2000);
+      ASSERT_TRUE(bt.Insert(val));
+      ref.insert(val);
+    }
+    ASSERT_FALSE(bt.Insert(MakeValue<T>(5)));
+    for (int i = 0; !ref.empty(); ++i) {
+      T key = MakeValue<T>((i * 104729) % 2000);
+      switch (i % 6) {
+        case 0: ASSERT_EQ(bt.MinNRemove(), *ref.begin()); ref.erase(ref.begin()); break;
+        case 1: ASSERT_EQ(bt.MaxNRemove(), *ref.rbegin()); ref.erase(--ref.end()); break;
+        case 2: bt.RemoveMin(); ref.erase(ref.begin()); break;
+        case 3: bt.RemoveMax(); ref.erase(--ref.end()); break;
+        case 4: {
+          auto succ = ref.upper_bound(key);
+          if (succ != ref.end()) {
+            ASSERT_EQ(bt.SuccessorNRemove(key), *succ);
+            ref.erase(succ);
+          } else {
+            ASSERT_THROW(bt.RemoveSuccessor(key), std::length_error);
+          }
+          break;
+        }
+        default: {
+          auto pred = ref.lower_bound(key);
+          if (pred != ref.begin()) {
+            --pred;
+            ASSERT_EQ(bt.PredecessorNRemove(key), *pred);
+            ref.erase(pred);
+          } else {
+            ASSERT_THROW(bt.RemovePredecessor(key), std::length_error);
+          }
+          break;
+        }
+      }
+      ASSERT_EQ(bt.Size(), ref.size());
+    }
+    CheckBTreeAgainstStdSet(bt, ref, 10);
+    ASSERT_THROW(bt.MinNRemove(), std::length_error);
+    ASSERT_THROW(bt.RemoveMax(), std::length_error);
+  }
+
+  // Caricamento in blocco da input ordinato (con duplicati) e non ordinato
+  for (int n : {0, 1, 7, 64, 65, 300, 4200, 9000}) {
+    std::set<T> ref;
+    SortableVector<T> vec(2 * n);
+    for (int i = 0; i < 2 * n; ++i) {
+      vec[i] = MakeValue<T>(i / 2);
+      ref.insert(vec[i]);
+    }
+    if (n > 0) {
+      vec.Sort();
+    }
+    SetBTree<T> sorted(vec);
+    CheckBTreeAgainstStdSet(sorted, ref, n);
+
+    List<T> lst;
+    for (int i = n - 1; i >= 0; --i) {
+      lst.InsertAtBack(MakeValue<T>(i));
+    }
+    SetBTree<T> unsorted(std::move(lst));
+    CheckBTreeAgainstStdSet(unsorted, ref, n);
+    ASSERT_TRUE(sorted == unsorted);
+
+    // Un albero caricato in blocco deve restare valido dopo modifiche
+    for (int i = 0; i < n; i += 3) {
+      ASSERT_TRUE(sorted.Remove(MakeValue<T>(i)));
+      ref.erase(MakeValue<T>(i));
+    }
+    ASSERT_TRUE(sorted.Insert(MakeValue<T>(n)));
+    ref.insert(MakeValue<T>(n));
+    CheckBTreeAgainstStdSet(sorted, ref, n + 1);
+    ASSERT_TRUE(sorted != unsorted || n == 0);
+  }
+
+  // Copia, move, confronto
+  {
+    SetBTree<T> bt;
+    for (int i = 0; i < 1000; ++i) {
+      bt.Insert(MakeValue<T>(i));
+    }
+    SetBTree<T> cpy(bt);
+    ASSERT_TRUE(cpy == bt);
+    SetBTree<T> mov(std::move(cpy));
+    ASSERT_TRUE(mov == bt);
+    ASSERT_TRUE(cpy.Empty());
+    ASSERT_TRUE(cpy != bt);
+    cpy = bt;
+    ASSERT_TRUE(cpy == bt);
+    cpy.Remove(MakeValue<T>(500));
+    ASSERT_TRUE(cpy != bt);
+    ASSERT_TRUE(bt.Exists(MakeValue<T>(500)));
+    cpy = SetBTree<T>();
+    ASSERT_TRUE(cpy.Empty());
+    ASSERT_TRUE(cpy.Insert(MakeValue<T>(1)));
+    ASSERT_EQ(cpy.Min(), MakeValue<T>(1));
+  }
+
+  std::cout << "All SetBTree tests passed for type: " << typeid(T).name() << "\n";
+}
+
+#endif
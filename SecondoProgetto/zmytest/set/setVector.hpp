@@ -6,10 +6,12 @@
 #include <cassert>
 #include <typeinfo> // Necessario per typeid
 #include <random>   // Per i test con numeri casuali
+#include <utility> // Per std::as_const
 #include "../util/test_utils.hpp"
 #include "../../vector/vector.hpp"
 #include "../../set/vec/setvec.hpp"
 #include <set> // Per std::set nei test con valori unici
+#include <vector>
 
 using namespace lasd;
 
@@ -204,6 +206,94 @@ void RunSetVecTests()
     ASSERT_EQ(set2[2], MakeValue<T>(3));
 
   }
+  // Union / Intersect / Difference confrontati con std::set
+  {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> dist(0, 300);
+    SetVec<T> a, b;
+    std::set<T> sa, sb;
+    for (int i = 0; i < 200; ++i) {
+      T va = MakeValue<T>(dist(gen));
+      T vb = MakeValue<T>(dist(gen));
+      a.Insert(va); sa.insert(va);
+      b.Insert(vb); sb.insert(vb);
+    }
+    // head != 0: il buffer circolare è "ruotato"
+    sa.erase(a.MinNRemove());
+    sa.erase(a.MinNRemove());
+
+    auto check = [](const SetVec<T>& res, const std::set<T>& exp) {
+      ASSERT_EQ(res.Size(), exp.size());
+      ulong i = 0;
+      for (const T& val : exp) {
+        ASSERT_EQ(res[i++], val);
+      }
+    };
+
+    std::set<T> su(sa), si, sd;
+    su.insert(sb.begin(), sb.end());
+    for (const T& val : sa) {
+      if (sb.count(val)) si.insert(val);
+      else sd.insert(val);
+    }
+
+    SetVec<T> res;
+    a.Union(b, res);
+    check(res, su);
+    a.Intersect(b, res); // riusa il buffer già allocato
+    check(res, si);
+    a.Difference(b, res);
+    check(res, sd);
+    ASSERT_TRUE(res.Insert(MakeValue<T>(1000)));
+    ASSERT_TRUE(res.Exists(MakeValue<T>(1000)));
+
+    SetVec<T> empty;
+    a.Intersect(empty, res);
+    ASSERT_EQ(res.Size(), 0);
+    empty.Union(b, res);
+    check(res, sb);
+    empty.Difference(b, res);
+    ASSERT_EQ(res.Size(), 0);
+
+    // Risultato coincidente con un operando
+    SetVec<T> c(a);
+    c.Union(b, c);
+    check(c, su);
+    c = a;
+    b.Difference(c, c);
+    std::set<T> sbd;
+    for (const T& val : sb) {
+      if (!sa.count(val)) sbd.insert(val);
+    }
+    check(c, sbd);
+  }
+
+  // Accesso non controllato e tratti contigui, con il buffer circolare spezzato
+  {
+    SetVec<T> set;
+    for (int i = 0; i < 8; ++i) {
+      set.Insert(MakeValue<T>(i));
+    }
+    set.RemoveMin();
+    set.RemoveMin();
+    set.Insert(MakeValue<T>(8)); // head = 2: gli ultimi elementi tornano all'inizio del buffer
+    set.Insert(MakeValue<T>(9));
+    auto [fst, snd] = set.Spans();
+    ASSERT_EQ(fst.size() + snd.size(), set.Size());
+    ASSERT_TRUE(snd.size() > 0);
+    std::vector<T> pre, post;
+    set.PreOrderTraverse([&pre](const T& val) { pre.push_back(val); });
+    set.PostOrderTraverse([&post](const T& val) { post.push_back(val); });
+    ASSERT_EQ(pre.size(), set.Size());
+    for (ulong i = 0; i < set.Size(); ++i) {
+      ASSERT_TRUE(std::as_const(set).UncheckedAt(i) == set[i]);
+      ASSERT_TRUE(pre[i] == set[i]);
+      ASSERT_TRUE(post[set.Size() - 1 - i] == set[i]);
+      ASSERT_TRUE(((i < fst.size()) ? fst[i] : snd[i - fst.size()]) == set[i]);
+    }
+    ASSERT_THROW(set[set.Size()], std::out_of_range);
+  }
+
   std::cout << "All SetVec tests passed for type: " << typeid(T).name() << "\n";
 }
 
@@ -0,0 +1,122 @@
+#ifndef TEST_STATS_HPP
+#define TEST_STATS_HPP
+#include <iostream>
+#include <string>
+#include <cassert>
+#include <type_traits>
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../heap/vec/heapvec.hpp"
+#include "../../pq/heap/pqheap.hpp"
+#include "../../stats/stats.hpp"
+
+using namespace lasd;
+
+// Senza LASD_STATS i contatori restano a zero e non occupano spazio;
+// con LASD_STATS (make stats=1) si controllano i valori attesi.
+constexpr bool StatsOn = StatsPolicy::Enabled;
+
+template <typename T>
+void TestStatsVector() {
+  Vector<T> vec(10);
+  ASSERT_TRUE(vec.Stats() == OpStats());
+  vec.Resize(20);
+  OpStats sts = vec.Stats();
+  ASSERT_EQ(sts.resizes, StatsOn ? 1ul : 0ul);
+  ASSERT_EQ(sts.allocations, StatsOn ? 1ul : 0ul);
+  ASSERT_EQ(sts.moves, StatsOn ? 30ul : 0ul); // dieci scambi
+  vec.Resize(20); // stessa dimensione: nessun lavoro
+  ASSERT_TRUE(vec.Stats() == sts);
+
+  // La copia conta le sue copie; l'originale non cambia
+  Vector<T> cpy(vec);
+  ASSERT_EQ(cpy.Stats().copies, StatsOn ? 20ul : 0ul);
+  ASSERT_EQ(cpy.Stats().resizes, 0ul);
+  ASSERT_TRUE(vec.Stats() == sts);
+
+  vec.ResetStats();
+  ASSERT_TRUE(vec.Stats() == OpStats());
+}
+
+template <typename T>
+void TestStatsSetVec() {
+  const ulong n = 64;
+  SetVec<T> set;
+  for (ulong i = 0; i < n; ++i) {
+    T val = MakeValue<T>(static_cast<int>((i * 37) % n));
+    set.Insert(val);
+  }
+  OpStats sts = set.Stats();
+  if constexpr (StatsOn) {
+    ASSERT_EQ(sts.resizes, 7ul);            // capacità 1, 2, 4, ..., 64
+    ASSERT_EQ(sts.allocations, 7ul);
+    ASSERT_EQ(sts.copies, 63ul + n);        // ridimensionamenti e inserimenti
+    ASSERT_TRUE(sts.comparisons > 2 * n);   // ricerca in Exists e di nuovo per la posizione
+    ASSERT_TRUE(sts.comparisons < 4 * n * 7);
+  } else {
+    ASSERT_TRUE(sts == OpStats());
+  }
+
+  // Ricerche e rimozioni di elementi assenti non spostano nulla
+  set.ResetStats();
+  ASSERT_FALSE(set.Exists(MakeValue<T>(static_cast<int>(n))));
+  ASSERT_FALSE(set.Remove(MakeValue<T>(static_cast<int>(n))));
+  ASSERT_EQ(set.Stats().moves + set.Stats().copies, 0ul);
+  ASSERT_EQ(set.Stats().comparisons > 0, StatsOn);
+
+  // Rimuovere il minimo sposta tutti gli altri
+  set.ResetStats();
+  set.Remove(set.Min());
+  ASSERT_EQ(set.Stats().moves, StatsOn ? n - 1 : 0ul);
+
+  // La copia conta la copia del vettore di supporto (capacità 64)
+  SetVec<T> cpy(set);
+  ASSERT_EQ(cpy.Stats().copies, StatsOn ? 64ul : 0ul);
+  ASSERT_EQ(cpy.Stats().allocations, StatsOn ? 1ul : 0ul);
+}
+
+template <typename T>
+void TestStatsHeap() {
+  const ulong n = 1000;
+  Vector<T> vec(n);
+  for (ulong i = 0; i < n; ++i) {
+    vec[i] = MakeValue<T>(static_cast<int>(i));
+  }
+
+  // Heapify: al più n scambi e 2n confronti
+  HeapVec<T> heap(vec);
+  OpStats sts = heap.Stats();
+  ASSERT_EQ(sts.comparisons > 0, StatsOn);
+  ASSERT_TRUE(sts.comparisons <= 2 * n);
+  ASSERT_TRUE(sts.moves <= 3 * n);
+  heap.ResetStats();
+  heap.Sort();
+  ASSERT_EQ(heap.Stats().comparisons > n, StatsOn);
+  ASSERT_TRUE(heap.Stats().comparisons <= 2 * n * 10 + 2 * n);
+
+  // PQHeap: ogni inserimento e ogni rimozione ridimensiona il vettore
+  PQHeap<T> pq;
+  for (ulong i = 0; i < 100; ++i) {
+    T val = MakeValue<T>(static_cast<int>(i));
+    pq.Insert(val);
+  }
+  ASSERT_EQ(pq.Stats().copies, StatsOn ? 100ul : 0ul);
+  ASSERT_EQ(pq.Stats().resizes, StatsOn ? 100ul : 0ul);
+  pq.ResetStats();
+  pq.RemoveTip();
+  ASSERT_EQ(pq.Stats().resizes, StatsOn ? 1ul : 0ul);
+  ASSERT_EQ(pq.Stats().comparisons > 0, StatsOn);
+}
+
+template <typename T>
+void RunStatsTests() {
+  static_assert(std::is_empty_v<NoStats>);
+  TestStatsVector<T>();
+  TestStatsSetVec<T>();
+  TestStatsHeap<T>();
+  std::cout << "All stats tests passed for type: " << typeid(T).name() << "\n";
+}
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef TEST_STREAM_HPP
+#define TEST_STREAM_HPP
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <cassert>
+#include <algorithm>
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../set/vec/setvec.hpp"
+#include "../../heap/vec/heapvec.hpp"
+#include "../../stream/stream.hpp"
+
+using namespace lasd;
+
+// Generatore di n valori pseudo-casuali in [0, range) (con ripetizioni)
+template <typename T>
+auto MakeGenerator(ulong n, int range) {
+  return [n, range, i = 0ul](T& dat) mutable {
+    if (i == n) return false;
+    dat = MakeValue<T>(static_cast<int>((i++ * 7919) % range));
+    return true;
+  };
+}
+
+// Generatore che lancia un'eccezione dopo n valori
+template <typename T>
+auto MakeFailingGenerator(ulong n) {
+  return [n, i = 0ul](T& dat) mutable {
+    if (i == n) throw std::runtime_error("source failure");
+    dat = MakeValue<T>(static_cast<int>(i++));
+    return true;
+  };
+}
+
+template <typename T>
+void TestStreamBuild() {
+  // Vector: con suggerimento esatto, troppo piccolo, assente
+  for (ulong n : {0ul, 1ul, 16ul, 17ul, 5000ul}) {
+    Vector<T> exp(n);
+    auto gen = MakeGenerator<T>(n, 1000);
+    for (ulong i = 0; i < n; ++i) {
+      gen(exp[i]);
+    }
+    for (ulong hint : {0ul, n, n / 3}) {
+      Vector<T> vec(2);
+      vec.Build(MakeGenerator<T>(n, 1000), hint);
+      ASSERT_TRUE(vec == exp);
+    }
+  }
+
+  // SetVec: stesso risultato degli inserimenti uno alla volta
+  for (int range : {1, 37, 2000}) {
+    SetVec<T> exp;
+    auto gen = MakeGenerator<T>(3000, range);
+    T dat;
+    while (gen(dat)) {
+      exp.Insert(dat);
+    }
+    SetVec<T> set;
+    set.Insert(MakeValue<T>(-5));
+    set.Build(MakeGenerator<T>(3000, range));
+    ASSERT_TRUE(set == exp);
+    ASSERT_EQ(set.Min(), exp.Min());
+    ASSERT_EQ(set.Max(), exp.Max());
+    ASSERT_TRUE(set.Insert(MakeValue<T>(-1)));
+    ASSERT_FALSE(set.Insert(exp.Max()));
+    ASSERT_TRUE(set.Remove(exp.Min()));
+  }
+  SetVec<T> emp;
+  emp.Build(MakeGenerator<T>(0, 1));
+  ASSERT_TRUE(emp.Empty());
+  ASSERT_TRUE(emp.Insert(MakeValue<T>(1)));
+
+  // HeapVec
+  HeapVec<T> heap;
+  heap.Build(MakeGenerator<T>(1000, 500), 1000);
+  ASSERT_EQ(heap.Size(), 1000ul);
+  ASSERT_TRUE(heap.IsHeap());
+  heap.Sort();
+  ASSERT_TRUE(std::is_sorted(heap.begin(), heap.end()));
+
+  // Una sorgente che fallisce lascia il contenitore invariato
+  Vector<T> vec(3);
+  vec[0] = MakeValue<T>(7);
+  Vector<T> old(vec);
+  ASSERT_THROW(vec.Build(MakeFailingGenerator<T>(100)), std::runtime_error);
+  ASSERT_TRUE(vec == old);
+  SetVec<T> set(vec);
+  SetVec<T> oldset(set);
+  ASSERT_THROW(set.Build(MakeFailingGenerator<T>(10), 5), std::runtime_error);
+  ASSERT_TRUE(set == oldset);
+}
+
+// Testo (solo tipi numerici)
+inline void TestStreamText() {
+  std::istringstream str(" 12\t-7\n+3   0\n\n-2147483648 2147483647  ");
+  Vector<int> vec;
+  vec.Build(TextSource<int>(str));
+  ASSERT_EQ(vec.Size(), 6ul);
+  ASSERT_EQ(vec[0], 12);
+  ASSERT_EQ(vec[1], -7);
+  ASSERT_EQ(vec[2], 3);
+  ASSERT_EQ(vec[4], -2147483648);
+  ASSERT_EQ(vec[5], 2147483647);
+
+  // Blocchi piccoli: molti numeri spezzati tra due blocchi, e uno più lungo di un blocco
+  std::string txt;
+  for (int i = 0; i < 3000; ++i) {
+    txt += std::to_string(i * 131 - 100000) + ((i % 7 == 0) ? "\n" : " ");
+  }
+  txt += std::string(100, '0') + "5";
+  std::istringstream big(txt);
+  TextSource<long> src(big, 64);
+  Vector<long> lng;
+  lng.Build(src);
+  ASSERT_EQ(lng.Size(), 3001ul);
+  for (ulong i = 0; i < 3000; ++i) {
+    ASSERT_EQ(lng[i], static_cast<long>(i) * 131 - 100000);
+  }
+  ASSERT_EQ(lng[3000], 5l);
+
+  std::istringstream dbl("0.5 -1e3 2.25\n");
+  SetVec<double> set;
+  set.Build(TextSource<double>(dbl));
+  ASSERT_EQ(set.Size(), 3ul);
+  ASSERT_EQ(set.Min(), -1000.0);
+  ASSERT_EQ(set.Max(), 2.25);
+
+  // Testo non valido e fuori intervallo: il contenitore resta invariato
+  Vector<int> old(vec);
+  std::istringstream bad("1 2x 3");
+  ASSERT_THROW(vec.Build(TextSource<int>(bad)), std::invalid_argument);
+  std::istringstream ovf("1 99999999999");
+  ASSERT_THROW(vec.Build(TextSource<int>(ovf)), std::invalid_argument);
+  std::istringstream sgn("- 4");
+  ASSERT_THROW(vec.Build(TextSource<int>(sgn)), std::invalid_argument);
+  ASSERT_TRUE(vec == old);
+
+  std::istringstream emp(" \n\t ");
+  vec.Build(TextSource<int>(emp));
+  ASSERT_TRUE(vec.Empty());
+}
+
+// Record binari
+inline void TestStreamBinary() {
+  std::string raw;
+  for (int i = 0; i < 1000; ++i) {
+    int val = (i * 7919) % 1000 - 500;
+    raw.append(reinterpret_cast<const char*>(&val), sizeof(val));
+  }
+  std::istringstream str(raw);
+  BinarySource<int> src(str, 7);
+  ASSERT_EQ(src.SizeHint(), 1000ul);
+  ASSERT_EQ(SizeHintOf(src), 1000ul);
+  HeapVec<int> heap;
+  heap.Build(src);
+  ASSERT_EQ(heap.Size(), 1000ul);
+  ASSERT_TRUE(heap.IsHeap());
+  ASSERT_EQ(heap.Front(), 499);
+
+  // Il suggerimento conta solo i record rimasti dalla posizione corrente
+  std::istringstream part(raw);
+  part.seekg(40 * sizeof(int));
+  SetVec<int> set;
+  set.Build(BinarySource<int>(part));
+  ASSERT_EQ(set.Size(), 960ul);
+
+  // Un record troncato
+  std::istringstream cut(raw.substr(0, raw.size() - 1));
+  Vector<int> vec;
+  ASSERT_THROW(vec.Build(BinarySource<int>(cut)), std::runtime_error);
+  ASSERT_TRUE(vec.Empty());
+
+  // I generatori non offrono un suggerimento
+  ASSERT_EQ(SizeHintOf(MakeGenerator<int>(10, 10)), 0ul);
+}
+
+template <typename T>
+void RunStreamTests() {
+  TestStreamBuild<T>();
+  if constexpr (std::is_same_v<T, int>) {
+    TestStreamText();
+    TestStreamBinary();
+  }
+  std::cout << "All stream tests passed for type: " << typeid(T).name() << "\n";
+}
+
+#endif
@@ -3,8 +3,16 @@
 #include "vector/vector.hpp"
 #include "set/setlist.hpp"
 #include "set/setVector.hpp"
+#include "set/frozenSet.hpp"
+#include "set/setBTree.hpp"
 #include "heap/heapVector.hpp"
 #include "pq/pqHeap.hpp"
+#include "ranges/ranges.hpp"
+#include "serial/serial.hpp"
+#include "stream/stream.hpp"
+#include "stats/stats.hpp"
+#include "memory/memory.hpp"
+#include "flat/flat.hpp"
 #include "test.hpp"
 
 void mytest()
@@ -16,6 +24,7 @@ void mytest()
   TestVector<MyObject>();
   TestSortableVectorInt();
   TestVectorString();
+  TestVectorUnchecked();
 
   std::cout << "\nRunning List tests...\n";
   RunListTests<int>();
@@ -27,6 +36,16 @@ void mytest()
   RunSetVecTests<std::string>();
   RunSetVecTests<MyObject>();
 
+  std::cout << "\nRunning FrozenSet tests...\n";
+  RunFrozenSetTests<int>();
+  RunFrozenSetTests<std::string>();
+  RunFrozenSetTests<MyObject>();
+
+  std::cout << "\nRunning SetBTree tests...\n";
+  RunSetBTreeTests<int>();
+  RunSetBTreeTests<std::string>();
+  RunSetBTreeTests<MyObject>();
+
   std::cout << "\nRunning SetLst tests...\n";
   RunSetLstTests<int>();
   RunSetLstTests<std::string>();
@@ -42,6 +61,35 @@ void mytest()
   TestPQHeap<std::string>();
   TestPQHeap<MyObject>();
 
+  std::cout << "\nRunning ranges tests...\n";
+  RunRangesTests<int>();
+  RunRangesTests<std::string>();
+  RunRangesTests<MyObject>();
+
+  std::cout << "\nRunning serialization tests...\n";
+  RunSerialTests<int>();
+  RunSerialTests<std::string>();
+
+  std::cout << "\nRunning stream tests...\n";
+  RunStreamTests<int>();
+  RunStreamTests<std::string>();
+  RunStreamTests<MyObject>();
+
+  std::cout << "\nRunning stats tests...\n";
+  RunStatsTests<int>();
+  RunStatsTests<std::string>();
+  RunStatsTests<MyObject>();
+
+  std::cout << "\nRunning memory tests...\n";
+  RunMemoryTests<int>();
+  RunMemoryTests<std::string>();
+  RunMemoryTests<MyObject>();
+
+  std::cout << "\nRunning flat tests...\n";
+  RunFlatTests<int>();
+  RunFlatTests<std::string>();
+  RunFlatTests<MyObject>();
+
 
 
   std::cout << "\nAll tests passed.\n";
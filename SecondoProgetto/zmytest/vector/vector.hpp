@@ -7,6 +7,7 @@
 #include <stdexcept>
 #include "../util/test_utils.hpp" // per ASSERT_EQ ecc
 #include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
 
 using namespace std;
 using namespace lasd;
@@ -220,4 +221,49 @@ inline void TestVectorString() {
   cout << "All tests passed for Vector<string> specific." << endl;
 }
 
+// Accesso non controllato, puntatore e span, e algoritmi generici sugli elementi contigui
+inline void TestVectorUnchecked() {
+  cout << "\n=== Testing Vector unchecked access ===" << endl;
+  SortableVector<int> vec(1000);
+  for (ulong i = 0; i < vec.Size(); ++i) {
+    vec.UncheckedAt(i) = static_cast<int>((i * 7919) % 1000);
+  }
+  ASSERT_EQ(vec.data(), &vec[0]);
+  ASSERT_EQ(vec.Span().size(), vec.Size());
+  ASSERT_EQ(vec.Span()[999], vec[999]);
+  const Vector<int>& cvec = vec;
+  ASSERT_EQ(&cvec.UncheckedAt(5), cvec.data() + 5);
+  ASSERT_THROW(vec[1000], std::out_of_range);
+
+  vec.Sort(); // QuickSort sul puntatore agli elementi
+  for (ulong i = 0; i < vec.Size(); ++i) {
+    ASSERT_EQ(vec.UncheckedAt(i), static_cast<int>(i));
+  }
+  SortableVector<int> one(1), none;
+  one.Sort();
+  none.Sort();
+
+  // Visite e confronto generici (LinearContainer) su elementi contigui e non
+  long sum = 0;
+  int last = 1000;
+  bool ok = true;
+  vec.PostOrderTraverse([&](const int& val) { ok = ok && val < last; last = val; });
+  vec.Map([](int& val) { val *= 2; });
+  vec.Traverse([&sum](const int& val) { sum += val; });
+  ASSERT_TRUE(ok);
+  ASSERT_EQ(sum, 999L * 1000L);
+  List<int> lst;
+  for (ulong i = 0; i < vec.Size(); ++i) {
+    lst.InsertAtBack(vec[i]);
+  }
+  const LinearContainer<int>& lin = vec;
+  ASSERT_TRUE(lin == static_cast<const LinearContainer<int>&>(lst));
+  Vector<int> cpy(vec);
+  ASSERT_TRUE(lin == static_cast<const LinearContainer<int>&>(cpy));
+  cpy.UncheckedAt(500) = -1;
+  ASSERT_FALSE(lin == static_cast<const LinearContainer<int>&>(cpy));
+
+  cout << "All tests passed for Vector unchecked access." << endl;
+}
+
 #endif // TEST_VECTOR_HPP
@@ -32,17 +32,37 @@ inline bool BinaryTree<Data>::Node::IsLeaf() const noexcept {
 // Comparison operators (BinaryTree)
 
 template<typename Data>
-inline bool BinaryTree<Data>::operator==(const BinaryTree<Data> & bt) const noexcept {
+inline bool BinaryTree<Data>::operator==(const BinaryTree<Data> & bt) const {
+  const Data * arr = BreadthArray();
+  const Data * btarr = bt.BreadthArray();
+  if (size == bt.size && arr != nullptr && btarr != nullptr) {
+    // Two contiguous trees of the same size have the same shape
+    for (ulong index = 0; index < size; ++index) {
+      if (arr[index] != btarr[index]) {
+        return false;
+      }
+    }
+    return true;
+  }
   return (size == bt.size) && (size == 0 || (size != 0 && (Root() == bt.Root())));
 }
 
 template<typename Data>
-inline bool BinaryTree<Data>::operator!=(const BinaryTree<Data> & bt) const noexcept {
+inline bool BinaryTree<Data>::operator!=(const BinaryTree<Data> & bt) const {
   return !(*this == bt);
 }
 
 /* ************************************************************************** */
 
+// Specific member functions (BinaryTree)
+
+template<typename Data>
+inline const Data * BinaryTree<Data>::BreadthArray() const noexcept {
+  return nullptr;
+}
+
+/* ************************************************************************** */
+
 // Specific member functions (BinaryTree) (inherited from TraversableContainer)
 
 template<typename Data>
@@ -89,7 +109,12 @@ inline void BinaryTree<Data>::InOrderTraverse(TraverseFun fun) const {
 
 template<typename Data>
 inline void BinaryTree<Data>::BreadthTraverse(TraverseFun fun) const {
-  if (size > 0) {
+  const Data * arr = BreadthArray();
+  if (arr != nullptr) {
+    for (ulong index = 0; index < size; ++index) {
+      fun(arr[index]);
+    }
+  } else if (size > 0) {
     BreadthTraverse(fun, Root());
   }
 }
@@ -161,6 +186,120 @@ void BinaryTree<Data>::BreadthTraverse(TraverseFun fun, const Node & nod) const
 
 /* ************************************************************************** */
 
+// Specific member functions (BinaryTree) (parallel visits)
+
+template<typename Data>
+void BinaryTree<Data>::ParallelTraverse(TraverseFun fun, ThreadPool & pool, ulong grain) const {
+  const Data * arr = BreadthArray();
+  if (arr != nullptr) {
+    pool.For(0, size, grain, [&fun, arr](ulong lo, ulong hi) {
+      for (ulong index = lo; index < hi; ++index) {
+        fun(arr[index]);
+      }
+    });
+  } else if (size > 0) {
+    auto visit = [&fun](const Node & nod) { fun(nod.Element()); };
+    auto rest = [this, &fun](const Node & nod) { PreOrderTraverse(fun, nod); };
+    ForkVisit(Root(), ForkDepth(grain), pool, visit, rest);
+  }
+}
+
+template<typename Data>
+template<typename Accumulator>
+Accumulator BinaryTree<Data>::ParallelFold(FoldFun<Accumulator> fun, JoinFun<Accumulator> join, Accumulator ini, ThreadPool & pool, ulong grain) const {
+  const Data * arr = BreadthArray();
+  if (arr != nullptr) {
+    return ForkFold(arr, 0, size, grain, pool, fun, join, ini);
+  } else if (size > 0) {
+    return ForkFold(Root(), ForkDepth(grain), pool, fun, join, ini);
+  }
+  return ini;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary member functions (BinaryTree) (for the parallel visits)
+
+// Levels which are forked, so that the subtrees below hold about grain nodes
+// each (in a balanced tree)
+template<typename Data>
+ulong BinaryTree<Data>::ForkDepth(ulong grain) const noexcept {
+  ulong depth = 0;
+  while ((grain << (depth + 1)) <= size && depth < 63) {
+    ++depth;
+  }
+  return depth;
+}
+
+// Above the given depth each node is visited and its two subtrees are forked;
+// at that depth the whole subtree is handed to rest
+template<typename Data>
+template<typename NodeType, typename Visit, typename Rest>
+void BinaryTree<Data>::ForkVisit(NodeType & nod, ulong depth, ThreadPool & pool, Visit & visit, Rest & rest) {
+  if (depth == 0) {
+    rest(nod);
+    return;
+  }
+  visit(nod);
+  pool.Invoke(
+    [&]() {
+      if (nod.HasLeftChild()) {
+        ForkVisit(nod.LeftChild(), depth - 1, pool, visit, rest);
+      }
+    },
+    [&]() {
+      if (nod.HasRightChild()) {
+        ForkVisit(nod.RightChild(), depth - 1, pool, visit, rest);
+      }
+    });
+}
+
+template<typename Data>
+template<typename Accumulator>
+Accumulator BinaryTree<Data>::ForkFold(const Node & nod, ulong depth, ThreadPool & pool, FoldFun<Accumulator> & fun, JoinFun<Accumulator> & join, const Accumulator & ini) const {
+  if (depth == 0) {
+    Accumulator acc = ini;
+    PreOrderTraverse([&fun, &acc](const Data & dat) { acc = fun(dat, acc); }, nod);
+    return acc;
+  }
+  Accumulator lef = ini;
+  Accumulator rig = ini;
+  pool.Invoke(
+    [&]() {
+      if (nod.HasLeftChild()) {
+        lef = ForkFold(nod.LeftChild(), depth - 1, pool, fun, join, ini);
+      }
+    },
+    [&]() {
+      if (nod.HasRightChild()) {
+        rig = ForkFold(nod.RightChild(), depth - 1, pool, fun, join, ini);
+      }
+    });
+  return join(fun(nod.Element(), lef), rig);
+}
+
+// Halves of a contiguous range, folded separately and joined
+template<typename Data>
+template<typename Accumulator>
+Accumulator BinaryTree<Data>::ForkFold(const Data * arr, ulong lo, ulong hi, ulong grain, ThreadPool & pool, FoldFun<Accumulator> & fun, JoinFun<Accumulator> & join, const Accumulator & ini) {
+  if (hi - lo <= grain || hi - lo < 2) {
+    Accumulator acc = ini;
+    for (ulong index = lo; index < hi; ++index) {
+      acc = fun(arr[index], acc);
+    }
+    return acc;
+  }
+  ulong mid = lo + (hi - lo) / 2;
+  Accumulator lef = ini;
+  Accumulator rig = ini;
+  pool.Invoke(
+    [&]() { lef = ForkFold(arr, lo, mid, grain, pool, fun, join, ini); },
+    [&]() { rig = ForkFold(arr, mid, hi, grain, pool, fun, join, ini); });
+  return join(lef, rig);
+}
+
+/* ************************************************************************** */
+
 // Specific member functions (MutableBinaryTree) (inherited from MappableContainer)
 
 template<typename Data>
@@ -207,13 +346,38 @@ inline void MutableBinaryTree<Data>::InOrderMap(MapFun fun) {
 
 template<typename Data>
 inline void MutableBinaryTree<Data>::BreadthMap(MapFun fun) {
-  if (size > 0) {
+  Data * arr = MutableBreadthArray();
+  if (arr != nullptr) {
+    for (ulong index = 0; index < size; ++index) {
+      fun(arr[index]);
+    }
+  } else if (size > 0) {
     BreadthMap(fun, Root());
   }
 }
 
 /* ************************************************************************** */
 
+// Specific member functions (MutableBinaryTree) (parallel map)
+
+template<typename Data>
+void MutableBinaryTree<Data>::ParallelMap(MapFun fun, ThreadPool & pool, ulong grain) {
+  Data * arr = MutableBreadthArray();
+  if (arr != nullptr) {
+    pool.For(0, size, grain, [&fun, arr](ulong lo, ulong hi) {
+      for (ulong index = lo; index < hi; ++index) {
+        fun(arr[index]);
+      }
+    });
+  } else if (size > 0) {
+    auto visit = [&fun](MutableNode & nod) { fun(nod.Element()); };
+    auto rest = [this, &fun](MutableNode & nod) { PreOrderMap(fun, nod); };
+    BinaryTree<Data>::ForkVisit(Root(), this->ForkDepth(grain), pool, visit, rest);
+  }
+}
+
+/* ************************************************************************** */
+
 // Auxiliary member functions (MutableBinaryTree) (for PreOrderMappableContainer)
 
 template<typename Data>
@@ -279,4 +443,13 @@ void MutableBinaryTree<Data>::BreadthMap(MapFun fun, MutableNode & nod) {
 
 /* ************************************************************************** */
 
+// Auxiliary member functions (MutableBinaryTree)
+
+template<typename Data>
+inline Data * MutableBinaryTree<Data>::MutableBreadthArray() noexcept {
+  return nullptr;
+}
+
+/* ************************************************************************** */
+
 }
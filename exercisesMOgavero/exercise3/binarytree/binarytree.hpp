@@ -4,6 +4,8 @@
 
 /* ************************************************************************** */
 
+#include <utility>
+
 #include "../container/container.hpp"
 #include "../container/mappable.hpp"
 
@@ -12,6 +14,8 @@
 #include "../stack/vec/stackvec.hpp"
 #include "../queue/vec/queuevec.hpp"
 
+#include "../threadpool/threadpool.hpp"
+
 /* ************************************************************************** */
 
 namespace lasd {
@@ -89,9 +93,10 @@ public:
 
   /* ************************************************************************ */
 
-  // Comparison operators
-  inline virtual bool operator==(const BinaryTree &) const noexcept;
-  inline virtual bool operator!=(const BinaryTree &) const noexcept;
+  // Comparison operators (a non-contiguous side goes through Root(), which
+  // may build the node array of a BinaryTreeVec: they can throw)
+  inline virtual bool operator==(const BinaryTree &) const;
+  inline virtual bool operator!=(const BinaryTree &) const;
 
   /* ************************************************************************ */
 
@@ -99,6 +104,9 @@ public:
 
   virtual const Node & Root() const = 0;
 
+  // Elements in breadth order, when the tree stores them contiguously (nullptr otherwise)
+  inline virtual const Data * BreadthArray() const noexcept;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TraversableContainer)
@@ -131,6 +139,24 @@ public:
 
   inline void BreadthTraverse(TraverseFun) const override;
 
+  /* ************************************************************************ */
+
+  // Specific member functions (parallel visits, in no specified order)
+
+  template <typename Accumulator>
+  using FoldFun = typename TraversableContainer<Data>::FoldFun<Accumulator>;
+
+  template <typename Accumulator>
+  using JoinFun = std::function<Accumulator(const Accumulator &, const Accumulator &)>;
+
+  static const ulong pargrain = 4096; // (default elements per task)
+
+  void ParallelTraverse(TraverseFun, ThreadPool & = ThreadPool::Default(), ulong = pargrain) const;
+
+  // The join must be associative and commutative, with the initial value as identity
+  template <typename Accumulator>
+  Accumulator ParallelFold(FoldFun<Accumulator>, JoinFun<Accumulator>, Accumulator, ThreadPool & = ThreadPool::Default(), ulong = pargrain) const;
+
 protected:
 
   // Auxiliary member function (for PreOrderMappableContainer)
@@ -155,10 +181,28 @@ protected:
 
   virtual void BreadthTraverse(TraverseFun, const Node &) const;
 
+  /* ************************************************************************ */
+
+  // Auxiliary member functions (for the parallel visits)
+
+  ulong ForkDepth(ulong) const noexcept;
+
+  template <typename NodeType, typename Visit, typename Rest>
+  static void ForkVisit(NodeType &, ulong, ThreadPool &, Visit &, Rest &);
+
+  template <typename Accumulator>
+  Accumulator ForkFold(const Node &, ulong, ThreadPool &, FoldFun<Accumulator> &, JoinFun<Accumulator> &, const Accumulator &) const;
+
+  template <typename Accumulator>
+  static Accumulator ForkFold(const Data *, ulong, ulong, ulong, ThreadPool &, FoldFun<Accumulator> &, JoinFun<Accumulator> &, const Accumulator &);
+
 };
 
 /* ************************************************************************** */
 
+template <typename Data>
+class BTBreadthMutableIterator;
+
 template <typename Data>
 class MutableBinaryTree : virtual public BinaryTree<Data>,
   virtual public PreOrderMappableContainer<Data>,
@@ -170,6 +214,8 @@ private:
 
 protected:
 
+  friend class BTBreadthMutableIterator<Data>;
+
   using Container::size;
 
   using typename BinaryTree<Data>::Node;
@@ -256,6 +302,12 @@ public:
 
   inline void BreadthMap(MapFun) override;
 
+  /* ************************************************************************ */
+
+  // Specific member function (parallel map, in no specified order)
+
+  void ParallelMap(MapFun, ThreadPool & = ThreadPool::Default(), ulong = BinaryTree<Data>::pargrain);
+
 protected:
 
   // Auxiliary member function (for PreOrderMappableContainer)
@@ -280,6 +332,11 @@ protected:
 
   virtual void BreadthMap(MapFun, MutableNode &);
 
+  /* ************************************************************************ */
+
+  // Same elements as BreadthArray, writable (nullptr if not contiguous)
+  inline virtual Data * MutableBreadthArray() noexcept;
+
 };
 
 /* ************************************************************************** */
@@ -807,24 +864,36 @@ protected:
   const typename BinaryTree<Data>::Node * root = nullptr;
   QueueVec<const typename BinaryTree<Data>::Node *> que;
 
+  // Contiguous trees: the visit is a scan of the element array
+  const Data * arr = nullptr;
+  ulong num = 0;
+  ulong pos = 0;
+
 public:
 
   // Specific constructors
   BTBreadthIterator(const BinaryTree<Data> & bt) {
     if (bt.Size() != 0) {
-      que.Enqueue(root = &bt.Root());
+      if ((arr = bt.BreadthArray()) != nullptr) {
+        num = bt.Size();
+      } else {
+        que.Enqueue(root = &bt.Root());
+      }
     }
   };
 
   /* ************************************************************************ */
 
   // Copy constructor
-  BTBreadthIterator(const BTBreadthIterator & itr) : root(itr.root), que(itr.que) {}
+  BTBreadthIterator(const BTBreadthIterator & itr) : root(itr.root), que(itr.que), arr(itr.arr), num(itr.num), pos(itr.pos) {}
 
   // Move constructor
   BTBreadthIterator(BTBreadthIterator && itr) noexcept {
     std::swap(root, itr.root);
     std::swap(que, itr.que);
+    std::swap(arr, itr.arr);
+    std::swap(num, itr.num);
+    std::swap(pos, itr.pos);
   }
 
   /* ************************************************************************ */
@@ -838,6 +907,9 @@ public:
   BTBreadthIterator & operator=(const BTBreadthIterator & itr) {
     root = itr.root;
     que = itr.que;
+    arr = itr.arr;
+    num = itr.num;
+    pos = itr.pos;
     return *this;
   }
 
@@ -845,6 +917,9 @@ public:
   BTBreadthIterator & operator=(BTBreadthIterator && itr) noexcept {
     std::swap(root, itr.root);
     std::swap(que, itr.que);
+    std::swap(arr, itr.arr);
+    std::swap(num, itr.num);
+    std::swap(pos, itr.pos);
     return *this;
   }
 
@@ -859,7 +934,9 @@ public:
   // Specific member functions (inherited from Iterator)
 
   const Data & operator*() const override {
-    if (!que.Empty()) {
+    if (arr != nullptr && pos < num) {
+      return arr[pos];
+    } else if (!que.Empty()) {
       return que.Head()->Element();
     } else {
       throw std::out_of_range("The iterator is terminated.");
@@ -867,7 +944,7 @@ public:
   };
 
   bool Terminated() const noexcept override {
-    return que.Empty();
+    return (arr != nullptr) ? (pos >= num) : que.Empty();
   };
 
   /* ************************************************************************ */
@@ -875,6 +952,13 @@ public:
   // Specific member function (inherited from ForwardIterator)
 
   ForwardIterator<Data> & operator++() override {
+    if (arr != nullptr) {
+      if (pos >= num) {
+        throw std::out_of_range("The iterator is terminated.");
+      }
+      ++pos;
+      return *this;
+    }
     const typename BinaryTree<Data>::Node & curr = *que.HeadNDequeue();
     if (curr.HasLeftChild()) {
       que.Enqueue(&curr.LeftChild());
@@ -890,6 +974,7 @@ public:
   // Specific member function (inherited from ResettableIterator)
 
   void Reset() noexcept override {
+    pos = 0;
     if (root != nullptr) {
       que.Clear();
       que.Enqueue(root);
@@ -909,19 +994,24 @@ private:
 protected:
 
   using BTBreadthIterator<Data>::que;
+  using BTBreadthIterator<Data>::arr;
+  using BTBreadthIterator<Data>::num;
+  using BTBreadthIterator<Data>::pos;
+
+  Data * marr = nullptr; // (arr, writable)
 
 public:
 
   // Specific constructors
-  BTBreadthMutableIterator(MutableBinaryTree<Data> & bt) : BTBreadthIterator<Data>(bt) {};
+  BTBreadthMutableIterator(MutableBinaryTree<Data> & bt) : BTBreadthIterator<Data>(bt), marr(bt.MutableBreadthArray()) {};
 
   /* ************************************************************************ */
 
   // Copy constructor
-  BTBreadthMutableIterator(const BTBreadthMutableIterator & itr) : BTBreadthIterator<Data>(itr) {};
+  BTBreadthMutableIterator(const BTBreadthMutableIterator & itr) : BTBreadthIterator<Data>(itr), marr(itr.marr) {};
 
   // Move constructor
-  BTBreadthMutableIterator(BTBreadthMutableIterator && itr) noexcept : BTBreadthIterator<Data>(std::move(itr)) {};
+  BTBreadthMutableIterator(BTBreadthMutableIterator && itr) noexcept : BTBreadthIterator<Data>(std::move(itr)), marr(std::exchange(itr.marr, nullptr)) {};
 
   /* ************************************************************************ */
 
@@ -933,11 +1023,15 @@ public:
   // Copy assignment
   BTBreadthMutableIterator & operator=(const BTBreadthMutableIterator & itr) {
     BTBreadthIterator<Data>::operator=(itr);
+    marr = itr.marr;
+    return *this;
   }
 
   // Move assignment
   BTBreadthMutableIterator & operator=(BTBreadthMutableIterator && itr) noexcept {
     BTBreadthIterator<Data>::operator=(std::move(itr));
+    std::swap(marr, itr.marr);
+    return *this;
   }
 
   /* ************************************************************************ */
@@ -945,7 +1039,9 @@ public:
   // Specific member functions (inherited from Iterator)
 
   Data & operator*() override {
-    if (!que.Empty()) {
+    if (marr != nullptr && pos < num) {
+      return marr[pos];
+    } else if (!que.Empty()) {
       return const_cast<Data &>(que.Head()->Element());
     } else {
       throw std::out_of_range("The iterator is terminated.");
@@ -301,6 +301,15 @@ typename BinaryTreeLnk<Data>::MutableNode & BinaryTreeLnk<Data>::Root() {
 
 /* ************************************************************************** */
 
+// Specific member function (BinaryTreeLnk) (inherited from Container)
+
+template<typename Data>
+MemStats BinaryTreeLnk<Data>::MemoryUsage() const noexcept {
+  return NodesMemory<NodeLnk>(sizeof(*this));
+}
+
+/* ************************************************************************** */
+
 // Specific member functions (BinaryTreeLnk) (inherited from ClearableContainer)
 
 template<typename Data>
@@ -312,4 +321,18 @@ void BinaryTreeLnk<Data>::Clear() {
 
 /* ************************************************************************** */
 
+// Auxiliary member function (BinaryTreeLnk)
+
+template<typename Data>
+template<typename NodeType>
+MemStats BinaryTreeLnk<Data>::NodesMemory(ulong objsize) const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = objsize + size * (sizeof(NodeType) - sizeof(Data));
+  mem.allocations = size;
+  return mem;
+}
+
+/* ************************************************************************** */
+
 }
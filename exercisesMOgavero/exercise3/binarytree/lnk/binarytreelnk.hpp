@@ -151,6 +151,12 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override;
+
+  /* ************************************************************************ */
+
   // Specific member function (inherited from ClearableContainer)
 
   void Clear() override;
@@ -159,6 +165,11 @@ protected:
 
   NodeLnk * root = nullptr;
 
+  // Auxiliary member function (one allocation of NodeType per element)
+
+  template <typename NodeType>
+  MemStats NodesMemory(ulong) const noexcept;
+
 };
 
 /* ************************************************************************** */
@@ -0,0 +1,116 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Specific constructors (BinaryTreePar)
+
+template<typename Data>
+BinaryTreePar<Data>::BinaryTreePar(const TraversableContainer<Data> & con) {
+  QueueVec<NodePar *> que;
+  con.Traverse(
+    [this, &que](const Data & dat) {
+      Append(que, dat);
+    }
+  );
+}
+
+template<typename Data>
+BinaryTreePar<Data>::BinaryTreePar(MappableContainer<Data> && con) {
+  QueueVec<NodePar *> que;
+  con.Map(
+    [this, &que](Data & dat) {
+      Append(que, std::move(dat));
+    }
+  );
+}
+
+/* ************************************************************************** */
+
+// Copy constructor (BinaryTreePar)
+template<typename Data>
+BinaryTreePar<Data>::BinaryTreePar(const BinaryTreePar<Data> & btp) {
+  root = Clone(btp.root, nullptr);
+  size = btp.size;
+}
+
+/* ************************************************************************** */
+
+// Copy assignment (BinaryTreePar)
+template<typename Data>
+BinaryTreePar<Data> & BinaryTreePar<Data>::operator=(const BinaryTreePar<Data> & btp) {
+  BinaryTreePar<Data> * tmpbtp = new BinaryTreePar<Data>(btp);
+  std::swap(*tmpbtp, *this);
+  delete tmpbtp;
+  return *this;
+}
+
+// Move assignment (BinaryTreePar)
+template<typename Data>
+BinaryTreePar<Data> & BinaryTreePar<Data>::operator=(BinaryTreePar<Data> && btp) noexcept {
+  BinaryTreeLnk<Data>::operator=(std::move(btp));
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// Comparison operators (BinaryTreePar)
+
+template<typename Data>
+inline bool BinaryTreePar<Data>::operator==(const BinaryTreePar<Data> & btp) const noexcept {
+  return BinaryTreeLnk<Data>::operator==(btp);
+}
+
+template<typename Data>
+inline bool BinaryTreePar<Data>::operator!=(const BinaryTreePar<Data> & btp) const noexcept {
+  return !(*this == btp);
+}
+
+/* ************************************************************************** */
+
+// Specific member function (BinaryTreePar) (inherited from Container)
+
+template<typename Data>
+MemStats BinaryTreePar<Data>::MemoryUsage() const noexcept {
+  return this->template NodesMemory<NodePar>(sizeof(*this));
+}
+
+/* ************************************************************************** */
+
+// Auxiliary member functions (BinaryTreePar)
+
+// Adds a node in breadth order; que holds the nodes still missing a child
+template<typename Data>
+template<typename Val>
+void BinaryTreePar<Data>::Append(QueueVec<NodePar *> & que, Val && dat) {
+  NodePar * nod;
+  if (root == nullptr) {
+    root = nod = new NodePar(std::forward<Val>(dat), nullptr);
+  } else {
+    NodePar * par = que.Head();
+    nod = new NodePar(std::forward<Val>(dat), par);
+    if (par->left == nullptr) {
+      par->left = nod;
+    } else {
+      par->right = nod;
+      que.Dequeue();
+    }
+  }
+  que.Enqueue(nod);
+  ++size;
+}
+
+template<typename Data>
+typename BinaryTreePar<Data>::NodePar * BinaryTreePar<Data>::Clone(const NodeLnk * nod, NodePar * par) {
+  if (nod == nullptr) {
+    return nullptr;
+  }
+  NodePar * cln = new NodePar(nod->element, par);
+  cln->left = Clone(nod->left, cln);
+  cln->right = Clone(nod->right, cln);
+  return cln;
+}
+
+/* ************************************************************************** */
+
+}
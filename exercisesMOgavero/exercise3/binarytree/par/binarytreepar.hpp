@@ -0,0 +1,312 @@
+
+#ifndef BINARYTREEPAR_HPP
+#define BINARYTREEPAR_HPP
+
+/* ************************************************************************** */
+
+#include <type_traits>
+
+#include "../lnk/binarytreelnk.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+struct BTParInOrderCursor;
+
+template <typename Data>
+class BTParInOrderIterator;
+
+/* ************************************************************************** */
+
+// Linked binary tree whose nodes also point to their parent, so that it can be
+// walked in order with no auxiliary stack (see BTParInOrderIterator).
+
+template <typename Data>
+class BinaryTreePar : virtual public MutableBinaryTree<Data>,
+  virtual protected BinaryTreeLnk<Data> {
+
+  friend struct BTParInOrderCursor<Data>;
+  friend class BTParInOrderIterator<Data>;
+
+private:
+
+protected:
+
+  using typename BinaryTreeLnk<Data>::NodeLnk;
+
+  using BinaryTreeLnk<Data>::size;
+  using BinaryTreeLnk<Data>::root;
+
+  struct NodePar : NodeLnk {
+
+    NodePar * parent = nullptr;
+
+    /* ********************************************************************** */
+
+    // Specific constructors
+    NodePar(const Data & dat, NodePar * par) : NodeLnk(dat), parent(par) {};
+    NodePar(Data && dat, NodePar * par) noexcept : NodeLnk(std::move(dat)), parent(par) {};
+
+  };
+
+public:
+
+  using typename BinaryTree<Data>::Node;
+  using typename MutableBinaryTree<Data>::MutableNode;
+
+  // Default constructor
+  BinaryTreePar() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  BinaryTreePar(const TraversableContainer<Data> &);
+  BinaryTreePar(MappableContainer<Data> &&);
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  BinaryTreePar(const BinaryTreePar &);
+
+  // Move constructor
+  BinaryTreePar(BinaryTreePar && btp) noexcept : BinaryTreeLnk<Data>(std::move(btp)) {};
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~BinaryTreePar() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  BinaryTreePar & operator=(const BinaryTreePar &);
+
+  // Move assignment
+  BinaryTreePar & operator=(BinaryTreePar &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  using BinaryTree<Data>::operator==;
+  inline bool operator==(const BinaryTreePar &) const noexcept;
+  using BinaryTree<Data>::operator!=;
+  inline bool operator!=(const BinaryTreePar &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from BinaryTree and MutableBinaryTree)
+
+  using BinaryTreeLnk<Data>::Root;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  using BinaryTreeLnk<Data>::Clear;
+
+protected:
+
+  // Auxiliary member functions
+
+  template <typename Val>
+  void Append(QueueVec<NodePar *> &, Val &&);
+
+  static NodePar * Clone(const NodeLnk *, NodePar *);
+
+};
+
+/* ************************************************************************** */
+
+// In-order cursor over a BinaryTreePar: just the root and the current node,
+// trivially copyable and with no virtual calls. It climbs the parent links
+// instead of popping a stack and never allocates (amortized O(1) per step,
+// O(1) space). Element and Next require a cursor that is not terminated.
+
+template <typename Data>
+struct BTParInOrderCursor {
+
+  using NodePar = typename BinaryTreePar<Data>::NodePar;
+
+  const NodePar * root = nullptr;
+  const NodePar * curr = nullptr;
+
+  /* ************************************************************************ */
+
+  // Default constructor
+  BTParInOrderCursor() = default;
+
+  // Specific constructor
+  BTParInOrderCursor(const BinaryTreePar<Data> & bt) noexcept : root(static_cast<const NodePar *>(bt.root)) {
+    Reset();
+  }
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  inline bool operator==(const BTParInOrderCursor &) const noexcept = default;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline bool Terminated() const noexcept {
+    return (curr == nullptr);
+  }
+
+  inline const Data & Element() const noexcept {
+    return curr->element;
+  }
+
+  inline void Next() noexcept {
+    if (curr->right != nullptr) {
+      curr = LeftMost(static_cast<const NodePar *>(curr->right));
+    } else {
+      const NodePar * prev;
+      do {
+        prev = curr;
+        curr = curr->parent;
+      } while (curr != nullptr && curr->right == prev);
+    }
+  }
+
+  inline void Reset() noexcept {
+    curr = (root != nullptr) ? LeftMost(root) : nullptr;
+  }
+
+  /* ************************************************************************ */
+
+  // Auxiliary member function
+
+  static const NodePar * LeftMost(const NodePar * nod) noexcept {
+    while (nod->left != nullptr) {
+      nod = static_cast<const NodePar *>(nod->left);
+    }
+    return nod;
+  }
+
+};
+
+/* ************************************************************************** */
+
+// In-order iterator over a BinaryTreePar: the polymorphic interface
+// (ForwardIterator, ResettableIterator) around a BTParInOrderCursor.
+
+template <typename Data>
+class BTParInOrderIterator : virtual public ForwardIterator<Data>,
+  virtual public ResettableIterator<Data> {
+
+private:
+
+protected:
+
+  using Cursor = BTParInOrderCursor<Data>;
+
+  static_assert(std::is_trivially_copyable_v<Cursor>);
+
+  Cursor cur;
+
+public:
+
+  // Specific constructors
+  BTParInOrderIterator(const BinaryTreePar<Data> & bt) noexcept : cur(bt) {};
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  BTParInOrderIterator(const BTParInOrderIterator & itr) noexcept : cur(itr.cur) {}
+
+  // Move constructor
+  BTParInOrderIterator(BTParInOrderIterator && itr) noexcept : cur(itr.cur) {}
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~BTParInOrderIterator() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  BTParInOrderIterator & operator=(const BTParInOrderIterator & itr) noexcept {
+    cur = itr.cur;
+    return *this;
+  }
+
+  // Move assignment
+  BTParInOrderIterator & operator=(BTParInOrderIterator && itr) noexcept {
+    cur = itr.cur;
+    return *this;
+  }
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  inline bool operator==(const BTParInOrderIterator & itr) const noexcept {
+    return (cur == itr.cur);
+  }
+  inline bool operator!=(const BTParInOrderIterator & itr) const noexcept {
+    return !(*this == itr);
+  }
+
+  /* ************************************************************************ */
+
+  // Specific member function
+
+  inline const Cursor & GetCursor() const noexcept {
+    return cur;
+  }
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from Iterator)
+
+  const Data & operator*() const override {
+    if (!cur.Terminated()) {
+      return cur.Element();
+    } else {
+      throw std::out_of_range("The iterator is terminated.");
+    }
+  };
+
+  bool Terminated() const noexcept override {
+    return cur.Terminated();
+  };
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ForwardIterator)
+
+  ForwardIterator<Data> & operator++() override {
+    if (cur.Terminated()) {
+      throw std::out_of_range("The iterator is terminated.");
+    }
+    cur.Next();
+    return *this;
+  };
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ResettableIterator)
+
+  void Reset() noexcept override {
+    cur.Reset();
+  };
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "binarytreepar.cpp"
+
+#endif
@@ -34,7 +34,7 @@ template <typename Data>
 inline const typename BinaryTreeVec<Data>::Node & BinaryTreeVec<Data>::NodeVec::LeftChild() const {
   ulong child = 2 * Index() + 1;
   if (child < Tree->size) {
-    return Tree->Nodes[child];
+    return Tree->Nodes.load(std::memory_order_relaxed)[child];
   } else {
     throw std::out_of_range("Left child does not exists.");
   }
@@ -44,7 +44,7 @@ template <typename Data>
 inline const typename BinaryTreeVec<Data>::Node & BinaryTreeVec<Data>::NodeVec::RightChild() const {
   ulong child = 2 * Index() + 2;
   if (child < Tree->size) {
-    return Tree->Nodes[child];
+    return Tree->Nodes.load(std::memory_order_relaxed)[child];
   } else {
     throw std::out_of_range("Right child does not exists.");
   }
@@ -58,7 +58,7 @@ template <typename Data>
 inline typename BinaryTreeVec<Data>::MutableNode & BinaryTreeVec<Data>::NodeVec::LeftChild() {
   ulong child = 2 * Index() + 1;
   if (child < Tree->size) {
-    return Tree->Nodes[child];
+    return Tree->Nodes.load(std::memory_order_relaxed)[child];
   } else {
     throw std::out_of_range("Left child does not exists.");
   }
@@ -68,7 +68,7 @@ template <typename Data>
 inline typename BinaryTreeVec<Data>::MutableNode & BinaryTreeVec<Data>::NodeVec::RightChild() {
   ulong child = 2 * Index() + 2;
   if (child < Tree->size) {
-    return Tree->Nodes[child];
+    return Tree->Nodes.load(std::memory_order_relaxed)[child];
   } else {
     throw std::out_of_range("Right child does not exists.");
   }
@@ -80,7 +80,7 @@ inline typename BinaryTreeVec<Data>::MutableNode & BinaryTreeVec<Data>::NodeVec:
 
 template <typename Data>
 inline ulong BinaryTreeVec<Data>::NodeVec::Index() const noexcept {
-  return (this - Tree->Nodes);
+  return (this - Tree->Nodes.load(std::memory_order_relaxed));
 }
 
 /* ************************************************************************** */
@@ -88,22 +88,16 @@ inline ulong BinaryTreeVec<Data>::NodeVec::Index() const noexcept {
 // Specific constructors (BinaryTreeVec)
 
 template<typename Data>
-BinaryTreeVec<Data>::BinaryTreeVec(const TraversableContainer<Data> & con) : Vector<Data>(con) {
-  NewNodeArray();
-}
+BinaryTreeVec<Data>::BinaryTreeVec(const TraversableContainer<Data> & con) : Vector<Data>(con) {}
 
 template<typename Data>
-BinaryTreeVec<Data>::BinaryTreeVec(MappableContainer<Data> && con) : Vector<Data>(std::move(con)) {
-  NewNodeArray();
-}
+BinaryTreeVec<Data>::BinaryTreeVec(MappableContainer<Data> && con) : Vector<Data>(std::move(con)) {}
 
 /* ************************************************************************** */
 
 // Copy constructor (BinaryTreeVec)
 template<typename Data>
-BinaryTreeVec<Data>::BinaryTreeVec(const BinaryTreeVec<Data> & btv) : Vector<Data>(btv) {
-  NewNodeArray();
-}
+BinaryTreeVec<Data>::BinaryTreeVec(const BinaryTreeVec<Data> & btv) : Vector<Data>(btv) {}
 
 // Move constructor (BinaryTreeVec)
 template<typename Data>
@@ -116,7 +110,7 @@ BinaryTreeVec<Data>::BinaryTreeVec(BinaryTreeVec<Data> && btv) noexcept : Vector
 // Destructor (BinaryTreeVec)
 template<typename Data>
 BinaryTreeVec<Data>::~BinaryTreeVec() {
-  delete[] Nodes;
+  delete[] Nodes.load();
 }
 
 /* ************************************************************************** */
@@ -125,7 +119,7 @@ BinaryTreeVec<Data>::~BinaryTreeVec() {
 template<typename Data>
 BinaryTreeVec<Data> & BinaryTreeVec<Data>::operator=(const BinaryTreeVec<Data> & btv) {
   Vector<Data>::operator=(btv);
-  NewNodeArray();
+  delete[] Nodes.exchange(nullptr);
   return *this;
 }
 
@@ -158,7 +152,7 @@ inline bool BinaryTreeVec<Data>::operator!=(const BinaryTreeVec<Data> & btv) con
 template<typename Data>
 const typename BinaryTreeVec<Data>::Node & BinaryTreeVec<Data>::Root() const {
   if (size != 0) {
-    return Nodes[0];
+    return NodeArray()[0];
   } else {
     throw std::length_error("Access to an empty tree.");
   }
@@ -166,12 +160,12 @@ const typename BinaryTreeVec<Data>::Node & BinaryTreeVec<Data>::Root() const {
 
 /* ************************************************************************** */
 
-// Specific member functions (BinaryTreeVec) (inherited from MutableBinaryTree)
+// Auxiliary member functions (BinaryTreeVec) (inherited from MutableBinaryTree)
 
 template<typename Data>
 typename BinaryTreeVec<Data>::MutableNode & BinaryTreeVec<Data>::Root() {
   if (size != 0) {
-    return Nodes[0];
+    return NodeArray()[0];
   } else {
     throw std::length_error("Access to an empty tree.");
   }
@@ -179,13 +173,155 @@ typename BinaryTreeVec<Data>::MutableNode & BinaryTreeVec<Data>::Root() {
 
 /* ************************************************************************** */
 
+// Specific member functions (BinaryTreeVec) (inherited from BinaryTree)
+
+template<typename Data>
+inline const Data * BinaryTreeVec<Data>::BreadthArray() const noexcept {
+  return Elements;
+}
+
+// Auxiliary member functions (BinaryTreeVec) (inherited from MutableBinaryTree)
+
+template<typename Data>
+inline Data * BinaryTreeVec<Data>::MutableBreadthArray() noexcept {
+  return Elements;
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (BinaryTreeVec) (index-based navigation)
+
+template<typename Data>
+inline ulong BinaryTreeVec<Data>::LeftIndex(ulong index) noexcept {
+  return (2 * index + 1);
+}
+
+template<typename Data>
+inline ulong BinaryTreeVec<Data>::RightIndex(ulong index) noexcept {
+  return (2 * index + 2);
+}
+
+template<typename Data>
+inline ulong BinaryTreeVec<Data>::ParentIndex(ulong index) noexcept {
+  return ((index - 1) / 2);
+}
+
+template<typename Data>
+inline bool BinaryTreeVec<Data>::IsLeaf(ulong index) const noexcept {
+  return (LeftIndex(index) >= size);
+}
+
+template<typename Data>
+inline bool BinaryTreeVec<Data>::HasLeftChild(ulong index) const noexcept {
+  return (LeftIndex(index) < size);
+}
+
+template<typename Data>
+inline bool BinaryTreeVec<Data>::HasRightChild(ulong index) const noexcept {
+  return (RightIndex(index) < size);
+}
+
+template<typename Data>
+inline const Data & BinaryTreeVec<Data>::ElementAt(ulong index) const {
+  return Vector<Data>::operator[](index);
+}
+
+template<typename Data>
+inline Data & BinaryTreeVec<Data>::ElementAt(ulong index) {
+  return Vector<Data>::operator[](index);
+}
+
+// The tree is complete: a node with a right child has a left child too, and
+// the leftmost descent from any node ends in a leaf
+
+template<typename Data>
+inline ulong BinaryTreeVec<Data>::PreOrderFirst() const noexcept {
+  return 0;
+}
+
+template<typename Data>
+inline ulong BinaryTreeVec<Data>::PreOrderNext(ulong index) const noexcept {
+  if (HasLeftChild(index)) {
+    return LeftIndex(index);
+  }
+  // Climb until a left child with a right sibling
+  while (index != 0) {
+    if ((index % 2 == 1) && (index + 1 < size)) {
+      return (index + 1);
+    }
+    index = ParentIndex(index);
+  }
+  return size;
+}
+
+template<typename Data>
+inline ulong BinaryTreeVec<Data>::InOrderFirst() const noexcept {
+  ulong index = 0;
+  while (HasLeftChild(index)) {
+    index = LeftIndex(index);
+  }
+  return (size != 0) ? index : size;
+}
+
+template<typename Data>
+inline ulong BinaryTreeVec<Data>::InOrderNext(ulong index) const noexcept {
+  if (HasRightChild(index)) {
+    index = RightIndex(index);
+    while (HasLeftChild(index)) {
+      index = LeftIndex(index);
+    }
+    return index;
+  }
+  // Climb out of right subtrees: the next one is the parent of a left child
+  while ((index != 0) && (index % 2 == 0)) {
+    index = ParentIndex(index);
+  }
+  return (index != 0) ? ParentIndex(index) : size;
+}
+
+template<typename Data>
+inline ulong BinaryTreeVec<Data>::PostOrderFirst() const noexcept {
+  return InOrderFirst();
+}
+
+template<typename Data>
+inline ulong BinaryTreeVec<Data>::PostOrderNext(ulong index) const noexcept {
+  if (index == 0) {
+    return size;
+  }
+  if ((index % 2 == 1) && (index + 1 < size)) {
+    index = index + 1;
+    while (HasLeftChild(index)) {
+      index = LeftIndex(index);
+    }
+    return index;
+  }
+  return ParentIndex(index);
+}
+
+/* ************************************************************************** */
+
+// Specific member function (BinaryTreeVec) (inherited from Container)
+
+template<typename Data>
+MemStats BinaryTreeVec<Data>::MemoryUsage() const noexcept {
+  MemStats mem = Vector<Data>::MemoryUsage();
+  mem.overhead += sizeof(*this) - sizeof(Vector<Data>);
+  if (Nodes.load() != nullptr) {
+    mem.overhead += size * sizeof(NodeVec);
+    mem.allocations++;
+  }
+  return mem;
+}
+
+/* ************************************************************************** */
+
 // Specific member functions (BinaryTreeVec) (inherited from ClearableContainer)
 
 template<typename Data>
 void BinaryTreeVec<Data>::Clear() {
   Vector<Data>::Clear();
-  delete[] Nodes;
-  Nodes = nullptr;
+  delete[] Nodes.exchange(nullptr);
 }
 
 /* ************************************************************************** */
@@ -194,7 +330,7 @@ void BinaryTreeVec<Data>::Clear() {
 
 template<typename Data>
 inline void BinaryTreeVec<Data>::Traverse(TraverseFun fun) const {
-  BinaryTree<Data>::Traverse(fun);
+  PreOrderTraverse(fun);
 }
 
 /* ************************************************************************** */
@@ -203,7 +339,9 @@ inline void BinaryTreeVec<Data>::Traverse(TraverseFun fun) const {
 
 template<typename Data>
 inline void BinaryTreeVec<Data>::PreOrderTraverse(TraverseFun fun) const {
-  BinaryTree<Data>::PreOrderTraverse(fun);
+  for (ulong index = PreOrderFirst(); index < size; index = PreOrderNext(index)) {
+    fun(Elements[index]);
+  }
 }
 
 /* ************************************************************************** */
@@ -212,7 +350,20 @@ inline void BinaryTreeVec<Data>::PreOrderTraverse(TraverseFun fun) const {
 
 template<typename Data>
 inline void BinaryTreeVec<Data>::PostOrderTraverse(TraverseFun fun) const {
-  BinaryTree<Data>::PostOrderTraverse(fun);
+  for (ulong index = PostOrderFirst(); index < size; index = PostOrderNext(index)) {
+    fun(Elements[index]);
+  }
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (BinaryTreeVec) (inherited from InOrderTraversableContainer)
+
+template<typename Data>
+inline void BinaryTreeVec<Data>::InOrderTraverse(TraverseFun fun) const {
+  for (ulong index = InOrderFirst(); index < size; index = InOrderNext(index)) {
+    fun(Elements[index]);
+  }
 }
 
 /* ************************************************************************** */
@@ -221,7 +372,19 @@ inline void BinaryTreeVec<Data>::PostOrderTraverse(TraverseFun fun) const {
 
 template<typename Data>
 inline void BinaryTreeVec<Data>::BreadthTraverse(TraverseFun fun) const {
-  Vector<Data>::PreOrderTraverse(fun);
+  for (ulong index = 0; index < size; ++index) {
+    fun(Elements[index]);
+  }
+}
+
+template<typename Data>
+template<typename Fun>
+inline void BinaryTreeVec<Data>::BreadthTraverse(Fun fun) const {
+  const Data * arr = Elements;
+  ulong num = size;
+  for (ulong index = 0; index < num; ++index) {
+    fun(arr[index]);
+  }
 }
 
 /* ************************************************************************** */
@@ -230,7 +393,7 @@ inline void BinaryTreeVec<Data>::BreadthTraverse(TraverseFun fun) const {
 
 template<typename Data>
 inline void BinaryTreeVec<Data>::Map(MapFun fun) {
-  MutableBinaryTree<Data>::Map(fun);
+  PreOrderMap(fun);
 }
 
 /* ************************************************************************** */
@@ -239,7 +402,9 @@ inline void BinaryTreeVec<Data>::Map(MapFun fun) {
 
 template<typename Data>
 inline void BinaryTreeVec<Data>::PreOrderMap(MapFun fun) {
-  MutableBinaryTree<Data>::PreOrderMap(fun);
+  for (ulong index = PreOrderFirst(); index < size; index = PreOrderNext(index)) {
+    fun(Elements[index]);
+  }
 }
 
 /* ************************************************************************** */
@@ -248,7 +413,20 @@ inline void BinaryTreeVec<Data>::PreOrderMap(MapFun fun) {
 
 template<typename Data>
 inline void BinaryTreeVec<Data>::PostOrderMap(MapFun fun) {
-  MutableBinaryTree<Data>::PostOrderMap(fun);
+  for (ulong index = PostOrderFirst(); index < size; index = PostOrderNext(index)) {
+    fun(Elements[index]);
+  }
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (BinaryTreeVec) (inherited from InOrderMappableContainer)
+
+template<typename Data>
+inline void BinaryTreeVec<Data>::InOrderMap(MapFun fun) {
+  for (ulong index = InOrderFirst(); index < size; index = InOrderNext(index)) {
+    fun(Elements[index]);
+  }
 }
 
 /* ************************************************************************** */
@@ -257,30 +435,56 @@ inline void BinaryTreeVec<Data>::PostOrderMap(MapFun fun) {
 
 template<typename Data>
 inline void BinaryTreeVec<Data>::BreadthMap(MapFun fun) {
-  Vector<Data>::PreOrderMap(fun);
+  for (ulong index = 0; index < size; ++index) {
+    fun(Elements[index]);
+  }
+}
+
+template<typename Data>
+template<typename Fun>
+inline void BinaryTreeVec<Data>::BreadthMap(Fun fun) {
+  Data * arr = Elements;
+  ulong num = size;
+  for (ulong index = 0; index < num; ++index) {
+    fun(arr[index]);
+  }
 }
 
 /* ************************************************************************** */
 
 // Auxiliary member functions (BinaryTreeVec)
 
+// Concurrent const callers may both build an array: only one is published
 template<typename Data>
-inline void BinaryTreeVec<Data>::NewNodeArray() {
-  delete[] Nodes;
-  Nodes = new NodeVec[size] {};
-  for (ulong index = 0; index < size; ++index) {
-    Nodes[index].Tree = this;
+typename BinaryTreeVec<Data>::NodeVec * BinaryTreeVec<Data>::NodeArray() const {
+  NodeVec * arr = Nodes.load(std::memory_order_acquire);
+  if (arr == nullptr) {
+    NodeVec * newarr = new NodeVec[size] {};
+    for (ulong index = 0; index < size; ++index) {
+      newarr[index].Tree = const_cast<BinaryTreeVec *>(this);
+    }
+    if (Nodes.compare_exchange_strong(arr, newarr, std::memory_order_acq_rel, std::memory_order_acquire)) {
+      arr = newarr;
+    } else {
+      delete[] newarr;
+    }
   }
+  return arr;
 }
 
 template<typename Data>
 inline void BinaryTreeVec<Data>::SwapNodeArrays(BinaryTreeVec && btv) noexcept {
-  std::swap(Nodes, btv.Nodes);
-  for (ulong index = 0; index < size; ++index) {
-    Nodes[index].Tree = this;
+  NodeVec * arr = btv.Nodes.exchange(Nodes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  Nodes.store(arr, std::memory_order_relaxed);
+  if (arr != nullptr) {
+    for (ulong index = 0; index < size; ++index) {
+      arr[index].Tree = this;
+    }
   }
-  for (ulong index = 0; index < btv.size; ++index) {
-    btv.Nodes[index].Tree = &btv;
+  if ((arr = btv.Nodes.load(std::memory_order_relaxed)) != nullptr) {
+    for (ulong index = 0; index < btv.size; ++index) {
+      arr[index].Tree = &btv;
+    }
   }
 }
 
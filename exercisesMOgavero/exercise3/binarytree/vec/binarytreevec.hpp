@@ -4,6 +4,8 @@
 
 /* ************************************************************************** */
 
+#include <atomic>
+
 #include "../binarytree.hpp"
 #include "../../vector/vector.hpp"
 
@@ -13,6 +15,11 @@ namespace lasd {
 
 /* ************************************************************************** */
 
+// Complete binary tree stored in breadth order: the children of the element at
+// index i are at 2i+1 and 2i+2. Traversals and the index-based navigation
+// below touch only the element array; the node objects required by Root()
+// are allocated on the first call to Root() and are dropped by Clear().
+
 template <typename Data>
 class BinaryTreeVec : virtual public MutableBinaryTree<Data>,
   virtual protected Vector<Data> {
@@ -76,7 +83,9 @@ protected:
 
   };
 
-  NodeVec * Nodes = nullptr;
+  // Allocated on demand by Root() and published once with a compare-and-swap,
+  // so that concurrent readers of a const tree agree on a single array
+  mutable std::atomic<NodeVec *> Nodes = nullptr;
 
 public:
 
@@ -132,6 +141,41 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member function (inherited from BinaryTree)
+
+  inline const Data * BreadthArray() const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (index-based navigation)
+
+  static inline ulong LeftIndex(ulong) noexcept;
+  static inline ulong RightIndex(ulong) noexcept;
+  static inline ulong ParentIndex(ulong) noexcept; // Not defined for the root
+
+  inline bool IsLeaf(ulong) const noexcept;
+  inline bool HasLeftChild(ulong) const noexcept;
+  inline bool HasRightChild(ulong) const noexcept;
+
+  inline const Data & ElementAt(ulong) const; // (must throw std::out_of_range when out of range)
+  inline Data & ElementAt(ulong); // (must throw std::out_of_range when out of range)
+
+  // Visit order without a stack: Size() marks the end of the visit
+  inline ulong PreOrderFirst() const noexcept;
+  inline ulong PreOrderNext(ulong) const noexcept;
+  inline ulong InOrderFirst() const noexcept;
+  inline ulong InOrderNext(ulong) const noexcept;
+  inline ulong PostOrderFirst() const noexcept;
+  inline ulong PostOrderNext(ulong) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override; // (the node array counts as overhead)
+
+  /* ************************************************************************ */
+
   // Specific member function (inherited from ClearableContainer)
 
   void Clear() override;
@@ -158,10 +202,20 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member functions (inherited from InOrderTraversableContainer)
+
+  inline void InOrderTraverse(TraverseFun) const override;
+
+  /* ************************************************************************ */
+
   // Specific member functions (inherited from BreadthTraversableContainer)
 
   inline void BreadthTraverse(TraverseFun) const override;
 
+  // Same visit with a callable known at compile time (inlined, vectorizable)
+  template <typename Fun>
+  inline void BreadthTraverse(Fun) const;
+
   /* ************************************************************************ */
 
   // Specific member functions (inherited from MappableContainer)
@@ -184,17 +238,33 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member functions (inherited from InOrderMappableContainer)
+
+  inline void InOrderMap(MapFun) override;
+
+  /* ************************************************************************ */
+
   // Specific member functions (inherited from BreadthMappableContainer)
 
   inline void BreadthMap(MapFun) override;
 
+  // Same visit with a callable known at compile time (inlined, vectorizable)
+  template <typename Fun>
+  inline void BreadthMap(Fun);
+
 protected:
 
   // Auxiliary member functions
 
-  virtual void NewNodeArray();
+  virtual NodeVec * NodeArray() const; // (created by the first caller)
   virtual void SwapNodeArrays(BinaryTreeVec &&) noexcept;
 
+  /* ************************************************************************ */
+
+  // Auxiliary member function (inherited from MutableBinaryTree)
+
+  inline Data * MutableBreadthArray() noexcept override;
+
 };
 
 /* ************************************************************************** */
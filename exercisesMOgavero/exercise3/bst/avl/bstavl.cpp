@@ -0,0 +1,552 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Specific constructors
+
+template<typename Data>
+BSTAVL<Data>::BSTAVL(const TraversableContainer<Data> & con) {
+  if (IsSorted(con)) {
+    this->template BuildSorted<NodeAVL>(con);
+  } else {
+    con.Traverse(
+      [this](const Data & dat) {
+        Insert(dat);
+      }
+    );
+  }
+}
+
+template<typename Data>
+BSTAVL<Data>::BSTAVL(MappableContainer<Data> && con) {
+  if (IsSorted(con)) {
+    this->template BuildSorted<NodeAVL>(std::move(con));
+  } else {
+    con.Map(
+      [this](Data & dat) {
+        Insert(std::move(dat));
+      }
+    );
+  }
+}
+
+/* ************************************************************************** */
+
+// Copy constructor
+template<typename Data>
+BSTAVL<Data>::BSTAVL(const BSTAVL<Data> & bst) {
+  root = Clone(bst.root);
+  size = bst.size;
+}
+
+// Move constructor
+template<typename Data>
+BSTAVL<Data>::BSTAVL(BSTAVL<Data> && bst) noexcept {
+  std::swap(root, bst.root);
+  std::swap(size, bst.size);
+}
+
+/* ************************************************************************** */
+
+// Copy assignment
+template<typename Data>
+BSTAVL<Data> & BSTAVL<Data>::operator=(const BSTAVL<Data> & bst) {
+  BSTAVL<Data> tmpbst(bst);
+  std::swap(root, tmpbst.root);
+  std::swap(size, tmpbst.size);
+  return *this;
+}
+
+// Move assignment
+template<typename Data>
+BSTAVL<Data> & BSTAVL<Data>::operator=(BSTAVL<Data> && bst) noexcept {
+  std::swap(root, bst.root);
+  std::swap(size, bst.size);
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// Comparison operators
+
+template<typename Data>
+inline bool BSTAVL<Data>::operator==(const BSTAVL<Data> & bst) const noexcept {
+  return BST<Data>::operator==(bst);
+}
+
+template<typename Data>
+inline bool BSTAVL<Data>::operator!=(const BSTAVL<Data> & bst) const noexcept {
+  return !(*this == bst);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (inherited from BST)
+
+template<typename Data>
+Data BSTAVL<Data>::PredecessorNRemove(const Data & dat) {
+  Data key = this->Predecessor(dat);
+  return DataNDelete(DetachKey(root, key));
+}
+
+template<typename Data>
+void BSTAVL<Data>::RemovePredecessor(const Data & dat) {
+  Data key = this->Predecessor(dat);
+  delete DetachKey(root, key);
+}
+
+template<typename Data>
+Data BSTAVL<Data>::SuccessorNRemove(const Data & dat) {
+  Data key = this->Successor(dat);
+  return DataNDelete(DetachKey(root, key));
+}
+
+template<typename Data>
+void BSTAVL<Data>::RemoveSuccessor(const Data & dat) {
+  Data key = this->Successor(dat);
+  delete DetachKey(root, key);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (inherited from DictionaryContainer)
+
+template<typename Data>
+bool BSTAVL<Data>::Insert(const Data & dat) {
+  return InsertAt(root, dat);
+}
+
+template<typename Data>
+bool BSTAVL<Data>::Insert(Data && dat) {
+  return InsertAt(root, std::move(dat));
+}
+
+template<typename Data>
+bool BSTAVL<Data>::Remove(const Data & dat) {
+  NodeLnk * nod = DetachKey(root, dat);
+  if (nod != nullptr) {
+    delete nod;
+    return true;
+  }
+  return false;
+}
+
+/* ************************************************************************** */
+
+// Specific member function (BSTAVL) (inherited from Container)
+
+template<typename Data>
+MemStats BSTAVL<Data>::MemoryUsage() const noexcept {
+  return this->template NodesMemory<NodeAVL>(sizeof(*this));
+}
+
+/* ************************************************************************** */
+
+// Specific member functions
+
+template<typename Data>
+ulong BSTAVL<Data>::Height() const noexcept {
+  return HeightOf(root);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (set algebra)
+
+template<typename Data>
+void BSTAVL<Data>::Union(const BSTAVL<Data> & bst, bool par) {
+  Union(BSTAVL<Data>(bst), par);
+}
+
+template<typename Data>
+void BSTAVL<Data>::Union(BSTAVL<Data> && bst, bool par) {
+  if (&bst != this) {
+    NodeLnk * oth = nullptr;
+    std::swap(oth, bst.root);
+    bst.size = 0;
+    root = UnionOf(root, oth, par ? Forks() : 0);
+    size = Count(root);
+  }
+}
+
+template<typename Data>
+void BSTAVL<Data>::Intersect(const BSTAVL<Data> & bst, bool par) {
+  Intersect(BSTAVL<Data>(bst), par);
+}
+
+template<typename Data>
+void BSTAVL<Data>::Intersect(BSTAVL<Data> && bst, bool par) {
+  if (&bst != this) {
+    NodeLnk * oth = nullptr;
+    std::swap(oth, bst.root);
+    bst.size = 0;
+    root = IntersectionOf(root, oth, par ? Forks() : 0);
+    size = Count(root);
+  }
+}
+
+template<typename Data>
+void BSTAVL<Data>::Difference(const BSTAVL<Data> & bst, bool par) {
+  Difference(BSTAVL<Data>(bst), par);
+}
+
+template<typename Data>
+void BSTAVL<Data>::Difference(BSTAVL<Data> && bst, bool par) {
+  if (&bst != this) {
+    NodeLnk * oth = nullptr;
+    std::swap(oth, bst.root);
+    bst.size = 0;
+    root = DifferenceOf(root, oth, par ? Forks() : 0);
+    size = Count(root);
+  } else {
+    this->Clear();
+  }
+}
+
+/* ************************************************************************** */
+
+// Auxiliary member functions
+
+template<typename Data>
+template<typename Val>
+bool BSTAVL<Data>::InsertAt(NodeLnk *& nod, Val && dat) {
+  bool res;
+  if (nod == nullptr) {
+    nod = new NodeAVL(std::forward<Val>(dat));
+    ++size;
+    return true;
+  } else if (nod->element < dat) {
+    this->CountOp(StatOp::Comparison);
+    res = InsertAt(nod->right, std::forward<Val>(dat));
+  } else if (nod->element > dat) {
+    this->CountOp(StatOp::Comparison, 2);
+    res = InsertAt(nod->left, std::forward<Val>(dat));
+  } else {
+    this->CountOp(StatOp::Comparison, 2);
+    return false;
+  }
+  if (res) {
+    Rebalance(nod);
+  }
+  return res;
+}
+
+template<typename Data>
+typename BSTAVL<Data>::NodeLnk * BSTAVL<Data>::DetachKey(NodeLnk *& nod, const Data & dat) noexcept {
+  NodeLnk * ret = nullptr;
+  if (nod == nullptr) {
+    return nullptr;
+  } else if (nod->element < dat) {
+    this->CountOp(StatOp::Comparison);
+    ret = DetachKey(nod->right, dat);
+  } else if (nod->element > dat) {
+    this->CountOp(StatOp::Comparison, 2);
+    ret = DetachKey(nod->left, dat);
+  } else {
+    this->CountOp(StatOp::Comparison, 2);
+    if (nod->left == nullptr) {
+      return Skip2Right(nod);
+    } else if (nod->right == nullptr) {
+      return Skip2Left(nod);
+    }
+    ret = DetachMax(nod->left);
+    std::swap(nod->element, ret->element);
+    this->CountOp(StatOp::Move, 3);
+  }
+  if (ret != nullptr) {
+    Rebalance(nod);
+  }
+  return ret;
+}
+
+template<typename Data>
+typename BSTAVL<Data>::NodeLnk * BSTAVL<Data>::DetachMin(NodeLnk *& nod) noexcept {
+  if (nod == nullptr) {
+    return nullptr;
+  } else if (nod->left == nullptr) {
+    return Skip2Right(nod);
+  }
+  NodeLnk * ret = DetachMin(nod->left);
+  Rebalance(nod);
+  return ret;
+}
+
+template<typename Data>
+typename BSTAVL<Data>::NodeLnk * BSTAVL<Data>::DetachMax(NodeLnk *& nod) noexcept {
+  if (nod == nullptr) {
+    return nullptr;
+  } else if (nod->right == nullptr) {
+    return Skip2Left(nod);
+  }
+  NodeLnk * ret = DetachMax(nod->right);
+  Rebalance(nod);
+  return ret;
+}
+
+template<typename Data>
+inline ulong BSTAVL<Data>::HeightOf(const NodeLnk * nod) noexcept {
+  return (nod != nullptr) ? static_cast<const NodeAVL *>(nod)->height : 0;
+}
+
+// Recomputes height and subtree size from the children
+template<typename Data>
+inline void BSTAVL<Data>::Update(NodeLnk * nod) noexcept {
+  ulong lef = HeightOf(nod->left);
+  ulong rig = HeightOf(nod->right);
+  static_cast<NodeAVL *>(nod)->height = ((lef < rig) ? rig : lef) + 1;
+  static_cast<NodeAVL *>(nod)->count = Count(nod->left) + Count(nod->right) + 1;
+}
+
+template<typename Data>
+void BSTAVL<Data>::Refresh(NodeLnk * nod) noexcept {
+  Update(nod);
+}
+
+template<typename Data>
+void BSTAVL<Data>::Rebalance(NodeLnk *& nod) noexcept {
+  ulong lef = HeightOf(nod->left);
+  ulong rig = HeightOf(nod->right);
+  if (lef > rig + 1) {
+    if (HeightOf(nod->left->left) < HeightOf(nod->left->right)) {
+      RotateLeft(nod->left);
+    }
+    RotateRight(nod);
+  } else if (rig > lef + 1) {
+    if (HeightOf(nod->right->right) < HeightOf(nod->right->left)) {
+      RotateRight(nod->right);
+    }
+    RotateLeft(nod);
+  } else {
+    Update(nod);
+  }
+}
+
+template<typename Data>
+void BSTAVL<Data>::RotateLeft(NodeLnk *& nod) noexcept {
+  this->CountOp(StatOp::Rotation);
+  NodeLnk * rig = nod->right;
+  nod->right = rig->left;
+  rig->left = nod;
+  Update(nod);
+  Update(rig);
+  nod = rig;
+}
+
+template<typename Data>
+void BSTAVL<Data>::RotateRight(NodeLnk *& nod) noexcept {
+  this->CountOp(StatOp::Rotation);
+  NodeLnk * lef = nod->left;
+  nod->left = lef->right;
+  lef->right = nod;
+  Update(nod);
+  Update(lef);
+  nod = lef;
+}
+
+// Fork depth giving at least two threads, and about one per hardware thread
+template<typename Data>
+ulong BSTAVL<Data>::Forks() noexcept {
+  ulong frk = 1;
+  while ((1ul << frk) < std::thread::hardware_concurrency()) {
+    ++frk;
+  }
+  return frk;
+}
+
+// Joins lef < nod < rig (all AVL), descending the spine of the taller tree
+template<typename Data>
+typename BSTAVL<Data>::NodeLnk * BSTAVL<Data>::Join(NodeLnk * lef, NodeLnk * nod, NodeLnk * rig) noexcept {
+  ulong hlef = HeightOf(lef);
+  ulong hrig = HeightOf(rig);
+  if (hlef > hrig + 1) {
+    lef->right = Join(lef->right, nod, rig);
+    Rebalance(lef);
+    return lef;
+  } else if (hrig > hlef + 1) {
+    rig->left = Join(lef, nod, rig->left);
+    Rebalance(rig);
+    return rig;
+  }
+  nod->left = lef;
+  nod->right = rig;
+  Update(nod);
+  return nod;
+}
+
+template<typename Data>
+typename BSTAVL<Data>::NodeLnk * BSTAVL<Data>::Join2(NodeLnk * lef, NodeLnk * rig) noexcept {
+  if (lef == nullptr) {
+    return rig;
+  } else if (rig == nullptr) {
+    return lef;
+  }
+  NodeLnk * nod = DetachLeftmost(rig);
+  return Join(lef, nod, rig);
+}
+
+// Splits nod into the keys smaller (lef) and greater (rig) than dat; returns
+// the (childless) node holding dat, if any
+template<typename Data>
+typename BSTAVL<Data>::NodeLnk * BSTAVL<Data>::Split(NodeLnk * nod, const Data & dat, NodeLnk *& lef, NodeLnk *& rig) noexcept {
+  if (nod == nullptr) {
+    lef = rig = nullptr;
+    return nullptr;
+  }
+  NodeLnk * nlef = nod->left;
+  NodeLnk * nrig = nod->right;
+  nod->left = nod->right = nullptr;
+  NodeLnk * ret;
+  if (dat < nod->element) {
+    NodeLnk * mid;
+    ret = Split(nlef, dat, lef, mid);
+    rig = Join(mid, nod, nrig);
+  } else if (nod->element < dat) {
+    NodeLnk * mid;
+    ret = Split(nrig, dat, mid, rig);
+    lef = Join(nlef, nod, mid);
+  } else {
+    lef = nlef;
+    rig = nrig;
+    ret = nod;
+  }
+  return ret;
+}
+
+// As DetachMin, but leaves size alone (the set algebra may run on several threads)
+template<typename Data>
+typename BSTAVL<Data>::NodeLnk * BSTAVL<Data>::DetachLeftmost(NodeLnk *& nod) noexcept {
+  if (nod->left == nullptr) {
+    NodeLnk * ret = nod;
+    nod = nod->right;
+    ret->right = nullptr;
+    return ret;
+  }
+  NodeLnk * ret = DetachLeftmost(nod->left);
+  Rebalance(nod);
+  return ret;
+}
+
+// The set operations below consume both trees and return the resulting one
+
+template<typename Data>
+typename BSTAVL<Data>::NodeLnk * BSTAVL<Data>::UnionOf(NodeLnk * fst, NodeLnk * snd, ulong frk) {
+  if (fst == nullptr) {
+    return snd;
+  } else if (snd == nullptr) {
+    return fst;
+  }
+  NodeLnk * flef = fst->left;
+  NodeLnk * frig = fst->right;
+  fst->left = fst->right = nullptr;
+  NodeLnk * slef;
+  NodeLnk * srig;
+  delete Split(snd, fst->element, slef, srig);
+  bool par = (frk != 0) && (Count(flef) + Count(frig) + Count(slef) + Count(srig) >= parcutoff);
+  NodeLnk * lef;
+  NodeLnk * rig;
+  ForkJoin(
+    lef, [&, this]() { return UnionOf(flef, slef, frk - par); },
+    rig, [&, this]() { return UnionOf(frig, srig, frk - par); }, par);
+  return Join(lef, fst, rig);
+}
+
+template<typename Data>
+typename BSTAVL<Data>::NodeLnk * BSTAVL<Data>::IntersectionOf(NodeLnk * fst, NodeLnk * snd, ulong frk) {
+  if (fst == nullptr || snd == nullptr) {
+    delete fst;
+    delete snd;
+    return nullptr;
+  }
+  NodeLnk * flef = fst->left;
+  NodeLnk * frig = fst->right;
+  fst->left = fst->right = nullptr;
+  NodeLnk * slef;
+  NodeLnk * srig;
+  NodeLnk * dup = Split(snd, fst->element, slef, srig);
+  bool par = (frk != 0) && (Count(flef) + Count(frig) + Count(slef) + Count(srig) >= parcutoff);
+  NodeLnk * lef;
+  NodeLnk * rig;
+  ForkJoin(
+    lef, [&, this]() { return IntersectionOf(flef, slef, frk - par); },
+    rig, [&, this]() { return IntersectionOf(frig, srig, frk - par); }, par);
+  if (dup != nullptr) {
+    delete dup;
+    return Join(lef, fst, rig);
+  }
+  delete fst;
+  return Join2(lef, rig);
+}
+
+template<typename Data>
+typename BSTAVL<Data>::NodeLnk * BSTAVL<Data>::DifferenceOf(NodeLnk * fst, NodeLnk * snd, ulong frk) {
+  if (fst == nullptr || snd == nullptr) {
+    delete snd;
+    return fst;
+  }
+  NodeLnk * slef = snd->left;
+  NodeLnk * srig = snd->right;
+  snd->left = snd->right = nullptr;
+  NodeLnk * flef;
+  NodeLnk * frig;
+  delete Split(fst, snd->element, flef, frig);
+  delete snd;
+  bool par = (frk != 0) && (Count(flef) + Count(frig) + Count(slef) + Count(srig) >= parcutoff);
+  NodeLnk * lef;
+  NodeLnk * rig;
+  ForkJoin(
+    lef, [&, this]() { return DifferenceOf(flef, slef, frk - par); },
+    rig, [&, this]() { return DifferenceOf(frig, srig, frk - par); }, par);
+  return Join2(lef, rig);
+}
+
+// Computes lef = funlef() on a new thread (if par) while computing rig = funrig()
+template<typename Data>
+template<typename FunLef, typename FunRig>
+void BSTAVL<Data>::ForkJoin(NodeLnk *& lef, FunLef funlef, NodeLnk *& rig, FunRig funrig, bool par) {
+  if (par) {
+    std::thread thr([&lef, &funlef]() { lef = funlef(); });
+    rig = funrig();
+    thr.join();
+  } else {
+    lef = funlef();
+    rig = funrig();
+  }
+}
+
+template<typename Data>
+void BSTAVL<Data>::Assign(const BST<Data> & bst) {
+  const BSTAVL<Data> * avl = dynamic_cast<const BSTAVL<Data> *>(&bst);
+  BSTAVL<Data> tmpbst = (avl != nullptr) ? BSTAVL<Data>(*avl) : BSTAVL<Data>(static_cast<const TraversableContainer<Data> &>(bst));
+  std::swap(root, tmpbst.root);
+  std::swap(size, tmpbst.size);
+}
+
+// (copies, rather than steals, the nodes of a BST of another kind)
+template<typename Data>
+void BSTAVL<Data>::Assign(BST<Data> && bst) {
+  BSTAVL<Data> * avl = dynamic_cast<BSTAVL<Data> *>(&bst);
+  if (avl != nullptr) {
+    std::swap(root, avl->root);
+    std::swap(size, avl->size);
+  } else {
+    Assign(static_cast<const BST<Data> &>(bst));
+  }
+}
+
+template<typename Data>
+typename BSTAVL<Data>::NodeLnk * BSTAVL<Data>::Clone(const NodeLnk * nod) {
+  if (nod == nullptr) {
+    return nullptr;
+  }
+  NodeAVL * cln = new NodeAVL(nod->element);
+  cln->height = static_cast<const NodeAVL *>(nod)->height;
+  cln->count = Count(nod);
+  cln->left = Clone(nod->left);
+  cln->right = Clone(nod->right);
+  return cln;
+}
+
+/* ************************************************************************** */
+
+}
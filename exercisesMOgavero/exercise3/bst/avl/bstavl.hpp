@@ -0,0 +1,187 @@
+
+#ifndef BSTAVL_HPP
+#define BSTAVL_HPP
+
+/* ************************************************************************** */
+
+#include <thread>
+
+/* ************************************************************************** */
+
+#include "../bst.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Height-balanced (AVL) binary search tree: every update rebalances the path
+// back to the root with rotations, so the height stays below 1.44 log(n)
+
+template <typename Data>
+class BSTAVL : virtual public BST<Data> {
+
+private:
+
+protected:
+
+  using typename BST<Data>::NodeLnk;
+  using typename BST<Data>::NodeBST;
+
+  using BST<Data>::size;
+  using BST<Data>::root;
+
+  using BST<Data>::DataNDelete;
+  using BST<Data>::Count;
+  using BST<Data>::Skip2Left;
+  using BST<Data>::Skip2Right;
+  using BST<Data>::IsSorted;
+
+  struct NodeAVL : NodeBST {
+
+    ulong height = 1;
+
+    /* ********************************************************************** */
+
+    // Specific constructors
+    NodeAVL(const Data & dat) : NodeBST(dat) {};
+    NodeAVL(Data && dat) noexcept : NodeBST(std::move(dat)) {};
+
+  };
+
+public:
+
+  // Default constructor
+  BSTAVL() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  BSTAVL(const TraversableContainer<Data> &);
+  BSTAVL(MappableContainer<Data> &&);
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  BSTAVL(const BSTAVL &);
+
+  // Move constructor
+  BSTAVL(BSTAVL &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~BSTAVL() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  BSTAVL & operator=(const BSTAVL &);
+
+  // Move assignment
+  BSTAVL & operator=(BSTAVL &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  using BST<Data>::operator==;
+  inline bool operator==(const BSTAVL &) const noexcept;
+  using BST<Data>::operator!=;
+  inline bool operator!=(const BSTAVL &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from BST)
+
+  Data PredecessorNRemove(const Data &) override;
+  void RemovePredecessor(const Data &) override;
+
+  Data SuccessorNRemove(const Data &) override;
+  void RemoveSuccessor(const Data &) override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data &) override;
+  bool Insert(Data &&) override;
+  bool Remove(const Data &) override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  ulong Height() const noexcept;
+
+  using BST<Data>::Rebalance;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (set algebra by split and join, O(m log(n/m + 1)))
+  // The rvalue versions consume the argument instead of copying it; the flag
+  // forks the two recursive halves onto separate threads for large inputs.
+
+  void Union(const BSTAVL &, bool = false);
+  void Union(BSTAVL &&, bool = false);
+  void Intersect(const BSTAVL &, bool = false);
+  void Intersect(BSTAVL &&, bool = false);
+  void Difference(const BSTAVL &, bool = false);
+  void Difference(BSTAVL &&, bool = false);
+
+protected:
+
+  // Auxiliary member functions
+
+  template <typename Val>
+  bool InsertAt(NodeLnk *&, Val &&);
+
+  virtual NodeLnk * DetachKey(NodeLnk *&, const Data &) noexcept;
+
+  NodeLnk * DetachMin(NodeLnk *&) noexcept override;
+  NodeLnk * DetachMax(NodeLnk *&) noexcept override;
+
+  static inline ulong HeightOf(const NodeLnk *) noexcept;
+  static inline void Update(NodeLnk *) noexcept;
+  void Refresh(NodeLnk *) noexcept override;
+
+  void Rebalance(NodeLnk *&) noexcept;
+  void RotateLeft(NodeLnk *&) noexcept;
+  void RotateRight(NodeLnk *&) noexcept;
+
+  static NodeLnk * Clone(const NodeLnk *);
+
+  // From a BST of another kind the nodes are rebuilt (balanced) from its keys
+  void Assign(const BST<Data> &) override;
+  void Assign(BST<Data> &&) override;
+
+  static const ulong parcutoff = 8192; // (minimum nodes for a fork)
+  static ulong Forks() noexcept;
+
+  NodeLnk * Join(NodeLnk *, NodeLnk *, NodeLnk *) noexcept;
+  NodeLnk * Join2(NodeLnk *, NodeLnk *) noexcept;
+  NodeLnk * Split(NodeLnk *, const Data &, NodeLnk *&, NodeLnk *&) noexcept;
+  NodeLnk * DetachLeftmost(NodeLnk *&) noexcept;
+
+  NodeLnk * UnionOf(NodeLnk *, NodeLnk *, ulong);
+  NodeLnk * IntersectionOf(NodeLnk *, NodeLnk *, ulong);
+  NodeLnk * DifferenceOf(NodeLnk *, NodeLnk *, ulong);
+
+  template <typename FunLef, typename FunRig>
+  static void ForkJoin(NodeLnk *&, FunLef, NodeLnk *&, FunRig, bool);
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "bstavl.cpp"
+
+#endif
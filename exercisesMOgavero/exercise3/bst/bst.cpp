@@ -7,20 +7,37 @@ namespace lasd {
 
 template<typename Data>
 BST<Data>::BST(const TraversableContainer<Data> & con) {
-  con.Traverse(
-    [this](const Data & dat) {
-      Insert(dat);
-    }
-  );
+  if (IsSorted(con)) {
+    BuildSorted<NodeBST>(con);
+  } else {
+    con.Traverse(
+      [this](const Data & dat) {
+        Insert(dat);
+      }
+    );
+  }
 }
 
 template<typename Data>
 BST<Data>::BST(MappableContainer<Data> && con) {
-  con.Map(
-    [this](Data & dat) {
-      Insert(std::move(dat));
-    }
-  );
+  if (IsSorted(con)) {
+    BuildSorted<NodeBST>(std::move(con));
+  } else {
+    con.Map(
+      [this](Data & dat) {
+        Insert(std::move(dat));
+      }
+    );
+  }
+}
+
+/* ************************************************************************** */
+
+// Copy constructor (BST)
+template<typename Data>
+BST<Data>::BST(const BST<Data> & bst) {
+  root = Clone(bst.root);
+  size = bst.size;
 }
 
 /* ************************************************************************** */
@@ -28,14 +45,14 @@ BST<Data>::BST(MappableContainer<Data> && con) {
 // Copy assignment (BST)
 template<typename Data>
 BST<Data> & BST<Data>::operator=(const BST<Data> & bst) {
-  BinaryTreeLnk<Data>::operator=(bst);
+  Assign(bst);
   return *this;
 }
 
 // Move assignment (BST)
 template<typename Data>
-BST<Data> & BST<Data>::operator=(BST<Data> && bst) noexcept {
-  BinaryTreeLnk<Data>::operator=(std::move(bst));
+BST<Data> & BST<Data>::operator=(BST<Data> && bst) {
+  Assign(std::move(bst));
   return *this;
 }
 
@@ -135,6 +152,7 @@ template<typename Data>
 Data BST<Data>::PredecessorNRemove(const Data & dat) {
   NodeLnk ** ptr = FindPointerToPredecessor(root, dat);
   if (ptr != nullptr) {
+    Recount((*ptr)->element, false);
     return DataNDelete(Detach(*ptr));
   } else {
     throw std::length_error("Predecessor out of bound.");
@@ -145,6 +163,7 @@ template<typename Data>
 void BST<Data>::RemovePredecessor(const Data & dat) {
   NodeLnk ** ptr = FindPointerToPredecessor(root, dat);
   if (ptr != nullptr) {
+    Recount((*ptr)->element, false);
     delete Detach(*ptr);
   } else {
     throw std::length_error("Predecessor out of bound.");
@@ -165,6 +184,7 @@ template<typename Data>
 Data BST<Data>::SuccessorNRemove(const Data & dat) {
   NodeLnk ** ptr = FindPointerToSuccessor(root, dat);
   if (ptr != nullptr) {
+    Recount((*ptr)->element, false);
     return DataNDelete(Detach(*ptr));
   } else {
     throw std::length_error("Successor out of bound.");
@@ -175,6 +195,7 @@ template<typename Data>
 void BST<Data>::RemoveSuccessor(const Data & dat) {
   NodeLnk ** ptr = FindPointerToSuccessor(root, dat);
   if (ptr != nullptr) {
+    Recount((*ptr)->element, false);
     delete Detach(*ptr);
   } else {
     throw std::length_error("Successor out of bound.");
@@ -183,6 +204,177 @@ void BST<Data>::RemoveSuccessor(const Data & dat) {
 
 /* ************************************************************************** */
 
+// Specific member functions (BST) (order statistics)
+
+template<typename Data>
+const Data & BST<Data>::Select(ulong idx) const {
+  if (idx >= size) {
+    throw std::out_of_range("Access at index " + std::to_string(idx) + "; tree size " + std::to_string(size) + ".");
+  }
+  const NodeLnk * cur = root;
+  while (true) {
+    ulong lef = Count(cur->left);
+    if (idx < lef) {
+      cur = cur->left;
+    } else if (idx > lef) {
+      idx -= lef + 1;
+      cur = cur->right;
+    } else {
+      return cur->element;
+    }
+  }
+}
+
+template<typename Data>
+ulong BST<Data>::Rank(const Data & dat) const noexcept {
+  ulong rnk = 0;
+  const NodeLnk * cur = root;
+  while (cur != nullptr) {
+    if (cur->element < dat) {
+      rnk += Count(cur->left) + 1;
+      cur = cur->right;
+    } else {
+      cur = cur->left;
+    }
+  }
+  return rnk;
+}
+
+template<typename Data>
+ulong BST<Data>::CountRange(const Data & lo, const Data & hi) const noexcept {
+  return (lo < hi) ? (Rank(hi) - Rank(lo)) : 0;
+}
+
+template<typename Data>
+inline const Data & BST<Data>::operator[](ulong idx) const {
+  return Select(idx);
+}
+
+/* ************************************************************************** */
+
+// Specific member function (BST) (balancing)
+
+template<typename Data>
+void BST<Data>::Rebalance() {
+  Vector<NodeLnk *> nodes(size);
+  StackVec<NodeLnk *> stk;
+  NodeLnk * cur = root;
+  ulong idx = 0;
+  while (cur != nullptr || !stk.Empty()) {
+    while (cur != nullptr) {
+      stk.Push(cur);
+      cur = cur->left;
+    }
+    cur = stk.TopNPop();
+    nodes[idx++] = cur;
+    cur = cur->right;
+  }
+  root = Build(nodes, 0, size);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (BST) (range queries)
+
+template<typename Data>
+void BST<Data>::RangeTraverse(const Data & lo, const Data & hi, TraverseFun fun) const {
+  auto vis = [&fun](NodeLnk * nod) { fun(nod->element); };
+  RangeVisit(root, lo, hi, vis);
+}
+
+template<typename Data>
+void BST<Data>::RangeMap(const Data & lo, const Data & hi, MapFun fun) {
+  auto vis = [&fun](NodeLnk * nod) { fun(nod->element); };
+  RangeVisit(root, lo, hi, vis);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (BST) (STL iterator)
+
+template<typename Data>
+typename BST<Data>::const_iterator BST<Data>::begin() const {
+  ConstIterator itr(this, nullptr);
+  if (root != nullptr) {
+    itr.PushLeft(root);
+  }
+  return itr;
+}
+
+template<typename Data>
+void BST<Data>::ConstIterator::PushLeft(const NodeLnk * nod) {
+  while (nod->left != nullptr) {
+    stk.Push(nod);
+    nod = nod->left;
+  }
+  cur = nod;
+}
+
+template<typename Data>
+void BST<Data>::ConstIterator::PushRight(const NodeLnk * nod) {
+  while (nod->right != nullptr) {
+    stk.Push(nod);
+    nod = nod->right;
+  }
+  cur = nod;
+}
+
+template<typename Data>
+typename BST<Data>::ConstIterator & BST<Data>::ConstIterator::operator++() {
+  if (cur->right != nullptr) {
+    stk.Push(cur);
+    PushLeft(cur->right);
+  } else {
+    // Nearest ancestor having cur in its left subtree
+    const NodeLnk * chd = cur;
+    cur = nullptr;
+    while (!stk.Empty()) {
+      const NodeLnk * nod = stk.TopNPop();
+      if (nod->left == chd) {
+        cur = nod;
+        break;
+      }
+      chd = nod;
+    }
+  }
+  return *this;
+}
+
+template<typename Data>
+typename BST<Data>::ConstIterator & BST<Data>::ConstIterator::operator--() {
+  if (cur == nullptr) {
+    stk.Clear();
+    PushRight(tree->root);
+  } else if (cur->left != nullptr) {
+    stk.Push(cur);
+    PushRight(cur->left);
+  } else {
+    // Nearest ancestor having cur in its right subtree
+    const NodeLnk * chd = cur;
+    cur = nullptr;
+    while (!stk.Empty()) {
+      const NodeLnk * nod = stk.TopNPop();
+      if (nod->right == chd) {
+        cur = nod;
+        break;
+      }
+      chd = nod;
+    }
+  }
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// Specific member function (BST) (inherited from Container)
+
+template<typename Data>
+MemStats BST<Data>::MemoryUsage() const noexcept {
+  return this->template NodesMemory<NodeBST>(sizeof(*this));
+}
+
+/* ************************************************************************** */
+
 // Specific member functions (BST) (inherited from TestableContainer)
 
 template<typename Data>
@@ -190,6 +382,22 @@ bool BST<Data>::Exists(const Data & dat) const noexcept {
   return (FindPointerTo(root, dat) != nullptr);
 }
 
+template<typename Data>
+template<typename Key>
+bool BST<Data>::Exists(const Key & key) const noexcept {
+  const NodeLnk * cur = root;
+  while (cur != nullptr) {
+    if (cur->element < key) {
+      cur = cur->right;
+    } else if (cur->element > key) {
+      cur = cur->left;
+    } else {
+      return true;
+    }
+  }
+  return false;
+}
+
 /* ************************************************************************** */
 
 // Specific member functions (BST) (inherited from DictionaryContainer)
@@ -198,7 +406,8 @@ template<typename Data>
 bool BST<Data>::Insert(const Data & dat) {
   NodeLnk *& ptr = FindPointerTo(root, dat);
   if (ptr == nullptr) {
-    ptr = new NodeLnk(dat);
+    Recount(dat, true);
+    ptr = new NodeBST(dat);
     size++;
     return true;
   }
@@ -209,7 +418,8 @@ template<typename Data>
 bool BST<Data>::Insert(Data && dat) {
   NodeLnk *& ptr = FindPointerTo(root, dat);
   if (ptr == nullptr) {
-    ptr = new NodeLnk(std::move(dat));
+    Recount(dat, true);
+    ptr = new NodeBST(std::move(dat));
     size++;
     return true;
   }
@@ -220,6 +430,7 @@ template<typename Data>
 bool BST<Data>::Remove(const Data & dat) {
   NodeLnk *& ptr = FindPointerTo(root, dat);
   if (ptr != nullptr) {
+    Recount(dat, false);
     delete Detach(ptr);
     return true;
   }
@@ -238,6 +449,146 @@ Data BST<Data>::DataNDelete(NodeLnk * ptr) {
   return dat;
 }
 
+template<typename Data>
+inline ulong BST<Data>::Count(const NodeLnk * nod) noexcept {
+  return (nod != nullptr) ? static_cast<const NodeBST *>(nod)->count : 0;
+}
+
+// Adjusts the subtree sizes on the path from the root down to dat (excluded)
+template<typename Data>
+void BST<Data>::Recount(const Data & dat, bool inc) noexcept {
+  NodeLnk * cur = root;
+  while (cur != nullptr) {
+    NodeLnk * nxt;
+    if (cur->element < dat) {
+      nxt = cur->right;
+    } else if (cur->element > dat) {
+      nxt = cur->left;
+    } else {
+      break;
+    }
+    ulong & cnt = static_cast<NodeBST *>(cur)->count;
+    cnt = inc ? (cnt + 1) : (cnt - 1);
+    cur = nxt;
+  }
+}
+
+template<typename Data>
+typename BST<Data>::NodeLnk * BST<Data>::Clone(const NodeLnk * nod) {
+  if (nod == nullptr) {
+    return nullptr;
+  }
+  NodeBST * cln = new NodeBST(nod->element);
+  cln->count = Count(nod);
+  cln->left = Clone(nod->left);
+  cln->right = Clone(nod->right);
+  return cln;
+}
+
+template<typename Data>
+void BST<Data>::Assign(const BST<Data> & bst) {
+  BST<Data> tmpbst(bst);
+  std::swap(root, tmpbst.root);
+  std::swap(size, tmpbst.size);
+}
+
+// (copies, rather than steals, the nodes of a BST of another kind)
+template<typename Data>
+void BST<Data>::Assign(BST<Data> && bst) {
+  if (typeid(bst) == typeid(*this)) {
+    std::swap(root, bst.root);
+    std::swap(size, bst.size);
+  } else {
+    Assign(static_cast<const BST<Data> &>(bst));
+  }
+}
+
+// Whether the traversal yields non-decreasing keys
+template<typename Data>
+bool BST<Data>::IsSorted(const TraversableContainer<Data> & con) {
+  const Data * prv = nullptr; // (the traversal yields the stored elements)
+  bool srt = true;
+  con.Traverse(
+    [&prv, &srt](const Data & dat) {
+      if (srt) {
+        srt = (prv == nullptr) || !(dat < *prv);
+        prv = &dat;
+      }
+    }
+  );
+  return srt;
+}
+
+// Allocates one node per distinct key of the sorted container, then links them
+template<typename Data>
+template<typename NodeType>
+void BST<Data>::BuildSorted(const TraversableContainer<Data> & con) {
+  Vector<NodeLnk *> nodes(con.Size());
+  ulong cnt = 0;
+  con.Traverse(
+    [&nodes, &cnt](const Data & dat) {
+      if (cnt == 0 || nodes[cnt - 1]->element < dat) {
+        nodes[cnt++] = new NodeType(dat);
+      }
+    }
+  );
+  root = Build(nodes, 0, cnt);
+  size = cnt;
+}
+
+template<typename Data>
+template<typename NodeType>
+void BST<Data>::BuildSorted(MappableContainer<Data> && con) {
+  Vector<NodeLnk *> nodes(con.Size());
+  ulong cnt = 0;
+  con.Map(
+    [&nodes, &cnt](Data & dat) {
+      if (cnt == 0 || nodes[cnt - 1]->element < dat) {
+        nodes[cnt++] = new NodeType(std::move(dat));
+      }
+    }
+  );
+  root = Build(nodes, 0, cnt);
+  size = cnt;
+}
+
+// Links nodes[lo, hi) (in key order) into a perfectly balanced subtree
+template<typename Data>
+typename BST<Data>::NodeLnk * BST<Data>::Build(Vector<NodeLnk *> & nodes, ulong lo, ulong hi) noexcept {
+  if (lo >= hi) {
+    return nullptr;
+  }
+  ulong mid = lo + (hi - lo) / 2;
+  NodeLnk * nod = nodes[mid];
+  nod->left = Build(nodes, lo, mid);
+  nod->right = Build(nodes, mid + 1, hi);
+  Refresh(nod);
+  return nod;
+}
+
+// Recomputes the node fields which depend on its children
+template<typename Data>
+void BST<Data>::Refresh(NodeLnk * nod) noexcept {
+  static_cast<NodeBST *>(nod)->count = Count(nod->left) + Count(nod->right) + 1;
+}
+
+// Visits in order the nodes with key in [lo, hi), skipping the subtrees out of range
+template<typename Data>
+template<typename Fun>
+void BST<Data>::RangeVisit(NodeLnk * nod, const Data & lo, const Data & hi, Fun & vis) {
+  while (nod != nullptr) {
+    if (nod->element < lo) {
+      nod = nod->right;
+    } else if (!(nod->element < hi)) {
+      nod = nod->left;
+    } else {
+      RangeVisit(nod->left, lo, hi, vis);
+      vis(nod);
+      nod = nod->right;
+    }
+  }
+}
+
 template<typename Data>
 typename BST<Data>::NodeLnk * BST<Data>::Detach(NodeLnk *& nod) noexcept {
   if (nod != nullptr) {
@@ -248,6 +599,7 @@ typename BST<Data>::NodeLnk * BST<Data>::Detach(NodeLnk *& nod) noexcept {
     } else {
       NodeLnk * max = DetachMax(nod->left);
       std::swap(nod->element, max->element);
+      --static_cast<NodeBST *>(nod)->count;
       return max;
     }
   }
@@ -256,11 +608,17 @@ typename BST<Data>::NodeLnk * BST<Data>::Detach(NodeLnk *& nod) noexcept {
 
 template<typename Data>
 typename BST<Data>::NodeLnk * BST<Data>::DetachMin(NodeLnk *& nod) noexcept {
+  for (NodeLnk * cur = nod; (cur != nullptr) && (cur->left != nullptr); cur = cur->left) {
+    --static_cast<NodeBST *>(cur)->count;
+  }
   return Skip2Right(FindPointerToMin(nod));
 }
 
 template<typename Data>
 typename BST<Data>::NodeLnk * BST<Data>::DetachMax(NodeLnk *& nod) noexcept {
+  for (NodeLnk * cur = nod; (cur != nullptr) && (cur->right != nullptr); cur = cur->right) {
+    --static_cast<NodeBST *>(cur)->count;
+  }
   return Skip2Left(FindPointerToMax(nod));
 }
 
@@ -333,12 +691,15 @@ const typename BST<Data>::NodeLnk * const & BST<Data>::FindPointerTo(const NodeL
   const NodeLnk * cur = nod;
   while (cur != nullptr) {
     if (cur->element < dat) {
+      CountOp(StatOp::Comparison);
       ptr = &cur->right;
       cur = cur->right;
     } else if (cur->element > dat) {
+      CountOp(StatOp::Comparison, 2);
       ptr = &cur->left;
       cur = cur->left;
     } else {
+      CountOp(StatOp::Comparison, 2);
       break;
     }
   }
@@ -356,6 +717,7 @@ const typename BST<Data>::NodeLnk * const * BST<Data>::FindPointerToPredecessor(
   const NodeLnk * const * prd = nullptr;
   while (true) {
     const NodeLnk & cur = **ptr;
+    CountOp(StatOp::Comparison);
     if (cur.element < dat) {
       prd = ptr;
       if (cur.right == nullptr) {
@@ -367,6 +729,7 @@ const typename BST<Data>::NodeLnk * const * BST<Data>::FindPointerToPredecessor(
       if (cur.left == nullptr) {
         return prd;
       } else {
+        CountOp(StatOp::Comparison);
         if (cur.element > dat) {
           ptr = &cur.left;
         } else {
@@ -388,6 +751,7 @@ const typename BST<Data>::NodeLnk * const * BST<Data>::FindPointerToSuccessor(co
   const NodeLnk * const * prd = nullptr;
   while (true) {
     const NodeLnk & cur = **ptr;
+    CountOp(StatOp::Comparison);
     if (cur.element > dat) {
       prd = ptr;
       if (cur.left == nullptr) {
@@ -399,6 +763,7 @@ const typename BST<Data>::NodeLnk * const * BST<Data>::FindPointerToSuccessor(co
       if (cur.right == nullptr) {
         return prd;
       } else {
+        CountOp(StatOp::Comparison);
         if (cur.element < dat) {
           ptr = &cur.right;
         } else {
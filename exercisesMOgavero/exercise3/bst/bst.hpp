@@ -4,7 +4,14 @@
 
 /* ************************************************************************** */
 
+#include <cstddef>
+#include <iterator>
+#include <typeinfo>
+
+/* ************************************************************************** */
+
 #include "../binarytree/lnk/binarytreelnk.hpp"
+#include "../stats/stats.hpp"
 
 /* ************************************************************************** */
 
@@ -16,7 +23,8 @@ template <typename Data>
 class BST : virtual public ClearableContainer,
   virtual public DictionaryContainer<Data>,
   virtual public BinaryTree<Data>,
-  virtual protected BinaryTreeLnk<Data> {
+  virtual protected BinaryTreeLnk<Data>,
+  public StatsPolicy {
 
 private:
 
@@ -27,6 +35,18 @@ protected:
   using BinaryTreeLnk<Data>::size;
   using BinaryTreeLnk<Data>::root;
 
+  struct NodeBST : NodeLnk {
+
+    ulong count = 1; // Nodes in the subtree rooted here
+
+    /* ********************************************************************** */
+
+    // Specific constructors
+    NodeBST(const Data & dat) : NodeLnk(dat) {};
+    NodeBST(Data && dat) noexcept : NodeLnk(std::move(dat)) {};
+
+  };
+
 public:
 
   // Default constructor
@@ -41,7 +61,7 @@ public:
   /* ************************************************************************ */
 
   // Copy constructor
-  BST(const BST & bst) : BinaryTreeLnk<Data>(bst) {};
+  BST(const BST &);
 
   // Move constructor
   BST(BST && bst) noexcept : BinaryTreeLnk<Data>(std::move(bst)) {};
@@ -56,8 +76,8 @@ public:
   // Copy assignment
   BST & operator=(const BST &);
 
-  // Move assignment
-  BST & operator=(BST &&) noexcept;
+  // Move assignment (copies from a BST of another kind, so it may throw)
+  BST & operator=(BST &&);
 
   /* ************************************************************************ */
 
@@ -89,6 +109,90 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member functions (order statistics, O(height))
+
+  const Data & Select(ulong) const; // (k-th smallest, from 0)
+  ulong Rank(const Data &) const noexcept; // (keys smaller than the given one)
+  ulong CountRange(const Data &, const Data &) const noexcept; // (keys in [lo, hi))
+
+  inline const Data & operator[](ulong) const;
+
+  /* ************************************************************************ */
+
+  // Specific member function (rebuilds a perfectly balanced tree, O(n))
+
+  void Rebalance();
+
+  /* ************************************************************************ */
+
+  // Specific member functions (range queries, O(height + reported keys))
+
+  using typename BinaryTree<Data>::TraverseFun;
+  using typename MappableContainer<Data>::MapFun;
+
+  void RangeTraverse(const Data &, const Data &, TraverseFun) const; // (keys in [lo, hi), in order)
+  void RangeMap(const Data &, const Data &, MapFun); // (fun must not change the relative order of the keys)
+
+  /* ************************************************************************ */
+
+  // STL bidirectional iterator (in order, read-only; end is the null node).
+  // It keeps the ancestors of the current node on a stack, so a full scan
+  // visits every edge twice and a step is amortized O(1).
+
+  class ConstIterator {
+
+  private:
+
+    friend class BST;
+
+    const BST * tree = nullptr;
+    const NodeLnk * cur = nullptr;
+    StackVec<const NodeLnk *> stk; // Ancestors of cur, the root at the bottom
+
+    ConstIterator(const BST * bst, const NodeLnk * nod) : tree(bst), cur(nod) {}
+
+    void PushLeft(const NodeLnk *); // Down to the minimum of the subtree
+    void PushRight(const NodeLnk *); // Down to the maximum of the subtree
+
+  public:
+
+    using iterator_concept = std::bidirectional_iterator_tag;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Data;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Data *;
+    using reference = const Data &;
+
+    ConstIterator() = default;
+
+    reference operator*() const noexcept { return cur->element; }
+    pointer operator->() const noexcept { return &cur->element; }
+
+    ConstIterator & operator++();
+    ConstIterator operator++(int) { ConstIterator tmp(*this); ++*this; return tmp; }
+    ConstIterator & operator--(); // (from end, it moves to the maximum)
+    ConstIterator operator--(int) { ConstIterator tmp(*this); --*this; return tmp; }
+
+    friend bool operator==(const ConstIterator & itr1, const ConstIterator & itr2) noexcept { return (itr1.cur == itr2.cur); }
+
+  };
+
+  using iterator = ConstIterator;
+  using const_iterator = ConstIterator;
+
+  const_iterator begin() const;
+  inline const_iterator end() const { return ConstIterator(this, nullptr); }
+  inline const_iterator cbegin() const { return begin(); }
+  inline const_iterator cend() const { return end(); }
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override;
+
+  /* ************************************************************************ */
+
   // Specific member function (inherited from ClearableContainer)
 
   using BinaryTreeLnk<Data>::Clear;
@@ -99,6 +203,10 @@ public:
 
   bool Exists(const Data &) const noexcept override;
 
+  // Heterogeneous lookup (Key ordered consistently with Data)
+  template <typename Key>
+  bool Exists(const Key &) const noexcept;
+
   /* ************************************************************************ */
 
   // Specific member functions (inherited from DictionaryContainer)
@@ -117,6 +225,29 @@ protected:
 
   virtual Data DataNDelete(NodeLnk *);
 
+  static inline ulong Count(const NodeLnk *) noexcept;
+  void Recount(const Data &, bool) noexcept;
+
+  static NodeLnk * Clone(const NodeLnk *);
+
+  // Assignment from any BST, with the node type of *this (operator= through
+  // a BST reference ends up here); nodes are stolen only from the same type
+  virtual void Assign(const BST &);
+  virtual void Assign(BST &&);
+
+  static bool IsSorted(const TraversableContainer<Data> &);
+
+  template <typename NodeType>
+  void BuildSorted(const TraversableContainer<Data> &);
+  template <typename NodeType>
+  void BuildSorted(MappableContainer<Data> &&);
+
+  NodeLnk * Build(Vector<NodeLnk *> &, ulong, ulong) noexcept;
+  virtual void Refresh(NodeLnk *) noexcept;
+
+  template <typename Fun>
+  static void RangeVisit(NodeLnk *, const Data &, const Data &, Fun &);
+
   virtual NodeLnk * Detach(NodeLnk *&) noexcept;
 
   virtual NodeLnk * DetachMin(NodeLnk *&) noexcept;
@@ -142,6 +273,147 @@ protected:
 
 /* ************************************************************************** */
 
+// In-order iterator over the keys in [lo, hi): it starts from the first key
+// not smaller than lo (the stack holds only its ancestors greater than it)
+// and stops at the first key not smaller than hi.
+
+template <typename Data>
+class BSTRangeIterator : virtual public ForwardIterator<Data>,
+  virtual public ResettableIterator<Data> {
+
+private:
+
+protected:
+
+  const typename BinaryTree<Data>::Node * root = nullptr;
+  Data lo {};
+  Data hi {};
+  StackVec<const typename BinaryTree<Data>::Node *> stk;
+
+public:
+
+  // Specific constructors
+  BSTRangeIterator(const BST<Data> & bst, const Data & newlo, const Data & newhi) : lo(newlo), hi(newhi) {
+    if (bst.Size() != 0) {
+      root = &bst.Root();
+      SearchLowerBound();
+    }
+  };
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  BSTRangeIterator(const BSTRangeIterator & itr) : root(itr.root), lo(itr.lo), hi(itr.hi), stk(itr.stk) {}
+
+  // Move constructor
+  BSTRangeIterator(BSTRangeIterator && itr) noexcept {
+    std::swap(root, itr.root);
+    std::swap(lo, itr.lo);
+    std::swap(hi, itr.hi);
+    std::swap(stk, itr.stk);
+  }
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~BSTRangeIterator() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  BSTRangeIterator & operator=(const BSTRangeIterator & itr) {
+    root = itr.root;
+    lo = itr.lo;
+    hi = itr.hi;
+    stk = itr.stk;
+    return *this;
+  }
+
+  // Move assignment
+  BSTRangeIterator & operator=(BSTRangeIterator && itr) noexcept {
+    std::swap(root, itr.root);
+    std::swap(lo, itr.lo);
+    std::swap(hi, itr.hi);
+    std::swap(stk, itr.stk);
+    return *this;
+  }
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  inline bool operator==(const BSTRangeIterator &) const noexcept = default;
+  inline bool operator!=(const BSTRangeIterator &) const noexcept = default;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from Iterator)
+
+  const Data & operator*() const override {
+    if (!Terminated()) {
+      return stk.Top()->Element();
+    } else {
+      throw std::out_of_range("The iterator is terminated.");
+    }
+  };
+
+  bool Terminated() const noexcept override {
+    return (stk.Empty() || !(stk.Top()->Element() < hi));
+  };
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ForwardIterator)
+
+  ForwardIterator<Data> & operator++() override {
+    if (Terminated()) {
+      throw std::out_of_range("The iterator is terminated.");
+    }
+    const typename BinaryTree<Data>::Node & curr = *stk.TopNPop();
+    if (curr.HasRightChild()) {
+      stk.Push(&curr.RightChild());
+      SearchLeftMostNode();
+    }
+    return *this;
+  };
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ResettableIterator)
+
+  void Reset() noexcept override {
+    stk.Clear();
+    if (root != nullptr) {
+      SearchLowerBound();
+    }
+  };
+
+protected:
+
+  // Auxiliary member functions
+
+  void SearchLowerBound() {
+    const typename BinaryTree<Data>::Node * curr = root;
+    while (curr != nullptr) {
+      if (curr->Element() < lo) {
+        curr = curr->HasRightChild() ? &curr->RightChild() : nullptr;
+      } else {
+        stk.Push(curr);
+        curr = curr->HasLeftChild() ? &curr->LeftChild() : nullptr;
+      }
+    }
+  }
+
+  void SearchLeftMostNode() {
+    const typename BinaryTree<Data>::Node * curr;
+    while ((curr = stk.Top())->HasLeftChild()) {
+      stk.Push(&curr->LeftChild());
+    }
+  }
+
+};
+
+/* ************************************************************************** */
+
 }
 
 #include "bst.cpp"
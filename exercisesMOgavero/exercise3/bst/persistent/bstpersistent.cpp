@@ -0,0 +1,397 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Specific constructors (NodePst)
+
+template<typename Data>
+BSTPersistent<Data>::NodePst::NodePst(const Data & dat, NodePtr lef, NodePtr rig) : element(dat), left(std::move(lef)), right(std::move(rig)) {
+  ulong hgtlef = HeightOf(left);
+  ulong hgtrig = HeightOf(right);
+  height = ((hgtlef < hgtrig) ? hgtrig : hgtlef) + 1;
+  count = CountOf(left) + CountOf(right) + 1;
+}
+
+template<typename Data>
+BSTPersistent<Data>::NodePst::NodePst(Data && dat, NodePtr lef, NodePtr rig) noexcept : element(std::move(dat)), left(std::move(lef)), right(std::move(rig)) {
+  ulong hgtlef = HeightOf(left);
+  ulong hgtrig = HeightOf(right);
+  height = ((hgtlef < hgtrig) ? hgtrig : hgtlef) + 1;
+  count = CountOf(left) + CountOf(right) + 1;
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (NodePst) (inherited from Node)
+
+template<typename Data>
+inline const Data & BSTPersistent<Data>::NodePst::Element() const noexcept {
+  return element;
+}
+
+template<typename Data>
+inline bool BSTPersistent<Data>::NodePst::IsLeaf() const noexcept {
+  return ((left == nullptr) && (right == nullptr));
+}
+
+template<typename Data>
+inline bool BSTPersistent<Data>::NodePst::HasLeftChild() const noexcept {
+  return (left != nullptr);
+}
+
+template<typename Data>
+inline bool BSTPersistent<Data>::NodePst::HasRightChild() const noexcept {
+  return (right != nullptr);
+}
+
+template<typename Data>
+inline const typename BSTPersistent<Data>::Node & BSTPersistent<Data>::NodePst::LeftChild() const {
+  if (left != nullptr) {
+    return *left;
+  } else {
+    throw std::out_of_range("Left child does not exists.");
+  }
+}
+
+template<typename Data>
+inline const typename BSTPersistent<Data>::Node & BSTPersistent<Data>::NodePst::RightChild() const {
+  if (right != nullptr) {
+    return *right;
+  } else {
+    throw std::out_of_range("Right child does not exists.");
+  }
+}
+
+/* ************************************************************************** */
+
+// Specific constructors (BSTPersistent)
+
+template<typename Data>
+BSTPersistent<Data>::BSTPersistent(const TraversableContainer<Data> & con) {
+  con.Traverse(
+    [this](const Data & dat) {
+      Insert(dat);
+    }
+  );
+}
+
+template<typename Data>
+BSTPersistent<Data>::BSTPersistent(MappableContainer<Data> && con) {
+  con.Map(
+    [this](Data & dat) {
+      Insert(std::move(dat));
+    }
+  );
+}
+
+/* ************************************************************************** */
+
+// Copy constructor (BSTPersistent)
+
+template<typename Data>
+BSTPersistent<Data>::BSTPersistent(const BSTPersistent<Data> & bst) {
+  Publish(bst.Current());
+}
+
+// Move constructor (BSTPersistent)
+
+template<typename Data>
+BSTPersistent<Data>::BSTPersistent(BSTPersistent<Data> && bst) noexcept {
+  Publish(bst.Current());
+  bst.Publish(nullptr);
+}
+
+/* ************************************************************************** */
+
+// Copy assignment (BSTPersistent)
+
+template<typename Data>
+BSTPersistent<Data> & BSTPersistent<Data>::operator=(const BSTPersistent<Data> & bst) {
+  Publish(bst.Current());
+  return *this;
+}
+
+// Move assignment (BSTPersistent)
+
+template<typename Data>
+BSTPersistent<Data> & BSTPersistent<Data>::operator=(BSTPersistent<Data> && bst) noexcept {
+  NodePtr tmp = root;
+  Publish(bst.Current());
+  bst.Publish(std::move(tmp));
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// Comparison operators (BSTPersistent)
+
+template<typename Data>
+bool BSTPersistent<Data>::operator==(const BSTPersistent<Data> & bst) const noexcept {
+  if (root == bst.root) {
+    return true;
+  }
+  if (size == bst.size) {
+    BTInOrderIterator<Data> itr1(*this);
+    BTInOrderIterator<Data> itr2(bst);
+    for (; !itr1.Terminated(); ++itr1, ++itr2) {
+      if (*itr1 != *itr2) {
+        return false;
+      }
+    }
+    return true;
+  }
+  return false;
+}
+
+template<typename Data>
+inline bool BSTPersistent<Data>::operator!=(const BSTPersistent<Data> & bst) const noexcept {
+  return !(*this == bst);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (BSTPersistent)
+
+template<typename Data>
+inline BSTPersistent<Data> BSTPersistent<Data>::Snapshot() const {
+  return BSTPersistent<Data>(*this);
+}
+
+template<typename Data>
+const Data & BSTPersistent<Data>::Min() const {
+  if (root != nullptr) {
+    const NodePst * cur = root.get();
+    while (cur->left != nullptr) {
+      cur = cur->left.get();
+    }
+    return cur->element;
+  } else {
+    throw std::length_error("Access to an empty tree.");
+  }
+}
+
+template<typename Data>
+const Data & BSTPersistent<Data>::Max() const {
+  if (root != nullptr) {
+    const NodePst * cur = root.get();
+    while (cur->right != nullptr) {
+      cur = cur->right.get();
+    }
+    return cur->element;
+  } else {
+    throw std::length_error("Access to an empty tree.");
+  }
+}
+
+template<typename Data>
+ulong BSTPersistent<Data>::Height() const noexcept {
+  return HeightOf(root);
+}
+
+/* ************************************************************************** */
+
+// Specific member function (BSTPersistent) (inherited from BinaryTree)
+
+template<typename Data>
+const typename BSTPersistent<Data>::Node & BSTPersistent<Data>::Root() const {
+  if (root != nullptr) {
+    return *root;
+  } else {
+    throw std::length_error("Access to an empty tree.");
+  }
+}
+
+/* ************************************************************************** */
+
+// Specific member function (BSTPersistent) (inherited from Container)
+
+// Each node is allocated by make_shared together with its control block
+// (a virtual table pointer and the two reference counters)
+template<typename Data>
+MemStats BSTPersistent<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this) + size * (sizeof(NodePst) - sizeof(Data) + 2 * sizeof(void *));
+  mem.allocations = size;
+  return mem;
+}
+
+/* ************************************************************************** */
+
+// Specific member function (BSTPersistent) (inherited from ClearableContainer)
+
+template<typename Data>
+void BSTPersistent<Data>::Clear() {
+  Publish(nullptr);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (BSTPersistent) (inherited from TestableContainer)
+
+template<typename Data>
+bool BSTPersistent<Data>::Exists(const Data & dat) const noexcept {
+  const NodePst * cur = root.get();
+  while (cur != nullptr) {
+    if (dat < cur->element) {
+      cur = cur->left.get();
+    } else if (cur->element < dat) {
+      cur = cur->right.get();
+    } else {
+      return true;
+    }
+  }
+  return false;
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (BSTPersistent) (inherited from DictionaryContainer)
+
+template<typename Data>
+bool BSTPersistent<Data>::Insert(const Data & dat) {
+  bool ins = false;
+  NodePtr fresh = InsertAt(root, dat, ins);
+  if (ins) {
+    Publish(std::move(fresh));
+  }
+  return ins;
+}
+
+template<typename Data>
+bool BSTPersistent<Data>::Insert(Data && dat) {
+  bool ins = false;
+  NodePtr fresh = InsertAt(root, std::move(dat), ins);
+  if (ins) {
+    Publish(std::move(fresh));
+  }
+  return ins;
+}
+
+template<typename Data>
+bool BSTPersistent<Data>::Remove(const Data & dat) {
+  bool rem = false;
+  NodePtr fresh = RemoveAt(root, dat, rem);
+  if (rem) {
+    Publish(std::move(fresh));
+  }
+  return rem;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary member functions (BSTPersistent)
+
+// Safe against a concurrent writer: the reference is taken under the lock
+template<typename Data>
+typename BSTPersistent<Data>::NodePtr BSTPersistent<Data>::Current() const {
+  std::lock_guard<std::mutex> grd(rootmtx);
+  return root;
+}
+
+// The previous version is released here (out of the lock), unless some
+// snapshot still holds it
+template<typename Data>
+void BSTPersistent<Data>::Publish(NodePtr nod) noexcept {
+  size = CountOf(nod);
+  {
+    std::lock_guard<std::mutex> grd(rootmtx);
+    std::swap(root, nod);
+  }
+}
+
+template<typename Data>
+inline ulong BSTPersistent<Data>::HeightOf(const NodePtr & nod) noexcept {
+  return ((nod != nullptr) ? nod->height : 0);
+}
+
+template<typename Data>
+inline ulong BSTPersistent<Data>::CountOf(const NodePtr & nod) noexcept {
+  return ((nod != nullptr) ? nod->count : 0);
+}
+
+template<typename Data>
+template<typename Val>
+typename BSTPersistent<Data>::NodePtr BSTPersistent<Data>::Make(Val && dat, NodePtr lef, NodePtr rig) {
+  return std::make_shared<const NodePst>(std::forward<Val>(dat), std::move(lef), std::move(rig));
+}
+
+// New node joining two subtrees whose heights differ by at most two: the
+// rotations rebuild the (at most three) nodes involved instead of relinking them
+template<typename Data>
+template<typename Val>
+typename BSTPersistent<Data>::NodePtr BSTPersistent<Data>::Balance(Val && dat, NodePtr lef, NodePtr rig) {
+  ulong hgtlef = HeightOf(lef);
+  ulong hgtrig = HeightOf(rig);
+  if (hgtlef > hgtrig + 1) {
+    if (HeightOf(lef->left) >= HeightOf(lef->right)) {
+      return Make(lef->element, lef->left, Make(std::forward<Val>(dat), lef->right, std::move(rig)));
+    }
+    const NodePst * mid = lef->right.get();
+    return Make(mid->element, Make(lef->element, lef->left, mid->left), Make(std::forward<Val>(dat), mid->right, std::move(rig)));
+  }
+  if (hgtrig > hgtlef + 1) {
+    if (HeightOf(rig->right) >= HeightOf(rig->left)) {
+      return Make(rig->element, Make(std::forward<Val>(dat), std::move(lef), rig->left), rig->right);
+    }
+    const NodePst * mid = rig->left.get();
+    return Make(mid->element, Make(std::forward<Val>(dat), std::move(lef), mid->left), Make(rig->element, mid->right, rig->right));
+  }
+  return Make(std::forward<Val>(dat), std::move(lef), std::move(rig));
+}
+
+// Returns nod itself (nothing copied) when the key is already there
+template<typename Data>
+template<typename Val>
+typename BSTPersistent<Data>::NodePtr BSTPersistent<Data>::InsertAt(const NodePtr & nod, Val && dat, bool & ins) {
+  if (nod == nullptr) {
+    ins = true;
+    return Make(std::forward<Val>(dat), nullptr, nullptr);
+  }
+  if (dat < nod->element) {
+    NodePtr lef = InsertAt(nod->left, std::forward<Val>(dat), ins);
+    return ins ? Balance(nod->element, std::move(lef), nod->right) : nod;
+  } else if (nod->element < dat) {
+    NodePtr rig = InsertAt(nod->right, std::forward<Val>(dat), ins);
+    return ins ? Balance(nod->element, nod->left, std::move(rig)) : nod;
+  }
+  return nod;
+}
+
+template<typename Data>
+typename BSTPersistent<Data>::NodePtr BSTPersistent<Data>::RemoveAt(const NodePtr & nod, const Data & dat, bool & rem) {
+  if (nod == nullptr) {
+    return nod;
+  }
+  if (dat < nod->element) {
+    NodePtr lef = RemoveAt(nod->left, dat, rem);
+    return rem ? Balance(nod->element, std::move(lef), nod->right) : nod;
+  } else if (nod->element < dat) {
+    NodePtr rig = RemoveAt(nod->right, dat, rem);
+    return rem ? Balance(nod->element, nod->left, std::move(rig)) : nod;
+  }
+  rem = true;
+  if (nod->left == nullptr) {
+    return nod->right;
+  } else if (nod->right == nullptr) {
+    return nod->left;
+  }
+  // The successor takes the place of the key (its old node is still alive)
+  const Data * min = nullptr;
+  NodePtr rig = RemoveMin(nod->right, min);
+  return Balance(*min, nod->left, std::move(rig));
+}
+
+template<typename Data>
+typename BSTPersistent<Data>::NodePtr BSTPersistent<Data>::RemoveMin(const NodePtr & nod, const Data * & min) {
+  if (nod->left == nullptr) {
+    min = &nod->element;
+    return nod->right;
+  }
+  return Balance(nod->element, RemoveMin(nod->left, min), nod->right);
+}
+
+/* ************************************************************************** */
+
+}
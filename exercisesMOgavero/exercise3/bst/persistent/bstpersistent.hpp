@@ -0,0 +1,189 @@
+
+#ifndef BSTPERSISTENT_HPP
+#define BSTPERSISTENT_HPP
+
+/* ************************************************************************** */
+
+#include <memory>
+#include <mutex>
+
+/* ************************************************************************** */
+
+#include "../../container/dictionary.hpp"
+#include "../../binarytree/binarytree.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Persistent (path-copying) AVL binary search tree. Nodes are immutable and
+// shared by reference count between versions: an update copies only the
+// O(log(n)) nodes on its path and publishes the new root, so older versions
+// stay intact. Copying (or Snapshot) is O(1), and it is the one operation
+// which other threads may perform while the single writer updates the tree:
+// it holds a lock just to take a reference to the root, then the snapshot
+// is read without any synchronization.
+
+template <typename Data>
+class BSTPersistent : virtual public ClearableContainer,
+  virtual public DictionaryContainer<Data>,
+  virtual public BinaryTree<Data> {
+
+private:
+
+protected:
+
+  using typename BinaryTree<Data>::Node;
+
+  using Container::size;
+
+  struct NodePst;
+
+  using NodePtr = std::shared_ptr<const NodePst>;
+
+  struct NodePst : Node {
+
+    Data element;
+    NodePtr left;
+    NodePtr right;
+    ulong height = 1;
+    ulong count = 1; // Nodes in the subtree rooted here
+
+    /* ********************************************************************** */
+
+    // Specific constructors
+    NodePst(const Data &, NodePtr, NodePtr);
+    NodePst(Data &&, NodePtr, NodePtr) noexcept;
+
+    /* ********************************************************************** */
+
+    // Specific member functions (inherited from Node)
+
+    inline const Data & Element() const noexcept override;
+
+    inline bool IsLeaf() const noexcept override;
+    inline bool HasLeftChild() const noexcept override;
+    inline bool HasRightChild() const noexcept override;
+
+    inline const Node & LeftChild() const override; // (must throw std::out_of_range when not existent)
+    inline const Node & RightChild() const override; // (must throw std::out_of_range when not existent)
+
+  };
+
+  NodePtr root = nullptr;
+  mutable std::mutex rootmtx; // Guards the writes of root and its reads from other threads
+
+public:
+
+  // Default constructor
+  BSTPersistent() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  BSTPersistent(const TraversableContainer<Data> &);
+  BSTPersistent(MappableContainer<Data> &&);
+
+  /* ************************************************************************ */
+
+  // Copy constructor (O(1): the nodes are shared)
+  BSTPersistent(const BSTPersistent &);
+
+  // Move constructor
+  BSTPersistent(BSTPersistent &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~BSTPersistent() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment (O(1))
+  BSTPersistent & operator=(const BSTPersistent &);
+
+  // Move assignment
+  BSTPersistent & operator=(BSTPersistent &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  using BinaryTree<Data>::operator==;
+  bool operator==(const BSTPersistent &) const noexcept;
+  using BinaryTree<Data>::operator!=;
+  inline bool operator!=(const BSTPersistent &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline BSTPersistent Snapshot() const; // (O(1), safe against a concurrent writer)
+
+  const Data & Min() const; // (must throw std::length_error when empty)
+  const Data & Max() const; // (must throw std::length_error when empty)
+
+  ulong Height() const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from BinaryTree)
+
+  const Node & Root() const override; // (must throw std::length_error when empty)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override; // (nodes shared with other versions are counted in each)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from TestableContainer)
+
+  bool Exists(const Data &) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data &) override;
+  bool Insert(Data &&) override;
+  bool Remove(const Data &) override;
+
+protected:
+
+  // Auxiliary member functions
+
+  NodePtr Current() const;
+  void Publish(NodePtr) noexcept;
+
+  static inline ulong HeightOf(const NodePtr &) noexcept;
+  static inline ulong CountOf(const NodePtr &) noexcept;
+
+  template <typename Val>
+  static NodePtr Make(Val &&, NodePtr, NodePtr);
+  template <typename Val>
+  static NodePtr Balance(Val &&, NodePtr, NodePtr);
+
+  template <typename Val>
+  static NodePtr InsertAt(const NodePtr &, Val &&, bool &);
+  static NodePtr RemoveAt(const NodePtr &, const Data &, bool &);
+  static NodePtr RemoveMin(const NodePtr &, const Data * &);
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "bstpersistent.cpp"
+
+#endif
@@ -8,6 +8,36 @@ namespace lasd {
 
 /* ************************************************************************** */
 
+// Memory footprint of a container, in bytes (see Container::MemoryUsage).
+// The payload is sizeof(Data) per stored element (memory owned by the
+// elements themselves is not followed); the overhead is the structure: the
+// object itself, node links, virtual table and virtual base pointers, flags;
+// the slack is allocated but unused capacity. Allocations counts the live
+// heap blocks, each of which also costs a malloc header not included here.
+
+struct MemStats {
+
+  ulong payload = 0;
+  ulong overhead = 0;
+  ulong slack = 0;
+  ulong allocations = 0;
+
+  inline ulong Total() const noexcept {
+    return payload + overhead + slack;
+  }
+
+  inline MemStats & operator+=(const MemStats & mem) noexcept {
+    payload += mem.payload;
+    overhead += mem.overhead;
+    slack += mem.slack;
+    allocations += mem.allocations;
+    return *this;
+  }
+
+};
+
+/* ************************************************************************** */
+
 class Container {
 
 private:
@@ -52,6 +82,8 @@ public:
     return size;
   }
 
+  virtual MemStats MemoryUsage() const noexcept = 0;
+
 };
 
 /* ************************************************************************** */
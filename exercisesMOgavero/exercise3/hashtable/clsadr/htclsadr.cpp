@@ -17,7 +17,7 @@ HashTableClsAdr<Data>::HashTableClsAdr(ulong newtablesize) {
 }
 
 template<typename Data>
-HashTableClsAdr<Data>::HashTableClsAdr(const TraversableContainer<Data> & con) {
+HashTableClsAdr<Data>::HashTableClsAdr(const TraversableContainer<Data> & con) : HashTableClsAdr() {
   InsertAll(con);
 }
 
@@ -27,7 +27,7 @@ HashTableClsAdr<Data>::HashTableClsAdr(ulong newtablesize, const TraversableCont
 }
 
 template<typename Data>
-HashTableClsAdr<Data>::HashTableClsAdr(MappableContainer<Data> && con) {
+HashTableClsAdr<Data>::HashTableClsAdr(MappableContainer<Data> && con) : HashTableClsAdr() {
   InsertAll(std::move(con));
 }
 
@@ -109,7 +109,49 @@ inline bool HashTableClsAdr<Data>::operator!=(const HashTableClsAdr<Data> & ht)
 
 template<typename Data>
 bool HashTableClsAdr<Data>::Insert(const Data & dat) {
-  if (Table[HashKey(dat)].Insert(dat)) {
+  return InsertHashed(enchash(dat), dat);
+}
+
+template<typename Data>
+bool HashTableClsAdr<Data>::Insert(Data && dat) {
+  return InsertHashed(enchash(dat), std::move(dat));
+}
+
+template<typename Data>
+bool HashTableClsAdr<Data>::Remove(const Data & dat) {
+  return RemoveHashed(enchash(dat), dat);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (inherited from TestableContainer)
+
+template<typename Data>
+bool HashTableClsAdr<Data>::Exists(const Data & dat) const noexcept {
+  return ExistsHashed(enchash(dat), dat);
+};
+
+/* ************************************************************************** */
+
+// Specific member functions (heterogeneous and precomputed-hash lookup)
+
+template<typename Data>
+template<typename Key> requires HashCompatible<Data, Key>
+inline bool HashTableClsAdr<Data>::Exists(const Key & key) const noexcept {
+  return ExistsHashed(enchash(key), key);
+}
+
+template<typename Data>
+template<typename Key> requires HashCompatible<Data, Key>
+bool HashTableClsAdr<Data>::ExistsHashed(ulong hash, const Key & key) const noexcept {
+  this->CountOp(StatOp::Probe);
+  return Table[HashKey(hash)].Exists(key);
+}
+
+template<typename Data>
+bool HashTableClsAdr<Data>::InsertHashed(ulong hash, const Data & dat) {
+  this->CountOp(StatOp::Probe);
+  if (Table[HashKey(hash)].Insert(dat)) {
     ++size;
     return true;
   }
@@ -117,8 +159,9 @@ bool HashTableClsAdr<Data>::Insert(const Data & dat) {
 }
 
 template<typename Data>
-bool HashTableClsAdr<Data>::Insert(Data && dat) {
-  if (Table[HashKey(dat)].Insert(std::move(dat))) {
+bool HashTableClsAdr<Data>::InsertHashed(ulong hash, Data && dat) {
+  this->CountOp(StatOp::Probe);
+  if (Table[HashKey(hash)].Insert(std::move(dat))) {
     ++size;
     return true;
   }
@@ -126,8 +169,9 @@ bool HashTableClsAdr<Data>::Insert(Data && dat) {
 }
 
 template<typename Data>
-bool HashTableClsAdr<Data>::Remove(const Data & dat) {
-  if (Table[HashKey(dat)].Remove(dat)) {
+bool HashTableClsAdr<Data>::RemoveHashed(ulong hash, const Data & dat) {
+  this->CountOp(StatOp::Probe);
+  if (Table[HashKey(hash)].Remove(dat)) {
     --size;
     return true;
   }
@@ -136,12 +180,65 @@ bool HashTableClsAdr<Data>::Remove(const Data & dat) {
 
 /* ************************************************************************** */
 
-// Specific member functions (inherited from TestableContainer)
+// Specific member functions (batch operations)
 
 template<typename Data>
-bool HashTableClsAdr<Data>::Exists(const Data & dat) const noexcept {
-  return Table[HashKey(dat)].Exists(dat);
-};
+void HashTableClsAdr<Data>::ExistsBatch(const Vector<Data> & keys, Vector<bool> & out) const {
+  if (out.Size() != keys.Size()) {
+    out.Resize(keys.Size());
+  }
+  ulong home[batch];
+  for (ulong i = 0; i < keys.Size(); i += batch) {
+    ulong num = (keys.Size() - i < batch) ? (keys.Size() - i) : batch;
+    for (ulong j = 0; j < num; ++j) {
+      home[j] = HashKey(enchash(keys[i + j]));
+      __builtin_prefetch(&Table[home[j]]);
+    }
+    for (ulong j = 0; j < num; ++j) {
+      out[i + j] = Table[home[j]].Exists(keys[i + j]);
+    }
+    this->CountOp(StatOp::Probe, num);
+  }
+}
+
+template<typename Data>
+bool HashTableClsAdr<Data>::InsertBatch(const Vector<Data> & keys) {
+  bool all = true;
+  ulong home[batch];
+  for (ulong i = 0; i < keys.Size(); i += batch) {
+    ulong num = (keys.Size() - i < batch) ? (keys.Size() - i) : batch;
+    for (ulong j = 0; j < num; ++j) {
+      home[j] = HashKey(enchash(keys[i + j]));
+      __builtin_prefetch(&Table[home[j]], 1);
+    }
+    for (ulong j = 0; j < num; ++j) {
+      if (Table[home[j]].Insert(keys[i + j])) {
+        ++size;
+      } else {
+        all = false;
+      }
+    }
+    this->CountOp(StatOp::Probe, num);
+  }
+  return all;
+}
+
+/* ************************************************************************** */
+
+// Specific member function (inherited from Container)
+
+template<typename Data>
+MemStats HashTableClsAdr<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.overhead = sizeof(*this);
+  if (Table != nullptr) {
+    for (ulong idx = 0; idx < tablesize; ++idx) {
+      mem += Table[idx].MemoryUsage();
+    }
+    mem.allocations++;
+  }
+  return mem;
+}
 
 /* ************************************************************************** */
 
@@ -157,12 +254,47 @@ void HashTableClsAdr<Data>::Resize(ulong newtablesize) {
       }
     );
   }
+  // The old buckets (and their counters) go away with tmpht
+  this->CountOp(StatOp::Resize);
+  this->CountOp(StatOp::Allocation);
+  this->CountOp(StatOp::Copy, size);
+  this->CountAll(tmpht->HashTable<Data>::Stats());
+  if constexpr (StatsPolicy::Enabled) {
+    for (ulong i = 0; i < tablesize; ++i) {
+      this->CountAll(Table[i].Stats());
+    }
+  }
   std::swap(*tmpht, *this);
   delete tmpht;
 };
 
 /* ************************************************************************** */
 
+// Specific member functions (operation counters)
+
+template<typename Data>
+OpStats HashTableClsAdr<Data>::Stats() const noexcept {
+  OpStats sts = HashTable<Data>::Stats();
+  if constexpr (StatsPolicy::Enabled) {
+    for (ulong i = 0; i < tablesize; ++i) {
+      sts += Table[i].Stats();
+    }
+  }
+  return sts;
+}
+
+template<typename Data>
+void HashTableClsAdr<Data>::ResetStats() noexcept {
+  HashTable<Data>::ResetStats();
+  if constexpr (StatsPolicy::Enabled) {
+    for (ulong i = 0; i < tablesize; ++i) {
+      Table[i].ResetStats();
+    }
+  }
+}
+
+/* ************************************************************************** */
+
 // Specific member functions (inherited from ClearableContainer)
 
 template<typename Data>
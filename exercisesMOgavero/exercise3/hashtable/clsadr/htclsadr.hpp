@@ -6,6 +6,7 @@
 
 #include "../hashtable.hpp"
 #include "../../bst/bst.hpp"
+#include "../../vector/vector.hpp"
 
 /* ************************************************************************** */
 
@@ -20,6 +21,8 @@ private:
 
 protected:
 
+  using HashTable<Data>::enchash;
+
   using HashTable<Data>::size;
   using HashTable<Data>::tablesize;
 
@@ -27,6 +30,8 @@ protected:
   using HashTable<Data>::Insert;
   using HashTable<Data>::InsertAll;
 
+  static const ulong batch = 16;
+
   BST<Data> * Table = nullptr;
 
 public:
@@ -89,6 +94,42 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member functions (heterogeneous and precomputed-hash lookup)
+
+  template <typename Key> requires HashCompatible<Data, Key>
+  bool Exists(const Key &) const noexcept;
+
+  template <typename Key> requires HashCompatible<Data, Key>
+  bool ExistsHashed(ulong, const Key &) const noexcept;
+
+  bool InsertHashed(ulong, const Data &);
+  bool InsertHashed(ulong, Data &&);
+  bool RemoveHashed(ulong, const Data &);
+
+  /* ************************************************************************ */
+
+  // Specific member functions (batch operations)
+
+  // Keys are hashed a group at a time and their buckets prefetched
+  // before any of them is searched
+  void ExistsBatch(const Vector<Data> &, Vector<bool> &) const;
+  bool InsertBatch(const Vector<Data> &);
+
+  /* ************************************************************************ */
+
+  // Specific member functions (operation counters, see stats/stats.hpp)
+
+  OpStats Stats() const noexcept; // (own counters plus those of the buckets)
+  void ResetStats() noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override; // (the buckets are BSTs, each empty one is pure overhead)
+
+  /* ************************************************************************ */
+
   // Specific member functions (inherited from ResizableContainer)
 
   void Resize(ulong) override;
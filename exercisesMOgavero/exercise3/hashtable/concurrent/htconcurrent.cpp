@@ -0,0 +1,347 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Slots
+
+template<typename Data>
+ConcurrentHashTable<Data>::Slots::Slots(ulong newtablesize) {
+  tablesize = (newtablesize < 16) ? 16 : newtablesize;
+  table = new Data[tablesize] {};
+  flagtable = new std::atomic<char>[tablesize] {};
+}
+
+template<typename Data>
+ConcurrentHashTable<Data>::Slots::~Slots() {
+  delete[] table;
+  delete[] flagtable;
+}
+
+/* ************************************************************************** */
+
+// Specific constructors
+
+template<typename Data>
+ConcurrentHashTable<Data>::ConcurrentHashTable(ulong newtablesize) {
+  current.store(new Slots(newtablesize));
+}
+
+template<typename Data>
+ConcurrentHashTable<Data>::ConcurrentHashTable(const TraversableContainer<Data> & con) : ConcurrentHashTable() {
+  InsertAll(con);
+}
+
+template<typename Data>
+ConcurrentHashTable<Data>::ConcurrentHashTable(ulong newtablesize, const TraversableContainer<Data> & con) : ConcurrentHashTable(newtablesize) {
+  InsertAll(con);
+}
+
+template<typename Data>
+ConcurrentHashTable<Data>::ConcurrentHashTable(MappableContainer<Data> && con) : ConcurrentHashTable() {
+  InsertAll(std::move(con));
+}
+
+template<typename Data>
+ConcurrentHashTable<Data>::ConcurrentHashTable(ulong newtablesize, MappableContainer<Data> && con) : ConcurrentHashTable(newtablesize) {
+  InsertAll(std::move(con));
+}
+
+/* ************************************************************************** */
+
+// Destructor
+template<typename Data>
+ConcurrentHashTable<Data>::~ConcurrentHashTable() {
+  delete current.load();
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (inherited from Container)
+
+template<typename Data>
+inline bool ConcurrentHashTable<Data>::Empty() const noexcept {
+  return (count.load(std::memory_order_relaxed) == 0);
+}
+
+template<typename Data>
+inline ulong ConcurrentHashTable<Data>::Size() const noexcept {
+  return count.load(std::memory_order_relaxed);
+}
+
+// The table is replaced only under resizemtx
+template<typename Data>
+MemStats ConcurrentHashTable<Data>::MemoryUsage() const noexcept {
+  std::lock_guard<std::mutex> grd(resizemtx);
+  const Slots * tab = current.load();
+  ulong num = count.load(std::memory_order_relaxed);
+  MemStats mem;
+  mem.payload = num * sizeof(Data);
+  mem.overhead = sizeof(*this) + sizeof(Slots) + tab->tablesize * sizeof(std::atomic<char>);
+  mem.slack = (tab->tablesize - num) * sizeof(Data);
+  mem.allocations = 3;
+  return mem;
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (inherited from DictionaryContainer)
+
+template<typename Data>
+bool ConcurrentHashTable<Data>::Insert(const Data & dat) {
+  return InsertKey(enchash(dat), dat);
+}
+
+template<typename Data>
+bool ConcurrentHashTable<Data>::Insert(Data && dat) {
+  return InsertKey(enchash(dat), std::move(dat));
+}
+
+template<typename Data>
+bool ConcurrentHashTable<Data>::Remove(const Data & dat) {
+  ulong hash = enchash(dat);
+  Lock(hash);
+  Slots * tab = current.load();
+  ulong pos = Find(tab, hash, dat);
+  bool res = (pos < tab->tablesize);
+  if (res) {
+    tab->flagtable[pos].store(1, std::memory_order_release);
+    count.fetch_sub(1, std::memory_order_relaxed);
+  }
+  Unlock(hash);
+  return res;
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (inherited from TestableContainer)
+
+template<typename Data>
+bool ConcurrentHashTable<Data>::Exists(const Data & dat) const noexcept {
+  return ExistsHashed(enchash(dat), dat);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (heterogeneous and precomputed-hash lookup)
+
+template<typename Data>
+template<typename Key> requires HashCompatible<Data, Key>
+inline bool ConcurrentHashTable<Data>::Exists(const Key & key) const noexcept {
+  return ExistsHashed(enchash(key), key);
+}
+
+template<typename Data>
+template<typename Key> requires HashCompatible<Data, Key>
+bool ConcurrentHashTable<Data>::ExistsHashed(ulong hash, const Key & key) const noexcept {
+  Readers & rdr = readers[ReaderIdx()];
+  ulong par;
+  while (true) {
+    par = epoch.load() & 1;
+    rdr.cnt[par].fetch_add(1);
+    if ((epoch.load() & 1) == par) {
+      break;
+    }
+    rdr.cnt[par].fetch_sub(1);
+  }
+  const Slots * tab = current.load();
+  bool res = (Find(tab, hash, key) < tab->tablesize);
+  rdr.cnt[par].fetch_sub(1, std::memory_order_release);
+  return res;
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (inherited from ResizableContainer)
+
+template<typename Data>
+void ConcurrentHashTable<Data>::Resize(ulong newtablesize) {
+  std::lock_guard<std::mutex> grd(resizemtx);
+  Rebuild(current.load(), newtablesize, true);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (inherited from ClearableContainer)
+
+template<typename Data>
+void ConcurrentHashTable<Data>::Clear() {
+  std::lock_guard<std::mutex> grd(resizemtx);
+  Rebuild(current.load(), 128, false);
+}
+
+/* ************************************************************************** */
+
+// Auxiliary member functions
+
+template<typename Data>
+inline ulong ConcurrentHashTable<Data>::Home(const Slots * tab, ulong hash) const noexcept {
+  return FastRange(acoeff * hash + bcoeff, tab->tablesize);
+}
+
+template<typename Data>
+inline ulong ConcurrentHashTable<Data>::Probe(const Slots * tab, ulong home, ulong idx) const noexcept {
+  ulong pos = home + idx;
+  return (pos < tab->tablesize) ? pos : (pos % tab->tablesize);
+}
+
+template<typename Data>
+template<typename Key>
+ulong ConcurrentHashTable<Data>::Find(const Slots * tab, ulong hash, const Key & key) const noexcept {
+  ulong home = Home(tab, hash);
+  for (ulong idx = 0; idx < tab->tablesize; ++idx) {
+    ulong pos = Probe(tab, home, idx);
+    char flg = tab->flagtable[pos].load(std::memory_order_acquire);
+    if (flg == 0) {
+      break;
+    }
+    if ((flg == 2) && (tab->table[pos] == key)) {
+      return pos;
+    }
+  }
+  return tab->tablesize;
+}
+
+template<typename Data>
+template<typename Val>
+bool ConcurrentHashTable<Data>::InsertKey(ulong hash, Val && dat) {
+  while (true) {
+    Lock(hash);
+    Slots * tab = current.load();
+    if (Find(tab, hash, dat) < tab->tablesize) {
+      Unlock(hash);
+      return false;
+    }
+    if (2 * (tab->used.fetch_add(1, std::memory_order_relaxed) + 1) <= tab->tablesize) {
+      Place(tab, hash, std::forward<Val>(dat));
+      count.fetch_add(1, std::memory_order_relaxed);
+      Unlock(hash);
+      return true;
+    }
+    tab->used.fetch_sub(1, std::memory_order_relaxed);
+    Unlock(hash);
+    if (resizemtx.try_lock()) {
+      // Grow, or just drop the tombstones when they are most of the load
+      if (current.load() == tab) {
+        ulong newtablesize = (4 * count.load() > tab->tablesize) ? (2 * tab->tablesize) : tab->tablesize;
+        Rebuild(tab, newtablesize, true);
+      }
+      resizemtx.unlock();
+    } else {
+      HelpRebuild();
+      std::this_thread::yield();
+    }
+  }
+}
+
+template<typename Data>
+template<typename Val>
+void ConcurrentHashTable<Data>::Place(Slots * tab, ulong hash, Val && dat) {
+  ulong home = Home(tab, hash);
+  for (ulong idx = 0; ; ++idx) {
+    ulong pos = Probe(tab, home, idx);
+    char flg = 0;
+    if (tab->flagtable[pos].compare_exchange_strong(flg, 3, std::memory_order_acquire)) {
+      tab->table[pos] = std::forward<Val>(dat);
+      tab->flagtable[pos].store(2, std::memory_order_release);
+      return;
+    }
+  }
+}
+
+template<typename Data>
+void ConcurrentHashTable<Data>::Lock(ulong hash) {
+  Stripe & stp = locks[hash % stripes];
+  while (!stp.mtx.try_lock()) {
+    HelpRebuild();
+    std::this_thread::yield();
+  }
+}
+
+template<typename Data>
+void ConcurrentHashTable<Data>::Unlock(ulong hash) noexcept {
+  locks[hash % stripes].mtx.unlock();
+}
+
+// Requires resizemtx; replaces the current table old with one of the given size
+template<typename Data>
+void ConcurrentHashTable<Data>::Rebuild(Slots * old, ulong newtablesize, bool migrate) {
+  for (ulong i = 0; i < stripes; ++i) {
+    locks[i].mtx.lock();
+  }
+  ulong cnt = count.load();
+  Slots * fresh = new Slots((migrate && (newtablesize <= cnt)) ? (cnt + 1) : newtablesize);
+  if (migrate) {
+    source.store(old);
+    chunks.store((old->tablesize + chunk - 1) / chunk);
+    nextchunk.store(0);
+    donechunks.store(0);
+    target.store(fresh);
+    Migrate(old, fresh);
+    while (donechunks.load() < chunks.load()) {
+      std::this_thread::yield();
+    }
+    target.store(nullptr);
+    while (helpers.load() != 0) {
+      std::this_thread::yield();
+    }
+  } else {
+    count.store(0);
+  }
+  current.store(fresh);
+  for (ulong i = 0; i < stripes; ++i) {
+    locks[i].mtx.unlock();
+  }
+  Synchronize();
+  delete old;
+}
+
+template<typename Data>
+void ConcurrentHashTable<Data>::HelpRebuild() {
+  helpers.fetch_add(1);
+  Slots * dst = target.load();
+  if (dst != nullptr) {
+    Migrate(source.load(), dst);
+  }
+  helpers.fetch_sub(1);
+}
+
+// Copies (readers may still be looking at src) the chunks nobody claimed yet
+template<typename Data>
+void ConcurrentHashTable<Data>::Migrate(const Slots * src, Slots * dst) {
+  ulong num = chunks.load();
+  ulong chk;
+  while ((chk = nextchunk.fetch_add(1)) < num) {
+    ulong end = ((chk + 1) * chunk < src->tablesize) ? ((chk + 1) * chunk) : src->tablesize;
+    for (ulong pos = chk * chunk; pos < end; ++pos) {
+      if (src->flagtable[pos].load(std::memory_order_acquire) == 2) {
+        const Data & dat = src->table[pos];
+        dst->used.fetch_add(1, std::memory_order_relaxed);
+        Place(dst, enchash(dat), dat);
+      }
+    }
+    donechunks.fetch_add(1);
+  }
+}
+
+template<typename Data>
+ulong ConcurrentHashTable<Data>::ReaderIdx() noexcept {
+  static std::atomic<ulong> next = 0;
+  thread_local ulong idx = next.fetch_add(1, std::memory_order_relaxed) % stripes;
+  return idx;
+}
+
+// Waits for the readers which may still hold a pointer to a replaced table
+template<typename Data>
+void ConcurrentHashTable<Data>::Synchronize() noexcept {
+  ulong par = epoch.fetch_add(1) & 1;
+  for (ulong i = 0; i < stripes; ++i) {
+    while (readers[i].cnt[par].load(std::memory_order_acquire) != 0) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,206 @@
+
+#ifndef HTCONCURRENT_HPP
+#define HTCONCURRENT_HPP
+
+/* ************************************************************************** */
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+/* ************************************************************************** */
+
+#include "../hashtable.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Open-addressing hash table (linear probing) safe for concurrent use.
+// Writers lock one of a fixed set of stripes, chosen by the encoded key;
+// Exists takes no lock. A published element is never written again until its
+// table is retired, so readers compare it without synchronization: Remove only
+// leaves a tombstone, and tombstones are dropped by the next resize. Resizing
+// holds every stripe, while blocked writers help moving the elements; the old
+// table is freed once all the readers which could still see it are gone.
+
+template <typename Data>
+class ConcurrentHashTable : virtual public HashTable<Data> {
+
+private:
+
+protected:
+
+  using HashTable<Data>::acoeff;
+  using HashTable<Data>::bcoeff;
+
+  using HashTable<Data>::enchash;
+
+  using HashTable<Data>::Insert;
+  using HashTable<Data>::InsertAll;
+
+  static const ulong stripes = 64;
+  static const ulong chunk = 1024;
+
+  struct Slots {
+    ulong tablesize;
+    Data * table = nullptr;
+    std::atomic<char> * flagtable = nullptr; // 0 empty, 1 removed, 2 full, 3 being written
+    std::atomic<ulong> used = 0;             // Non-empty slots
+
+    Slots(ulong);
+    ~Slots();
+  };
+
+  struct alignas(64) Stripe {
+    std::mutex mtx;
+  };
+
+  struct alignas(64) Readers {
+    std::atomic<ulong> cnt[2] = {0, 0};
+  };
+
+  std::atomic<Slots *> current = nullptr;
+  std::atomic<ulong> count = 0;
+
+  Stripe locks[stripes];
+
+  // Readers announced per epoch parity (grace period for retired tables)
+  mutable Readers readers[stripes];
+  std::atomic<ulong> epoch = 0;
+
+  // Ongoing migration, shared with the helping writers
+  mutable std::mutex resizemtx;
+  std::atomic<Slots *> source = nullptr;
+  std::atomic<Slots *> target = nullptr;
+  std::atomic<ulong> chunks = 0;
+  std::atomic<ulong> nextchunk = 0;
+  std::atomic<ulong> donechunks = 0;
+  std::atomic<ulong> helpers = 0;
+
+public:
+
+  // Default constructor
+  ConcurrentHashTable() : ConcurrentHashTable(128) {};
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+
+  ConcurrentHashTable(ulong);
+
+  ConcurrentHashTable(const TraversableContainer<Data> &);
+  ConcurrentHashTable(ulong, const TraversableContainer<Data> &);
+
+  ConcurrentHashTable(MappableContainer<Data> &&);
+  ConcurrentHashTable(ulong, MappableContainer<Data> &&);
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  ConcurrentHashTable(const ConcurrentHashTable &) = delete;
+
+  // Move constructor
+  ConcurrentHashTable(ConcurrentHashTable &&) noexcept = delete;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~ConcurrentHashTable();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  ConcurrentHashTable & operator=(const ConcurrentHashTable &) = delete;
+
+  // Move assignment
+  ConcurrentHashTable & operator=(ConcurrentHashTable &&) noexcept = delete;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const ConcurrentHashTable &) const noexcept = delete;
+  bool operator!=(const ConcurrentHashTable &) const noexcept = delete;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from Container)
+
+  inline bool Empty() const noexcept override;
+  inline ulong Size() const noexcept override;
+
+  MemStats MemoryUsage() const noexcept override; // (waits for an ongoing resize)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data &) override;
+  bool Insert(Data &&) override;
+  bool Remove(const Data &) override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from TestableContainer)
+
+  bool Exists(const Data &) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (heterogeneous and precomputed-hash lookup)
+
+  template <typename Key> requires HashCompatible<Data, Key>
+  bool Exists(const Key &) const noexcept;
+
+  template <typename Key> requires HashCompatible<Data, Key>
+  bool ExistsHashed(ulong, const Key &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from ResizableContainer)
+
+  void Resize(ulong) override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from ClearableContainer)
+
+  void Clear() override;
+
+protected:
+
+  // Auxiliary member functions
+
+  inline ulong Home(const Slots *, ulong) const noexcept;
+  inline ulong Probe(const Slots *, ulong, ulong) const noexcept;
+
+  template <typename Key>
+  ulong Find(const Slots *, ulong, const Key &) const noexcept;
+
+  template <typename Val>
+  bool InsertKey(ulong, Val &&);
+
+  template <typename Val>
+  void Place(Slots *, ulong, Val &&);
+
+  void Lock(ulong);
+  void Unlock(ulong) noexcept;
+
+  void Rebuild(Slots *, ulong, bool);
+  void HelpRebuild();
+  void Migrate(const Slots *, Slots *);
+
+  static ulong ReaderIdx() noexcept;
+  void Synchronize() noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "htconcurrent.cpp"
+
+#endif
@@ -0,0 +1,315 @@
+
+#include <random>
+#include <limits>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Specific constructors
+
+template<typename Data>
+HashTableFlat<Data>::HashTableFlat(ulong newtablesize) {
+  std::default_random_engine gen(std::random_device {}());
+  acoeff = std::uniform_int_distribution<ulong>(1, std::numeric_limits<ulong>::max())(gen) | 1;
+  bcoeff = std::uniform_int_distribution<ulong>(0, std::numeric_limits<ulong>::max())(gen);
+  tablesize = (newtablesize < 2) ? 2 : newtablesize;
+  table = new Data[tablesize];
+  flagtable = new char[tablesize] {};
+}
+
+template<typename Data>
+HashTableFlat<Data>::HashTableFlat(const TraversableContainer<Data> & con) : HashTableFlat(2 * con.Size()) {
+  con.Traverse(
+    [this](const Data & dat) {
+      Insert(dat);
+    }
+  );
+}
+
+template<typename Data>
+HashTableFlat<Data>::HashTableFlat(ulong newtablesize, const TraversableContainer<Data> & con) : HashTableFlat(newtablesize) {
+  con.Traverse(
+    [this](const Data & dat) {
+      Insert(dat);
+    }
+  );
+}
+
+template<typename Data>
+HashTableFlat<Data>::HashTableFlat(MappableContainer<Data> && con) : HashTableFlat(2 * con.Size()) {
+  con.Map(
+    [this](Data & dat) {
+      Insert(std::move(dat));
+    }
+  );
+}
+
+template<typename Data>
+HashTableFlat<Data>::HashTableFlat(ulong newtablesize, MappableContainer<Data> && con) : HashTableFlat(newtablesize) {
+  con.Map(
+    [this](Data & dat) {
+      Insert(std::move(dat));
+    }
+  );
+}
+
+/* ************************************************************************** */
+
+// Copy constructor
+template<typename Data>
+HashTableFlat<Data>::HashTableFlat(const HashTableFlat<Data> & ht) {
+  table = new Data[ht.tablesize];
+  flagtable = new char[ht.tablesize];
+  std::copy(ht.table, ht.table + ht.tablesize, table);
+  std::copy(ht.flagtable, ht.flagtable + ht.tablesize, flagtable);
+  size = ht.size;
+  used = ht.used;
+  tablesize = ht.tablesize;
+  acoeff = ht.acoeff;
+  bcoeff = ht.bcoeff;
+}
+
+// Move constructor (the moved-from table is left with no slots)
+template<typename Data>
+HashTableFlat<Data>::HashTableFlat(HashTableFlat<Data> && ht) noexcept {
+  std::swap(size, ht.size);
+  std::swap(used, ht.used);
+  std::swap(tablesize, ht.tablesize);
+  std::swap(acoeff, ht.acoeff);
+  std::swap(bcoeff, ht.bcoeff);
+  std::swap(table, ht.table);
+  std::swap(flagtable, ht.flagtable);
+}
+
+/* ************************************************************************** */
+
+// Destructor
+template<typename Data>
+HashTableFlat<Data>::~HashTableFlat() {
+  delete[] table;
+  delete[] flagtable;
+}
+
+/* ************************************************************************** */
+
+// Copy assignment
+template<typename Data>
+HashTableFlat<Data> & HashTableFlat<Data>::operator=(const HashTableFlat<Data> & ht) {
+  HashTableFlat<Data> tmpht(ht);
+  std::swap(tmpht, *this);
+  return *this;
+}
+
+// Move assignment
+template<typename Data>
+HashTableFlat<Data> & HashTableFlat<Data>::operator=(HashTableFlat<Data> && ht) noexcept {
+  std::swap(size, ht.size);
+  std::swap(used, ht.used);
+  std::swap(tablesize, ht.tablesize);
+  std::swap(acoeff, ht.acoeff);
+  std::swap(bcoeff, ht.bcoeff);
+  std::swap(table, ht.table);
+  std::swap(flagtable, ht.flagtable);
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// Comparison operators
+
+template<typename Data>
+bool HashTableFlat<Data>::operator==(const HashTableFlat<Data> & ht) const noexcept {
+  if (size != ht.size) {
+    return false;
+  }
+  for (ulong i = 0; i < tablesize; ++i) {
+    if (flagtable[i] == 2 && !ht.Exists(table[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename Data>
+inline bool HashTableFlat<Data>::operator!=(const HashTableFlat<Data> & ht) const noexcept {
+  return !(*this == ht);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions
+
+template<typename Data>
+bool HashTableFlat<Data>::Insert(const Data & dat) {
+  return InsertKey(enchash(dat), dat);
+}
+
+template<typename Data>
+bool HashTableFlat<Data>::Insert(Data && dat) {
+  return InsertKey(enchash(dat), std::move(dat));
+}
+
+template<typename Data>
+bool HashTableFlat<Data>::Remove(const Data & dat) {
+  return RemoveHashed(enchash(dat), dat);
+}
+
+template<typename Data>
+inline bool HashTableFlat<Data>::Exists(const Data & dat) const noexcept {
+  return (Find(HashKey(enchash(dat)), dat) < tablesize);
+}
+
+template<typename Data>
+template<typename Key> requires HashCompatible<Data, Key>
+inline bool HashTableFlat<Data>::Exists(const Key & key) const noexcept {
+  return (Find(HashKey(enchash(key)), key) < tablesize);
+}
+
+template<typename Data>
+template<typename Key> requires HashCompatible<Data, Key>
+inline bool HashTableFlat<Data>::ExistsHashed(ulong hash, const Key & key) const noexcept {
+  return (Find(HashKey(hash), key) < tablesize);
+}
+
+template<typename Data>
+bool HashTableFlat<Data>::InsertHashed(ulong hash, const Data & dat) {
+  return InsertKey(hash, dat);
+}
+
+template<typename Data>
+bool HashTableFlat<Data>::InsertHashed(ulong hash, Data && dat) {
+  return InsertKey(hash, std::move(dat));
+}
+
+template<typename Data>
+bool HashTableFlat<Data>::RemoveHashed(ulong hash, const Data & dat) {
+  ulong pos = Find(HashKey(hash), dat);
+  if (pos < tablesize) {
+    flagtable[pos] = 1;
+    --size;
+    return true;
+  }
+  return false;
+}
+
+template<typename Data>
+template<typename Fun>
+inline void HashTableFlat<Data>::Traverse(Fun fun) const {
+  for (ulong i = 0; i < tablesize; ++i) {
+    if (flagtable[i] == 2) {
+      fun(table[i]);
+    }
+  }
+}
+
+template<typename Data>
+template<typename Accumulator, typename Fun>
+inline Accumulator HashTableFlat<Data>::Fold(Fun fun, Accumulator acc) const {
+  for (ulong i = 0; i < tablesize; ++i) {
+    if (flagtable[i] == 2) {
+      acc = fun(table[i], acc);
+    }
+  }
+  return acc;
+}
+
+template<typename Data>
+MemStats HashTableFlat<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this) + tablesize * sizeof(char);
+  mem.slack = (tablesize - size) * sizeof(Data);
+  mem.allocations = (table != nullptr) + (flagtable != nullptr);
+  return mem;
+}
+
+template<typename Data>
+void HashTableFlat<Data>::Resize(ulong newtablesize) {
+  newtablesize = (2 * size < newtablesize) ? newtablesize : (2 * size + 2);
+  HashTableFlat<Data> tmpht(newtablesize);
+  for (ulong i = 0; i < tablesize; ++i) {
+    if (flagtable[i] == 2) {
+      tmpht.Place(std::move(table[i]));
+    }
+  }
+  std::swap(tmpht, *this);
+}
+
+template<typename Data>
+void HashTableFlat<Data>::Clear() {
+  HashTableFlat<Data> tmpht;
+  std::swap(tmpht, *this);
+}
+
+/* ************************************************************************** */
+
+// Auxiliary member functions
+
+template<typename Data>
+inline ulong HashTableFlat<Data>::HashKey(ulong key) const noexcept {
+  return FastRange(acoeff * key + bcoeff, tablesize);
+}
+
+template<typename Data>
+inline ulong HashTableFlat<Data>::Probe(ulong home, ulong idx) const noexcept {
+  ulong pos = home + idx;
+  return (pos < tablesize) ? pos : (pos - tablesize);
+}
+
+template<typename Data>
+template<typename Key>
+inline ulong HashTableFlat<Data>::Find(ulong home, const Key & key) const noexcept {
+  for (ulong idx = 0; idx < tablesize; ++idx) {
+    ulong pos = Probe(home, idx);
+    if (flagtable[pos] == 0) {
+      break;
+    }
+    if (flagtable[pos] == 2 && table[pos] == key) {
+      return pos;
+    }
+  }
+  return tablesize;
+}
+
+template<typename Data>
+template<typename Val>
+bool HashTableFlat<Data>::InsertKey(ulong hash, Val && val) {
+  if (2 * (used + 1) > tablesize) {
+    Resize((4 * (size + 1) > tablesize) ? 2 * tablesize : tablesize);
+  }
+  ulong home = HashKey(hash);
+  ulong free = tablesize;
+  ulong pos = home;
+  for (ulong idx = 0; flagtable[pos] != 0; pos = Probe(home, ++idx)) {
+    if (flagtable[pos] == 1) {
+      free = (free < tablesize) ? free : pos;
+    } else if (table[pos] == val) {
+      return false;
+    }
+  }
+  if (free < tablesize) {
+    pos = free;
+  } else {
+    ++used;
+  }
+  table[pos] = std::forward<Val>(val);
+  flagtable[pos] = 2;
+  ++size;
+  return true;
+}
+
+template<typename Data>
+void HashTableFlat<Data>::Place(Data && dat) {
+  ulong home = HashKey(enchash(dat));
+  ulong pos = home;
+  for (ulong idx = 0; flagtable[pos] != 0; pos = Probe(home, ++idx)) {}
+  table[pos] = std::move(dat);
+  flagtable[pos] = 2;
+  ++size;
+  ++used;
+}
+
+/* ************************************************************************** */
+
+}
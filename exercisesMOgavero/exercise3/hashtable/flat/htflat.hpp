@@ -0,0 +1,202 @@
+
+#ifndef HTFLAT_HPP
+#define HTFLAT_HPP
+
+/* ************************************************************************** */
+
+#include "../hashtable.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Open-addressing hash table (linear probing) outside the container lattice:
+// a final class with no virtual functions and no virtual bases, so Size(),
+// Exists() and the probe loop are resolved statically and inlined, and
+// Traverse/Fold take any callable instead of a std::function. It hashes like
+// HashTable (same encoding, multiply-shift onto the table) and keeps at most
+// half of its slots in use, tombstones included. DictionaryAdapter below
+// bridges it back to the polymorphic interfaces.
+
+template <typename Data>
+class HashTableFlat final {
+
+private:
+
+protected:
+
+  static inline const Hashable<Data> enchash {};
+
+  ulong size = 0;
+  ulong used = 0; // Full and removed slots
+  ulong tablesize = 0;
+
+  ulong acoeff = 1;
+  ulong bcoeff = 0;
+
+  Data * table = nullptr;
+  char * flagtable = nullptr; // 0 empty, 1 removed, 2 full
+
+public:
+
+  using value_type = Data;
+
+  // Default constructor
+  HashTableFlat() : HashTableFlat(128) {};
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+
+  explicit HashTableFlat(ulong);
+
+  HashTableFlat(const TraversableContainer<Data> &);
+  HashTableFlat(ulong, const TraversableContainer<Data> &);
+
+  HashTableFlat(MappableContainer<Data> &&);
+  HashTableFlat(ulong, MappableContainer<Data> &&);
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  HashTableFlat(const HashTableFlat &);
+
+  // Move constructor
+  HashTableFlat(HashTableFlat &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~HashTableFlat();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  HashTableFlat & operator=(const HashTableFlat &);
+
+  // Move assignment
+  HashTableFlat & operator=(HashTableFlat &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const HashTableFlat &) const noexcept;
+  bool operator!=(const HashTableFlat &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline bool Empty() const noexcept { return (size == 0); }
+  inline ulong Size() const noexcept { return size; }
+
+  bool Insert(const Data &);
+  bool Insert(Data &&);
+  bool Remove(const Data &);
+
+  inline bool Exists(const Data &) const noexcept;
+
+  template <typename Key> requires HashCompatible<Data, Key>
+  inline bool Exists(const Key &) const noexcept;
+
+  template <typename Key> requires HashCompatible<Data, Key>
+  inline bool ExistsHashed(ulong, const Key &) const noexcept;
+
+  bool InsertHashed(ulong, const Data &);
+  bool InsertHashed(ulong, Data &&);
+  bool RemoveHashed(ulong, const Data &);
+
+  template <typename Fun>
+  inline void Traverse(Fun) const;
+
+  template <typename Accumulator, typename Fun>
+  inline Accumulator Fold(Fun, Accumulator) const;
+
+  MemStats MemoryUsage() const noexcept; // (the empty and removed slots are slack)
+
+  void Resize(ulong); // Also drops the tombstones
+
+  void Clear();
+
+protected:
+
+  // Auxiliary member functions
+
+  inline ulong HashKey(ulong) const noexcept;
+  inline ulong Probe(ulong, ulong) const noexcept;
+
+  template <typename Key>
+  inline ulong Find(ulong, const Key &) const noexcept; // Slot of the key, tablesize if absent
+
+  template <typename Val>
+  bool InsertKey(ulong, Val &&);
+
+  void Place(Data &&); // No duplicate check, no resize
+
+};
+
+/* ************************************************************************** */
+
+// Thin view of a flat hash table as a DictionaryContainer and a
+// TraversableContainer: every call is forwarded to the table, which must
+// outlive the adapter. Only the calls through the adapter are virtual.
+
+template <typename Flat>
+class DictionaryAdapter : virtual public DictionaryContainer<typename Flat::value_type>,
+  virtual public TraversableContainer<typename Flat::value_type> {
+
+private:
+
+protected:
+
+  using Data = typename Flat::value_type;
+
+  Flat & con;
+
+public:
+
+  // Specific constructor
+  explicit DictionaryAdapter(Flat & flat) noexcept : con(flat) {}
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from Container)
+
+  inline bool Empty() const noexcept override { return con.Empty(); }
+  inline ulong Size() const noexcept override { return con.Size(); }
+
+  inline MemStats MemoryUsage() const noexcept override { return con.MemoryUsage(); }
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  inline bool Insert(const Data & dat) override { return con.Insert(dat); }
+  inline bool Insert(Data && dat) override { return con.Insert(std::move(dat)); }
+  inline bool Remove(const Data & dat) override { return con.Remove(dat); }
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  inline bool Exists(const Data & dat) const noexcept override { return con.Exists(dat); }
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+
+  inline void Traverse(TraverseFun fun) const override { con.Traverse(fun); }
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "htflat.cpp"
+
+#endif
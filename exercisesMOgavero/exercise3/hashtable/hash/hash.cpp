@@ -0,0 +1,94 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Auxiliary constants and functions (HashBytes)
+
+static constexpr ulong wyp0 = 0x2d358dccaa6c78a5ul;
+static constexpr ulong wyp1 = 0x8bb84b93962eacc9ul;
+static constexpr ulong wyp2 = 0x4b33a62ed433d4a3ul;
+static constexpr ulong wyp3 = 0x4d5a2da51de1aa47ul;
+
+inline ulong Read8(const unsigned char * ptr) noexcept {
+  ulong val;
+  std::memcpy(&val, ptr, 8);
+  return val;
+}
+
+inline ulong Read4(const unsigned char * ptr) noexcept {
+  unsigned int val;
+  std::memcpy(&val, ptr, 4);
+  return val;
+}
+
+inline ulong Read3(const unsigned char * ptr, ulong len) noexcept {
+  return ((static_cast<ulong>(ptr[0]) << 16) | (static_cast<ulong>(ptr[len >> 1]) << 8) | ptr[len - 1]);
+}
+
+/* ************************************************************************** */
+
+// Specific functions
+
+inline ulong Mix64(ulong key) noexcept {
+  key ^= key >> 30;
+  key *= 0xbf58476d1ce4e5b9ul;
+  key ^= key >> 27;
+  key *= 0x94d049bb133111ebul;
+  key ^= key >> 31;
+  return key;
+}
+
+inline ulong MulFold(ulong a, ulong b) noexcept {
+  uint128 res = static_cast<uint128>(a) * b;
+  return (static_cast<ulong>(res) ^ static_cast<ulong>(res >> 64));
+}
+
+inline ulong HashBytes(const void * key, ulong len, ulong seed) noexcept {
+  const unsigned char * ptr = static_cast<const unsigned char *>(key);
+  seed ^= MulFold(seed ^ wyp0, wyp1);
+  ulong a = 0;
+  ulong b = 0;
+  if (len <= 16) {
+    if (len >= 4) {
+      ulong off = (len >> 3) << 2;
+      a = (Read4(ptr) << 32) | Read4(ptr + off);
+      b = (Read4(ptr + len - 4) << 32) | Read4(ptr + len - 4 - off);
+    } else if (len > 0) {
+      a = Read3(ptr, len);
+    }
+  } else {
+    ulong rem = len;
+    if (rem > 48) {
+      ulong seed1 = seed;
+      ulong seed2 = seed;
+      do {
+        seed = MulFold(Read8(ptr) ^ wyp1, Read8(ptr + 8) ^ seed);
+        seed1 = MulFold(Read8(ptr + 16) ^ wyp2, Read8(ptr + 24) ^ seed1);
+        seed2 = MulFold(Read8(ptr + 32) ^ wyp3, Read8(ptr + 40) ^ seed2);
+        ptr += 48;
+        rem -= 48;
+      } while (rem > 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while (rem > 16) {
+      seed = MulFold(Read8(ptr) ^ wyp1, Read8(ptr + 8) ^ seed);
+      ptr += 16;
+      rem -= 16;
+    }
+    a = Read8(ptr + rem - 16);
+    b = Read8(ptr + rem - 8);
+  }
+  uint128 res = static_cast<uint128>(a ^ wyp1) * (b ^ seed);
+  a = static_cast<ulong>(res);
+  b = static_cast<ulong>(res >> 64);
+  return MulFold(a ^ wyp0 ^ len, b ^ wyp1);
+}
+
+inline ulong FastRange(ulong key, ulong range) noexcept {
+  return static_cast<ulong>((static_cast<uint128>(key) * range) >> 64);
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,44 @@
+
+#ifndef HASH_HPP
+#define HASH_HPP
+
+/* ************************************************************************** */
+
+#include <cstring>
+#include <bit>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// 128-bit unsigned integer (GCC/Clang extension), for the wide products below
+
+__extension__ typedef unsigned __int128 uint128;
+
+/* ************************************************************************** */
+
+// Full-avalanche finalizer (splitmix64): a bijection on 64-bit words
+
+inline ulong Mix64(ulong) noexcept;
+
+// 64x64 -> 128 bit multiply, folded back to 64 bits
+
+inline ulong MulFold(ulong, ulong) noexcept;
+
+// wyhash-style hash of a byte sequence
+
+inline ulong HashBytes(const void *, ulong, ulong = 0) noexcept;
+
+// Maps a 64-bit hash uniformly onto [0, range) with no division ("fast range")
+
+inline ulong FastRange(ulong, ulong) noexcept;
+
+/* ************************************************************************** */
+
+}
+
+#include "hash.cpp"
+
+#endif
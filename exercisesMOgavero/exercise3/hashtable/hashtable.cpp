@@ -1,9 +1,11 @@
 
-namespace lasd {
+#include <string>
+#include <string_view>
+#include <cstring>
 
 /* ************************************************************************** */
 
-#include <string>
+namespace lasd {
 
 /* ************************************************************************** */
 
@@ -13,7 +15,7 @@ class Hashable<int> {
 public:
 
   ulong operator()(const int & dat) const noexcept {
-    return (dat * dat);
+    return Mix64(static_cast<ulong>(dat));
   }
 
 };
@@ -24,9 +26,7 @@ class Hashable<double> {
 public:
 
   ulong operator()(const double & dat) const noexcept {
-    long intgpart = floor(dat);
-    long fracpart = pow(2, 24) * (dat - intgpart);
-    return (intgpart * fracpart);
+    return Mix64(std::bit_cast<ulong>((dat == 0.0) ? 0.0 : dat));
   }
 
 };
@@ -36,12 +36,18 @@ class Hashable<std::string> {
 
 public:
 
+  using is_transparent = void;
+
   ulong operator()(const std::string & dat) const noexcept {
-    ulong hash = 5381;
-    for (ulong i = 0; i < dat.length(); ++i) {
-      hash = (hash << 5) + dat[i];
-    }
-    return hash;
+    return HashBytes(dat.data(), dat.length());
+  }
+
+  ulong operator()(std::string_view dat) const noexcept {
+    return HashBytes(dat.data(), dat.length());
+  }
+
+  ulong operator()(const char * dat) const noexcept {
+    return HashBytes(dat, std::strlen(dat));
   }
 
 };
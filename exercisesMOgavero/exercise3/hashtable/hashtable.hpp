@@ -5,11 +5,16 @@
 /* ************************************************************************** */
 
 #include <random>
+#include <limits>
+#include <concepts>
 
 /* ************************************************************************** */
 
 #include "../container/dictionary.hpp"
 
+#include "hash/hash.hpp"
+#include "../stats/stats.hpp"
+
 /* ************************************************************************** */
 
 namespace lasd {
@@ -27,9 +32,21 @@ public:
 
 /* ************************************************************************** */
 
+// Key types that can be looked up in place of Data (same hash, comparable with Data)
+
+template <typename Data, typename Key>
+concept HashCompatible = std::same_as<Key, Data> || requires(const Hashable<Data> & hsh, const Key & key, const Data & dat) {
+  typename Hashable<Data>::is_transparent;
+  { hsh(key) } -> std::convertible_to<ulong>;
+  { dat == key } -> std::convertible_to<bool>;
+};
+
+/* ************************************************************************** */
+
 template <typename Data>
 class HashTable : virtual public ResizableContainer,
-  virtual public DictionaryContainer<Data> {
+  virtual public DictionaryContainer<Data>,
+  public StatsPolicy {
 
 private:
 
@@ -39,21 +56,22 @@ protected:
 
   ulong acoeff = 1;
   ulong bcoeff = 0;
-  static const ulong prime = 1000000016531;
+  static const ulong prime = 1000000016531; // Only for HashTableOpnAdr::HashIdx (HashKey uses FastRange)
 
   std::default_random_engine gen = std::default_random_engine(std::random_device {}());
-  std::uniform_int_distribution<ulong> dista = std::uniform_int_distribution<ulong>(1, prime - 1);
-  std::uniform_int_distribution<ulong> distb = std::uniform_int_distribution<ulong>(0, prime - 1);
+  std::uniform_int_distribution<ulong> dista = std::uniform_int_distribution<ulong>(1, std::numeric_limits<ulong>::max());
+  std::uniform_int_distribution<ulong> distb = std::uniform_int_distribution<ulong>(0, std::numeric_limits<ulong>::max());
 
   static const Hashable<Data> enchash;
 
-  ulong tablesize = 128;
+  static constexpr ulong defaultsize = 128;
+  ulong tablesize = defaultsize;
 
   /* ************************************************************************ */
 
   // Default constructor
   HashTable() {
-    acoeff = dista(gen);
+    acoeff = dista(gen) | 1;
     bcoeff = distb(gen);
   }
 
@@ -106,14 +124,26 @@ public:
   bool operator==(const HashTable &) const noexcept = delete;
   bool operator!=(const HashTable &) const noexcept = delete;
 
+  /* ************************************************************************ */
+
+  // Specific member function
+
+  // Encoded key, independent of the table: compute it once and reuse it with
+  // the *Hashed member functions of any hash table on Data
+  template <typename Key> requires HashCompatible<Data, Key>
+  inline static ulong Hash(const Key & key) noexcept {
+    return enchash(key);
+  }
+
 protected:
 
   virtual ulong HashKey(const Data & dat) const noexcept {
     return HashKey(enchash(dat));
   }
 
+  // Multiply-shift on the encoded key, reduced onto the table without division
   virtual ulong HashKey(ulong key) const noexcept {
-    return (((acoeff * key + bcoeff) % prime) % tablesize);
+    return FastRange(acoeff * key + bcoeff, tablesize);
   }
 
 };
@@ -6,10 +6,10 @@ namespace lasd {
 // Specific constructors
 
 template<typename Data>
-HashTableOpnAdr<Data>::HashTableOpnAdr(ulong newtablesize) : HashTableOpnAdr() {
+HashTableOpnAdr<Data>::HashTableOpnAdr(ulong newtablesize) : table(newtablesize), flagtable(newtablesize) {
+  ccoeff = 2 * dista(gen) + 1;
+  dcoeff = 2 * distb(gen);
   tablesize = newtablesize;
-  table.Resize(tablesize);
-  flagtable.Resize(tablesize);
 }
 
 template<typename Data>
@@ -23,7 +23,7 @@ HashTableOpnAdr<Data>::HashTableOpnAdr(ulong newtablesize, const TraversableCont
 }
 
 template<typename Data>
-HashTableOpnAdr<Data>::HashTableOpnAdr(MappableContainer<Data> && con) {
+HashTableOpnAdr<Data>::HashTableOpnAdr(MappableContainer<Data> && con) : HashTableOpnAdr() {
   InsertAll(std::move(con));
 }
 
@@ -36,16 +36,14 @@ HashTableOpnAdr<Data>::HashTableOpnAdr(ulong newtablesize, MappableContainer<Dat
 
 // Copy constructor
 template<typename Data>
-HashTableOpnAdr<Data>::HashTableOpnAdr(const HashTableOpnAdr<Data> & ht) : HashTable<Data>(ht) {
+HashTableOpnAdr<Data>::HashTableOpnAdr(const HashTableOpnAdr<Data> & ht) : HashTable<Data>(ht), table(ht.table), flagtable(ht.flagtable) {
   ccoeff = ht.ccoeff;
   dcoeff = ht.dcoeff;
-  table = ht.table;
-  flagtable = ht.flagtable;
 }
 
-// Move constructor
+// Move constructor (the moved-from table keeps defaultsize slots, as its tablesize says)
 template<typename Data>
-HashTableOpnAdr<Data>::HashTableOpnAdr(HashTableOpnAdr<Data> && ht) noexcept : HashTable<Data>(std::move(ht)) {
+HashTableOpnAdr<Data>::HashTableOpnAdr(HashTableOpnAdr<Data> && ht) noexcept : HashTable<Data>(std::move(ht)), table(defaultsize), flagtable(defaultsize) {
   std::swap(ccoeff, ht.ccoeff);
   std::swap(dcoeff, ht.dcoeff);
   std::swap(table, ht.table);
@@ -106,66 +104,158 @@ inline bool HashTableOpnAdr<Data>::operator!=(const HashTableOpnAdr<Data> & ht)
 
 template<typename Data>
 bool HashTableOpnAdr<Data>::Insert(const Data & dat) {
+  return InsertHashed(enchash(dat), dat);
+}
+
+template<typename Data>
+bool HashTableOpnAdr<Data>::Insert(Data && dat) {
+  return InsertHashed(enchash(dat), std::move(dat));
+}
+
+template<typename Data>
+bool HashTableOpnAdr<Data>::Remove(const Data & dat) {
+  return RemoveHashed(enchash(dat), dat);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (inherited from TestableContainer)
+
+template<typename Data>
+bool HashTableOpnAdr<Data>::Exists(const Data & dat) const noexcept {
+  return ExistsHashed(enchash(dat), dat);
+};
+
+/* ************************************************************************** */
+
+// Specific member functions (heterogeneous and precomputed-hash lookup)
+
+template<typename Data>
+template<typename Key> requires HashCompatible<Data, Key>
+inline bool HashTableOpnAdr<Data>::Exists(const Key & key) const noexcept {
+  return ExistsHashed(enchash(key), key);
+}
+
+template<typename Data>
+template<typename Key> requires HashCompatible<Data, Key>
+inline bool HashTableOpnAdr<Data>::ExistsHashed(ulong hash, const Key & key) const noexcept {
+  return ExistsAt(HashKey(hash), key);
+}
+
+template<typename Data>
+bool HashTableOpnAdr<Data>::InsertHashed(ulong hash, const Data & dat) {
   if (2 * size > tablesize) {
     Resize(2 * tablesize);
   }
-  ulong idx = FindEmpty(dat, 0);
-  if (idx < tablesize) {
-    ulong pos = HashKey(dat, idx);
-    if (flagtable[pos] > 1) {
-      return false;
-    } else {
-      table[pos] = dat;
-      flagtable[pos] = 2;
-      ++size;
-      return !Remove(dat, idx + 1);
-    }
-  } else {
-    throw std::length_error("Unsuccessful Insertion.");
-  }
+  return InsertAt(HashKey(hash), dat);
 }
 
 template<typename Data>
-bool HashTableOpnAdr<Data>::Insert(Data && dat) {
+bool HashTableOpnAdr<Data>::InsertHashed(ulong hash, Data && dat) {
   if (2 * size > tablesize) {
     Resize(2 * tablesize);
   }
-  ulong idx = FindEmpty(dat, 0);
-  if (idx < tablesize) {
-    ulong pos = HashKey(dat, idx);
-    if (flagtable[pos] > 1) {
-      return false;
-    } else {
-      table[pos] = std::move(dat);
-      flagtable[pos] = 2;
-      ++size;
-      return !Remove(dat, idx + 1);
+  return InsertAt(HashKey(hash), std::move(dat));
+}
+
+template<typename Data>
+bool HashTableOpnAdr<Data>::RemoveHashed(ulong hash, const Data & dat) {
+  return Remove(dat, HashKey(hash), 0);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (batch operations)
+
+template<typename Data>
+void HashTableOpnAdr<Data>::ExistsBatch(const Vector<Data> & keys, Vector<bool> & out) const {
+  if (out.Size() != keys.Size()) {
+    out.Resize(keys.Size());
+  }
+  ulong home[batch];
+  const char * flags = flagtable.data();
+  const Data * slots = table.data();
+  for (ulong i = 0; i < keys.Size(); i += batch) {
+    ulong num = (keys.Size() - i < batch) ? (keys.Size() - i) : batch;
+    for (ulong j = 0; j < num; ++j) {
+      home[j] = HashKey(enchash(keys[i + j]));
+      __builtin_prefetch(flags + home[j]);
+      __builtin_prefetch(slots + home[j]);
+    }
+    for (ulong j = 0; j < num; ++j) {
+      out[i + j] = ExistsAt(home[j], keys[i + j]);
     }
-  } else {
-    throw std::length_error("Unsuccessful Insertion.");
   }
 }
 
 template<typename Data>
-bool HashTableOpnAdr<Data>::Remove(const Data & dat) {
-  return Remove(dat, 0);
+bool HashTableOpnAdr<Data>::InsertBatch(const Vector<Data> & keys) {
+  ulong newtablesize = tablesize;
+  while (2 * (size + keys.Size()) > newtablesize) {
+    newtablesize *= 2;
+  }
+  if (newtablesize != tablesize) {
+    Resize(newtablesize);
+  }
+  bool all = true;
+  ulong home[batch];
+  const char * flags = flagtable.data();
+  const Data * slots = table.data();
+  for (ulong i = 0; i < keys.Size(); i += batch) {
+    ulong num = (keys.Size() - i < batch) ? (keys.Size() - i) : batch;
+    for (ulong j = 0; j < num; ++j) {
+      home[j] = HashKey(enchash(keys[i + j]));
+      __builtin_prefetch(flags + home[j], 1);
+      __builtin_prefetch(slots + home[j], 1);
+    }
+    for (ulong j = 0; j < num; ++j) {
+      all &= InsertAt(home[j], keys[i + j]);
+    }
+  }
+  return all;
 }
 
 /* ************************************************************************** */
 
-// Specific member functions (inherited from TestableContainer)
+// Specific member functions (streaming construction)
 
 template<typename Data>
-bool HashTableOpnAdr<Data>::Exists(const Data & dat) const noexcept {
-  ulong idx = Find(dat, 0);
-  if (idx < tablesize) {
-    ulong pos = HashKey(dat, idx);
-    if (flagtable[pos] != 0) {
-      return true;
+template<typename Source>
+void HashTableOpnAdr<Data>::Build(Source && src, ulong hint) {
+  ulong exp = (hint < SizeHintOf(src)) ? SizeHintOf(src) : hint;
+  ulong newtablesize = defaultsize;
+  while (2 * exp > newtablesize) {
+    newtablesize *= 2;
+  }
+  HashTableOpnAdr<Data> tmpht(newtablesize);
+  Vector<Data> chunk(1024);
+  bool more = true;
+  while (more) {
+    ulong num = 0;
+    while (num < chunk.Size() && (more = src(chunk[num]))) {
+      ++num;
     }
+    if (num < chunk.Size()) {
+      chunk.Resize(num);
+    }
+    tmpht.InsertBatch(chunk);
   }
-  return false;
-};
+  std::swap(tmpht, *this);
+}
+
+/* ************************************************************************** */
+
+// Specific member function (inherited from Container)
+
+template<typename Data>
+MemStats HashTableOpnAdr<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this) + flagtable.Size() * sizeof(char);
+  mem.slack = (table.Size() - size) * sizeof(Data);
+  mem.allocations = table.MemoryUsage().allocations + flagtable.MemoryUsage().allocations;
+  return mem;
+}
 
 /* ************************************************************************** */
 
@@ -180,6 +270,10 @@ void HashTableOpnAdr<Data>::Resize(ulong newtablesize) {
       tmpht->Insert(std::move(table[i]));
     }
   }
+  this->CountOp(StatOp::Resize);
+  this->CountOp(StatOp::Allocation);
+  this->CountOp(StatOp::Move, size);
+  this->CountAll(tmpht->Stats());
   std::swap(*tmpht, *this);
   delete tmpht;
 };
@@ -191,7 +285,7 @@ void HashTableOpnAdr<Data>::Resize(ulong newtablesize) {
 template<typename Data>
 void HashTableOpnAdr<Data>::Clear() {
   size = 0;
-  tablesize = 128;
+  tablesize = defaultsize;
   table.Clear();
   table.Resize(tablesize);
   flagtable.Clear();
@@ -203,12 +297,9 @@ void HashTableOpnAdr<Data>::Clear() {
 // Auxiliary member functions
 
 template<typename Data>
-ulong HashTableOpnAdr<Data>::HashKey(const Data & dat, ulong idx) const noexcept {
-  ulong enckey = enchash(dat);
-  return ((HashKey(enckey) + idx) % tablesize);
-  // return ((HashKey(enckey) + (ccoeff * idx + dcoeff)) % tablesize);
-  // return ((HashKey(enckey) + ((idx * idx + idx) / 2)) % tablesize);
-  // return ((HashKey(enckey) + (HashIdx(enckey) * idx)) % tablesize);
+inline ulong HashTableOpnAdr<Data>::Probe(ulong home, ulong idx) const noexcept {
+  ulong pos = home + idx;
+  return (pos < tablesize) ? pos : (pos % tablesize);
 }
 
 template<typename Data>
@@ -217,34 +308,88 @@ ulong HashTableOpnAdr<Data>::HashIdx(ulong key) const noexcept {
 }
 
 template<typename Data>
-ulong HashTableOpnAdr<Data>::Find(const Data & dat, ulong idx) const noexcept {
-  ulong pos = HashKey(dat, idx);
+template<typename Key>
+bool HashTableOpnAdr<Data>::ExistsAt(ulong home, const Key & key) const noexcept {
+  ulong idx = Find(key, home, 0);
+  if (idx < tablesize) {
+    ulong pos = Probe(home, idx);
+    if (flagtable[pos] != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template<typename Data>
+bool HashTableOpnAdr<Data>::InsertAt(ulong home, const Data & dat) {
+  ulong idx = FindEmpty(dat, home, 0);
+  if (idx < tablesize) {
+    ulong pos = Probe(home, idx);
+    if (flagtable[pos] > 1) {
+      return false;
+    } else {
+      table[pos] = dat;
+      flagtable[pos] = 2;
+      ++size;
+      return !Remove(dat, home, idx + 1);
+    }
+  } else {
+    throw std::length_error("Unsuccessful Insertion.");
+  }
+}
+
+template<typename Data>
+bool HashTableOpnAdr<Data>::InsertAt(ulong home, Data && dat) {
+  ulong idx = FindEmpty(dat, home, 0);
+  if (idx < tablesize) {
+    ulong pos = Probe(home, idx);
+    if (flagtable[pos] > 1) {
+      return false;
+    } else {
+      table[pos] = std::move(dat);
+      flagtable[pos] = 2;
+      ++size;
+      return !Remove(table[pos], home, idx + 1);
+    }
+  } else {
+    throw std::length_error("Unsuccessful Insertion.");
+  }
+}
+
+template<typename Data>
+template<typename Key>
+ulong HashTableOpnAdr<Data>::Find(const Key & key, ulong home, ulong idx) const noexcept {
+  ulong fst = idx;
+  ulong pos = Probe(home, idx);
   while ((idx < tablesize) && (flagtable[pos] != 0)) {
-    if ((flagtable[pos] != 1) && (table[pos] == dat)) {
+    if ((flagtable[pos] != 1) && (table[pos] == key)) {
       break;
     }
-    pos = HashKey(dat, ++idx);
+    pos = Probe(home, ++idx);
   }
+  this->CountOp(StatOp::Probe, idx - fst + (idx < tablesize));
   return idx;
 };
 
 template<typename Data>
-ulong HashTableOpnAdr<Data>::FindEmpty(const Data & dat, ulong idx) const noexcept {
-  ulong pos = HashKey(dat, idx);
+ulong HashTableOpnAdr<Data>::FindEmpty(const Data & dat, ulong home, ulong idx) const noexcept {
+  ulong fst = idx;
+  ulong pos = Probe(home, idx);
   while ((idx < tablesize) && (flagtable[pos] > 1)) {
     if (table[pos] == dat) {
       break;
     }
-    pos = HashKey(dat, ++idx);
+    pos = Probe(home, ++idx);
   }
+  this->CountOp(StatOp::Probe, idx - fst + (idx < tablesize));
   return idx;
 };
 
 template<typename Data>
-bool HashTableOpnAdr<Data>::Remove(const Data & dat, ulong idx) {
-  idx = Find(dat, idx);
+bool HashTableOpnAdr<Data>::Remove(const Data & dat, ulong home, ulong idx) {
+  idx = Find(dat, home, idx);
   if (idx < tablesize) {
-    ulong pos = HashKey(dat, idx);
+    ulong pos = Probe(home, idx);
     if (flagtable[pos] != 0) {
       flagtable[pos] = 1;
       --size;
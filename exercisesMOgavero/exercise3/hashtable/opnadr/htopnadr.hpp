@@ -6,6 +6,7 @@
 
 #include "../hashtable.hpp"
 #include "../../vector/vector.hpp"
+#include "../../stream/stream.hpp"
 
 /* ************************************************************************** */
 
@@ -31,22 +32,23 @@ protected:
   using HashTable<Data>::enchash;
 
   using HashTable<Data>::size;
+  using HashTable<Data>::defaultsize;
   using HashTable<Data>::tablesize;
 
   using HashTable<Data>::HashKey;
   using HashTable<Data>::Insert;
   using HashTable<Data>::InsertAll;
 
-  Vector<Data> table = Vector<Data>(tablesize);
-  Vector<char> flagtable = Vector<char>(tablesize);
+  static const ulong batch = 16;
+
+  // Sized by each constructor (tablesize slots)
+  Vector<Data> table;
+  Vector<char> flagtable;
 
 public:
 
   // Default constructor
-  HashTableOpnAdr() {
-    ccoeff = 2 * dista(gen) + 1;
-    dcoeff = 2 * distb(gen);
-  }
+  HashTableOpnAdr() : HashTableOpnAdr(defaultsize) {}
 
   /* ************************************************************************ */
 
@@ -103,6 +105,46 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member functions (heterogeneous and precomputed-hash lookup)
+
+  template <typename Key> requires HashCompatible<Data, Key>
+  bool Exists(const Key &) const noexcept;
+
+  template <typename Key> requires HashCompatible<Data, Key>
+  bool ExistsHashed(ulong, const Key &) const noexcept;
+
+  bool InsertHashed(ulong, const Data &);
+  bool InsertHashed(ulong, Data &&);
+  bool RemoveHashed(ulong, const Data &);
+
+  /* ************************************************************************ */
+
+  // Specific member functions (batch operations)
+
+  // Keys are hashed a group at a time and their home slots prefetched
+  // before any of them is probed, overlapping the cache misses
+  void ExistsBatch(const Vector<Data> &, Vector<bool> &) const;
+  bool InsertBatch(const Vector<Data> &);
+
+  /* ************************************************************************ */
+
+  // Specific member functions (streaming construction, sources in stream/stream.hpp)
+
+  // Replaces the content with the records of the source: the table is sized
+  // once from the hint (or the source SizeHint) and the records are inserted
+  // a chunk at a time through InsertBatch; the table is left unchanged if
+  // the source throws
+  template <typename Source>
+  void Build(Source &&, ulong = 0);
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override; // (the empty and deleted slots are slack)
+
+  /* ************************************************************************ */
+
   // Specific member functions (inherited from ResizableContainer)
 
   void Resize(ulong) override;
@@ -115,15 +157,22 @@ public:
 
 protected:
 
-  virtual ulong HashKey(const Data & dat, ulong idx) const noexcept;
+  inline ulong Probe(ulong home, ulong idx) const noexcept;
 
   virtual ulong HashIdx(ulong key) const noexcept;
 
-  virtual ulong Find(const Data & dat, ulong idx) const noexcept;
+  template <typename Key>
+  bool ExistsAt(ulong home, const Key & key) const noexcept;
+
+  bool InsertAt(ulong home, const Data & dat);
+  bool InsertAt(ulong home, Data && dat);
+
+  template <typename Key>
+  ulong Find(const Key & key, ulong home, ulong idx) const noexcept;
 
-  virtual ulong FindEmpty(const Data & dat, ulong idx) const noexcept;
+  virtual ulong FindEmpty(const Data & dat, ulong home, ulong idx) const noexcept;
 
-  virtual bool Remove(const Data &, ulong idx);
+  virtual bool Remove(const Data &, ulong home, ulong idx);
 
 };
 
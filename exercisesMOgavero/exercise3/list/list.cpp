@@ -256,6 +256,19 @@ void List<Data>::InsertAtBack(Data && dat) {
 
 /* ************************************************************************** */
 
+// Specific member function (List) (inherited from Container)
+
+template<typename Data>
+MemStats List<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this) + size * (sizeof(Node) - sizeof(Data));
+  mem.allocations = size;
+  return mem;
+}
+
+/* ************************************************************************** */
+
 // Specific member functions (List) (inherited from ClearableContainer)
 
 template<typename Data>
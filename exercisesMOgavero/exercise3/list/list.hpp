@@ -123,6 +123,12 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override;
+
+  /* ************************************************************************ */
+
   // Specific member function (inherited from ClearableContainer)
 
   void Clear() override;
@@ -11,6 +11,7 @@
 
 int main() {
   std::cout << "LASD Libraries 2024" << std::endl;
+  mytest();
   lasdtest();
   return 0;
 }
@@ -67,4 +67,15 @@ inline void QueueLst<Data>::Enqueue(Data && dat) {
 
 /* ************************************************************************** */
 
+// Specific member function (QueueLst) (inherited from Container)
+
+template<typename Data>
+inline MemStats QueueLst<Data>::MemoryUsage() const noexcept {
+  MemStats mem = List<Data>::MemoryUsage();
+  mem.overhead += sizeof(*this) - sizeof(List<Data>);
+  return mem;
+}
+
+/* ************************************************************************** */
+
 }
@@ -139,6 +139,16 @@ inline ulong QueueVec<Data>::Size() const noexcept {
   return (((size + tail) - head) % size);
 }
 
+template<typename Data>
+MemStats QueueVec<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = Size() * sizeof(Data);
+  mem.overhead = sizeof(*this);
+  mem.slack = (size - Size()) * sizeof(Data);
+  mem.allocations = (Elements != nullptr) ? 1 : 0;
+  return mem;
+}
+
 /* ************************************************************************** */
 
 // Specific member functions (QueueVec) (inherited from ClearableContainer)
@@ -84,6 +84,8 @@ public:
 
   inline ulong Size() const noexcept override;
 
+  MemStats MemoryUsage() const noexcept override; // (the free positions of the vector are slack)
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from ClearableContainer)
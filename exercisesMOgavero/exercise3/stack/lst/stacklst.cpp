@@ -67,4 +67,15 @@ inline void StackLst<Data>::Push(Data && dat) {
 
 /* ************************************************************************** */
 
+// Specific member function (StackLst) (inherited from Container)
+
+template<typename Data>
+inline MemStats StackLst<Data>::MemoryUsage() const noexcept {
+  MemStats mem = List<Data>::MemoryUsage();
+  mem.overhead += sizeof(*this) - sizeof(List<Data>);
+  return mem;
+}
+
+/* ************************************************************************** */
+
 }
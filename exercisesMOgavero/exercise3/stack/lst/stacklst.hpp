@@ -72,6 +72,12 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member function (inherited from Container)
+
+  inline MemStats MemoryUsage() const noexcept override;
+
+  /* ************************************************************************ */
+
   // Specific member function (inherited from ClearableContainer)
 
   using List<Data>::Clear;
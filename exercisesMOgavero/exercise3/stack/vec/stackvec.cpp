@@ -118,6 +118,16 @@ inline ulong StackVec<Data>::Size() const noexcept {
   return index;
 }
 
+template<typename Data>
+MemStats StackVec<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = Size() * sizeof(Data);
+  mem.overhead = sizeof(*this);
+  mem.slack = (size - Size()) * sizeof(Data);
+  mem.allocations = (Elements != nullptr) ? 1 : 0;
+  return mem;
+}
+
 /* ************************************************************************** */
 
 // Specific member functions (StackVec) (inherited from ClearableContainer)
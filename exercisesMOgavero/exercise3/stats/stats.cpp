@@ -0,0 +1,60 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Specific member functions (OpStats)
+
+inline OpStats & OpStats::operator+=(const OpStats & sts) noexcept {
+  comparisons += sts.comparisons;
+  moves += sts.moves;
+  copies += sts.copies;
+  allocations += sts.allocations;
+  probes += sts.probes;
+  rotations += sts.rotations;
+  resizes += sts.resizes;
+  return *this;
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (CountingStats)
+
+inline OpStats CountingStats::Stats() const noexcept {
+  auto get = [this](StatOp op) {
+    return counters[static_cast<int>(op)].load(std::memory_order_relaxed);
+  };
+  OpStats sts;
+  sts.comparisons = get(StatOp::Comparison);
+  sts.moves = get(StatOp::Move);
+  sts.copies = get(StatOp::Copy);
+  sts.allocations = get(StatOp::Allocation);
+  sts.probes = get(StatOp::Probe);
+  sts.rotations = get(StatOp::Rotation);
+  sts.resizes = get(StatOp::Resize);
+  return sts;
+}
+
+inline void CountingStats::ResetStats() noexcept {
+  for (std::atomic<ulong> & cnt : counters) {
+    cnt.store(0, std::memory_order_relaxed);
+  }
+}
+
+/* ************************************************************************** */
+
+// Auxiliary member functions (CountingStats)
+
+inline void CountingStats::CountAll(const OpStats & sts) const noexcept {
+  CountOp(StatOp::Comparison, sts.comparisons);
+  CountOp(StatOp::Move, sts.moves);
+  CountOp(StatOp::Copy, sts.copies);
+  CountOp(StatOp::Allocation, sts.allocations);
+  CountOp(StatOp::Probe, sts.probes);
+  CountOp(StatOp::Rotation, sts.rotations);
+  CountOp(StatOp::Resize, sts.resizes);
+}
+
+/* ************************************************************************** */
+
+}
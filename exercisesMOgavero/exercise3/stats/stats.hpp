@@ -0,0 +1,130 @@
+
+#ifndef STATS_HPP
+#define STATS_HPP
+
+/* ************************************************************************** */
+
+#include <atomic>
+
+/* ************************************************************************** */
+
+#include "../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Operation counters, switched at compile time. With LASD_STATS defined
+// (make stats=1) the instrumented containers derive from CountingStats and
+// count comparisons, element moves and copies, allocations, probe steps,
+// rotations and resizes; Stats() returns a snapshot and ResetStats() clears
+// it. Otherwise they derive from NoStats, an empty class whose CountOp()
+// does nothing, so the counters cost nothing. The macro must be set in the
+// same way for every translation unit.
+
+struct OpStats {
+
+  ulong comparisons = 0;
+  ulong moves = 0; // (a swap counts as three)
+  ulong copies = 0;
+  ulong allocations = 0;
+  ulong probes = 0;
+  ulong rotations = 0;
+  ulong resizes = 0;
+
+  OpStats & operator+=(const OpStats &) noexcept;
+  bool operator==(const OpStats &) const noexcept = default;
+
+};
+
+enum class StatOp { Comparison, Move, Copy, Allocation, Probe, Rotation, Resize };
+
+/* ************************************************************************** */
+
+// The counters belong to the object: a copy starts from zero and an
+// assignment leaves them alone. They are relaxed atomics, so that the const
+// member functions may count from concurrent readers.
+
+class CountingStats {
+
+private:
+
+  mutable std::atomic<ulong> counters[7] = {};
+
+public:
+
+  static constexpr bool Enabled = true;
+
+  // Default constructor
+  CountingStats() = default;
+
+  // Copy constructor
+  CountingStats(const CountingStats &) noexcept {}
+
+  // Copy assignment
+  CountingStats & operator=(const CountingStats &) noexcept {
+    return *this;
+  }
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  OpStats Stats() const noexcept;
+  void ResetStats() noexcept;
+
+protected:
+
+  // Auxiliary member functions
+
+  inline void CountOp(StatOp op, ulong num = 1) const noexcept {
+    counters[static_cast<int>(op)].fetch_add(num, std::memory_order_relaxed);
+  }
+
+  void CountAll(const OpStats &) const noexcept; // (adds the counters of a part about to be dropped)
+
+};
+
+/* ************************************************************************** */
+
+class NoStats {
+
+public:
+
+  static constexpr bool Enabled = false;
+
+  // Specific member functions
+
+  inline OpStats Stats() const noexcept {
+    return OpStats();
+  }
+
+  inline void ResetStats() noexcept {}
+
+protected:
+
+  // Auxiliary member functions
+
+  inline void CountOp(StatOp, ulong = 1) const noexcept {}
+
+  inline void CountAll(const OpStats &) const noexcept {}
+
+};
+
+/* ************************************************************************** */
+
+#ifdef LASD_STATS
+using StatsPolicy = CountingStats;
+#else
+using StatsPolicy = NoStats;
+#endif
+
+/* ************************************************************************** */
+
+}
+
+#include "stats.cpp"
+
+#endif
@@ -0,0 +1,149 @@
+
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Source>
+ulong SizeHintOf(const Source & src) noexcept {
+  if constexpr (requires { { src.SizeHint() } -> std::convertible_to<ulong>; }) {
+    return src.SizeHint();
+  } else {
+    return 0;
+  }
+}
+
+// Blanks of the "C" locale, without going through std::isspace and the current locale
+inline bool IsBlank(char chr) noexcept {
+  return chr == ' ' || (chr >= '\t' && chr <= '\r');
+}
+
+/* ************************************************************************** */
+
+// Specific constructor (TextSource)
+
+template <typename Data>
+TextSource<Data>::TextSource(std::istream & str, ulong chk) : in(str), chunk((chk < 64) ? 64 : chk) {
+  buf = std::make_unique<char[]>(chunk);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (TextSource)
+
+template <typename Data>
+bool TextSource<Data>::operator()(Data & dat) {
+  while (true) {
+    while (pos < len && IsBlank(buf[pos])) {
+      ++pos;
+    }
+    if (pos == len && !Refill()) {
+      return false;
+    }
+    if (pos == len || IsBlank(buf[pos])) {
+      continue;
+    }
+    ulong end = pos;
+    while (end < len && !IsBlank(buf[end])) {
+      ++end;
+    }
+    // A token reaching the end of the chunk may go on in the next one
+    if (end == len && !eof) {
+      Refill();
+      continue;
+    }
+    const char * fst = buf.get() + pos;
+    const char * lst = buf.get() + end;
+    if (*fst == '+') {
+      ++fst;
+    }
+    auto [ptr, err] = std::from_chars(fst, lst, dat);
+    if (err != std::errc() || ptr != lst) {
+      throw std::invalid_argument("Not a number: \"" + std::string(buf.get() + pos, end - pos) + "\"");
+    }
+    pos = end;
+    return true;
+  }
+}
+
+/* ************************************************************************** */
+
+// Auxiliary member functions (TextSource)
+
+// Moves the unread rest to the front and reads the next chunk after it
+template <typename Data>
+bool TextSource<Data>::Refill() {
+  if (eof) {
+    return false;
+  }
+  ulong rest = len - pos;
+  if (rest == chunk) {
+    std::unique_ptr<char[]> big = std::make_unique<char[]>(2 * chunk);
+    std::memcpy(big.get(), buf.get() + pos, rest);
+    buf = std::move(big);
+    chunk *= 2;
+  } else if (rest != 0) {
+    std::memmove(buf.get(), buf.get() + pos, rest);
+  }
+  pos = 0;
+  in.read(buf.get() + rest, chunk - rest);
+  len = rest + in.gcount();
+  if (in.bad()) {
+    throw std::runtime_error("Error reading the input stream.");
+  }
+  eof = !in;
+  return true;
+}
+
+/* ************************************************************************** */
+
+// Specific constructor (BinarySource)
+
+template <typename Data>
+BinarySource<Data>::BinarySource(std::istream & str, ulong chk) : in(str), chunk((chk == 0) ? 1 : chk) {
+  buf = std::make_unique<Data[]>(chunk);
+  std::istream::pos_type cur = in.tellg();
+  if (cur != std::istream::pos_type(-1) && in.seekg(0, std::ios::end)) {
+    std::istream::pos_type lst = in.tellg();
+    in.seekg(cur);
+    if (lst != std::istream::pos_type(-1) && lst >= cur) {
+      hint = static_cast<ulong>(lst - cur) / sizeof(Data);
+    }
+  }
+  in.clear(in.rdstate() & std::ios::badbit);
+}
+
+/* ************************************************************************** */
+
+// Specific member functions (BinarySource)
+
+template <typename Data>
+bool BinarySource<Data>::operator()(Data & dat) {
+  if (pos == num) {
+    in.read(reinterpret_cast<char *>(buf.get()), chunk * sizeof(Data));
+    ulong cnt = in.gcount();
+    if (in.bad()) {
+      throw std::runtime_error("Error reading the input stream.");
+    }
+    if (cnt % sizeof(Data) != 0) {
+      throw std::runtime_error("Binary stream ends inside a record.");
+    }
+    pos = 0;
+    num = cnt / sizeof(Data);
+    if (num == 0) {
+      return false;
+    }
+  }
+  dat = buf[pos++];
+  return true;
+}
+
+/* ************************************************************************** */
+
+}
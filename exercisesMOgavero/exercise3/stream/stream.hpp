@@ -0,0 +1,112 @@
+
+#ifndef STREAM_HPP
+#define STREAM_HPP
+
+/* ************************************************************************** */
+
+#include <istream>
+#include <memory>
+#include <type_traits>
+
+/* ************************************************************************** */
+
+#include "../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Record sources for streaming construction. A source is any callable
+// bool src(Data &) which writes the next record and returns false at the
+// end, so a generator lambda is a source as it is. The sources below read an
+// std::istream a chunk at a time, with no intermediate container: TextSource
+// parses whitespace-separated numbers through std::from_chars (no locale, no
+// allocation per record), BinarySource copies raw records of sizeof(Data)
+// bytes. A source may also provide SizeHint(), the number of records it
+// expects (0 when unknown), which the builders use to reserve space once.
+
+// Records expected from a source (0 when it has no SizeHint)
+template <typename Source>
+ulong SizeHintOf(const Source &) noexcept;
+
+/* ************************************************************************** */
+
+template <typename Data>
+class TextSource {
+
+  static_assert(std::is_arithmetic_v<Data> && !std::is_same_v<Data, bool>, "TextSource parses numbers only");
+
+private:
+
+protected:
+
+  std::istream & in;
+  ulong chunk;
+  std::unique_ptr<char[]> buf; // A chunk, after the rest of a number split between two chunks
+  ulong pos = 0;
+  ulong len = 0;
+  bool eof = false;
+
+public:
+
+  // Specific constructor
+  explicit TextSource(std::istream &, ulong = 1 << 16);
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  bool operator()(Data &); // (must throw std::invalid_argument when a token is not a number)
+
+  inline ulong SizeHint() const noexcept { return 0; }
+
+protected:
+
+  // Auxiliary member functions
+
+  bool Refill();
+
+};
+
+/* ************************************************************************** */
+
+template <typename Data>
+class BinarySource {
+
+  static_assert(std::is_trivially_copyable_v<Data>, "BinarySource needs a trivially copyable Data");
+
+private:
+
+protected:
+
+  std::istream & in;
+  ulong chunk; // (in records)
+  std::unique_ptr<Data[]> buf;
+  ulong pos = 0;
+  ulong num = 0;
+  ulong hint = 0;
+
+public:
+
+  // Specific constructor
+  explicit BinarySource(std::istream &, ulong = 1 << 14);
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  bool operator()(Data &); // (must throw std::runtime_error when the stream ends inside a record)
+
+  inline ulong SizeHint() const noexcept { return hint; } // Records left in the stream, when it is seekable
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "stream.cpp"
+
+#endif
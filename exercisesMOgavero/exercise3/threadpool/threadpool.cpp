@@ -0,0 +1,194 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Task
+
+inline void ThreadPool::Task::Execute() noexcept {
+  try {
+    Run();
+  } catch (...) {
+    err = std::current_exception();
+  }
+  done.store(true, std::memory_order_release);
+}
+
+/* ************************************************************************** */
+
+// Specific constructor
+
+inline ThreadPool::ThreadPool(ulong newthreads) {
+  threads = (newthreads == 0) ? 1 : newthreads;
+  slots = new Slot[threads + 1];
+  workers = new std::thread[threads];
+  for (ulong idx = 0; idx < threads; ++idx) {
+    workers[idx] = std::thread([this, idx]() { Work(idx); });
+  }
+}
+
+/* ************************************************************************** */
+
+// Destructor
+
+inline ThreadPool::~ThreadPool() {
+  stop.store(true);
+  {
+    std::lock_guard<std::mutex> lck(sleepmtx);
+  }
+  sleepcv.notify_all();
+  for (ulong idx = 0; idx < threads; ++idx) {
+    workers[idx].join();
+  }
+  delete[] workers;
+  delete[] slots;
+}
+
+/* ************************************************************************** */
+
+// Specific member functions
+
+inline ulong ThreadPool::Threads() const noexcept {
+  return threads;
+}
+
+template <typename FunA, typename FunB>
+void ThreadPool::Invoke(FunA && funa, FunB && funb) {
+  FunTask<FunB> tsk(funb);
+  Push(&tsk);
+  std::exception_ptr err = nullptr;
+  try {
+    funa();
+  } catch (...) {
+    err = std::current_exception();
+  }
+  // tsk lives on this stack: wait for it even when funa has thrown
+  Wait(tsk);
+  if (err != nullptr) {
+    std::rethrow_exception(err);
+  }
+  if (tsk.err != nullptr) {
+    std::rethrow_exception(tsk.err);
+  }
+}
+
+template <typename Fun>
+void ThreadPool::For(ulong lo, ulong hi, ulong grain, Fun && fun) {
+  if (grain == 0) {
+    grain = 1;
+  }
+  if (hi - lo <= grain) {
+    if (lo < hi) {
+      fun(lo, hi);
+    }
+    return;
+  }
+  ulong mid = lo + (hi - lo) / 2;
+  Invoke([&]() { For(lo, mid, grain, fun); }, [&]() { For(mid, hi, grain, fun); });
+}
+
+inline ThreadPool & ThreadPool::Default() {
+  static ThreadPool pool;
+  return pool;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary member functions
+
+inline const ThreadPool *& ThreadPool::CurrentPool() noexcept {
+  thread_local const ThreadPool * pool = nullptr;
+  return pool;
+}
+
+inline ulong & ThreadPool::CurrentIndex() noexcept {
+  thread_local ulong idx = 0;
+  return idx;
+}
+
+// Deque of the calling thread: its own for a worker, the shared one otherwise
+inline ulong ThreadPool::Own() const noexcept {
+  return (CurrentPool() == this) ? CurrentIndex() : threads;
+}
+
+inline void ThreadPool::Push(Task * tsk) {
+  Slot & slt = slots[Own()];
+  {
+    std::lock_guard<std::mutex> lck(slt.mtx);
+    slt.tasks.push_back(tsk);
+  }
+  pending.fetch_add(1);
+  if (sleepers.load() != 0) {
+    {
+      std::lock_guard<std::mutex> lck(sleepmtx);
+    }
+    sleepcv.notify_one();
+  }
+}
+
+// Newest task of deque own, otherwise the oldest one of any other deque
+inline ThreadPool::Task * ThreadPool::Take(ulong own) noexcept {
+  if (pending.load(std::memory_order_relaxed) == 0) {
+    return nullptr;
+  }
+  {
+    Slot & slt = slots[own];
+    std::lock_guard<std::mutex> lck(slt.mtx);
+    if (!slt.tasks.empty()) {
+      Task * tsk = slt.tasks.back();
+      slt.tasks.pop_back();
+      pending.fetch_sub(1);
+      return tsk;
+    }
+  }
+  for (ulong off = 1; off <= threads; ++off) {
+    Slot & slt = slots[(own + off) % (threads + 1)];
+    std::unique_lock<std::mutex> lck(slt.mtx, std::try_to_lock);
+    if (lck.owns_lock() && !slt.tasks.empty()) {
+      Task * tsk = slt.tasks.front();
+      slt.tasks.pop_front();
+      pending.fetch_sub(1);
+      return tsk;
+    }
+  }
+  return nullptr;
+}
+
+inline void ThreadPool::Wait(Task & tsk) {
+  ulong own = Own();
+  while (!tsk.done.load(std::memory_order_acquire)) {
+    Task * oth = Take(own);
+    if (oth != nullptr) {
+      oth->Execute();
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+inline void ThreadPool::Work(ulong idx) {
+  CurrentPool() = this;
+  CurrentIndex() = idx;
+  while (!stop.load()) {
+    Task * tsk = Take(idx);
+    if (tsk != nullptr) {
+      tsk->Execute();
+      continue;
+    }
+    if (pending.load() != 0) {
+      std::this_thread::yield(); // Deques busy: retry
+      continue;
+    }
+    // Nothing to steal: sleep until a push (checked under the lock, see Push)
+    sleepers.fetch_add(1);
+    {
+      std::unique_lock<std::mutex> lck(sleepmtx);
+      sleepcv.wait(lck, [this]() { return (pending.load() != 0) || stop.load(); });
+    }
+    sleepers.fetch_sub(1);
+  }
+}
+
+/* ************************************************************************** */
+
+}
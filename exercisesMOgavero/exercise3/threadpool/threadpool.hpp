@@ -0,0 +1,134 @@
+
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+/* ************************************************************************** */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+/* ************************************************************************** */
+
+#include "../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Fork-join pool with work stealing. Every worker owns a deque of pending
+// tasks: it pushes and pops at the back (the most recent, smallest fork),
+// while idle workers steal from the front (the oldest, largest fork). Threads
+// which are not workers of the pool share one more deque. A thread waiting for
+// a forked task runs pending tasks meanwhile, so nested forks never block.
+
+class ThreadPool {
+
+private:
+
+protected:
+
+  struct Task {
+    std::atomic<bool> done = false;
+    std::exception_ptr err = nullptr;
+
+    virtual ~Task() = default;
+    virtual void Run() = 0;
+
+    inline void Execute() noexcept;
+  };
+
+  template <typename Fun>
+  struct FunTask : Task {
+    Fun & fun;
+
+    FunTask(Fun & f) : fun(f) {}
+    void Run() override { fun(); }
+  };
+
+  struct alignas(64) Slot {
+    std::mutex mtx;
+    std::deque<Task *> tasks;
+  };
+
+  ulong threads = 0;
+  Slot * slots = nullptr; // One per worker, plus the one shared by the other threads
+  std::thread * workers = nullptr;
+
+  std::atomic<ulong> pending = 0;
+  std::atomic<ulong> sleepers = 0;
+  std::atomic<bool> stop = false;
+  std::mutex sleepmtx;
+  std::condition_variable sleepcv;
+
+public:
+
+  // Specific constructor
+  ThreadPool(ulong = std::thread::hardware_concurrency()); // (at least one worker)
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  ThreadPool(const ThreadPool &) = delete;
+
+  // Move constructor
+  ThreadPool(ThreadPool &&) noexcept = delete;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~ThreadPool();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  ThreadPool & operator=(const ThreadPool &) = delete;
+
+  // Move assignment
+  ThreadPool & operator=(ThreadPool &&) noexcept = delete;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline ulong Threads() const noexcept;
+
+  // Runs both functions, possibly in parallel, and returns when both are done
+  // (an exception thrown by either is rethrown here)
+  template <typename FunA, typename FunB>
+  void Invoke(FunA &&, FunB &&);
+
+  // Calls fun(lo, hi) on consecutive subranges of at most grain indices
+  template <typename Fun>
+  void For(ulong, ulong, ulong, Fun &&);
+
+  // Pool shared by the whole program, one worker per hardware thread
+  static ThreadPool & Default();
+
+protected:
+
+  // Auxiliary member functions
+
+  inline ulong Own() const noexcept;
+  void Push(Task *);
+  Task * Take(ulong) noexcept;
+  void Wait(Task &);
+  void Work(ulong);
+
+  static inline const ThreadPool *& CurrentPool() noexcept;
+  static inline ulong & CurrentIndex() noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "threadpool.cpp"
+
+#endif
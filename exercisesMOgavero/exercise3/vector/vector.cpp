@@ -39,6 +39,8 @@ Vector<Data>::Vector(const Vector<Data> & vec) {
   size = vec.size;
   Elements = new Data[size];
   std::copy(vec.Elements, vec.Elements + size, Elements);
+  CountOp(StatOp::Allocation);
+  CountOp(StatOp::Copy, size);
 }
 
 // Move constructor (Vector)
@@ -64,6 +66,8 @@ Vector<Data> & Vector<Data>::operator=(const Vector<Data> & vec) {
   Vector<Data> * tmpvec = new Vector<Data>(vec);
   std::swap(*tmpvec, *this);
   delete tmpvec;
+  CountOp(StatOp::Allocation);
+  CountOp(StatOp::Copy, size);
   return *this;
 }
 
@@ -100,6 +104,19 @@ inline bool Vector<Data>::operator!=(const Vector<Data> & vec) const noexcept {
 
 /* ************************************************************************** */
 
+// Specific member function (Vector) (inherited from Container)
+
+template<typename Data>
+MemStats Vector<Data>::MemoryUsage() const noexcept {
+  MemStats mem;
+  mem.payload = size * sizeof(Data);
+  mem.overhead = sizeof(*this);
+  mem.allocations = (Elements != nullptr) ? 1 : 0;
+  return mem;
+}
+
+/* ************************************************************************** */
+
 // Specific member functions (Vector) (inherited from ClearableContainer)
 
 template<typename Data>
@@ -126,6 +143,9 @@ void Vector<Data>::Resize(const ulong newsize) {
     std::swap(Elements, TmpElements);
     size = newsize;
     delete[] TmpElements;
+    CountOp(StatOp::Resize);
+    CountOp(StatOp::Allocation);
+    CountOp(StatOp::Move, 3 * minsize);
   }
 }
 
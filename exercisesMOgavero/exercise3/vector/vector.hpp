@@ -6,6 +6,7 @@
 
 #include "../container/container.hpp"
 #include "../container/linear.hpp"
+#include "../stats/stats.hpp"
 
 /* ************************************************************************** */
 
@@ -15,7 +16,8 @@ namespace lasd {
 
 template <typename Data>
 class Vector : virtual public ResizableContainer,
-  virtual public LinearContainer<Data> {
+  virtual public LinearContainer<Data>,
+  public StatsPolicy {
 
 private:
 
@@ -68,6 +70,12 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member function (inherited from Container)
+
+  MemStats MemoryUsage() const noexcept override;
+
+  /* ************************************************************************ */
+
   // Specific member function (inherited from ClearableContainer)
 
   void Clear() override;
@@ -91,6 +99,13 @@ public:
   const Data & Back() const override;
   Data & Back() override;
 
+  /* ************************************************************************ */
+
+  // Specific member functions (raw elements: non-virtual, no bounds check)
+
+  inline Data * data() noexcept { return Elements; }
+  inline const Data * data() const noexcept { return Elements; }
+
 };
 
 /* ************************************************************************** */
@@ -0,0 +1,51 @@
+
+#include "hashtable/hashtable.hpp"
+#include "hashtable/htconcurrent.hpp"
+#include "hashtable/htflat.hpp"
+#include "binarytree/binarytree.hpp"
+#include "bst/bst.hpp"
+#include "ops/ops.hpp"
+#include "memory/memory.hpp"
+
+/* ************************************************************************** */
+
+#include <iostream>
+
+using namespace std;
+
+/* ************************************************************************** */
+
+int main(int argc, char * argv[]) {
+  if (!ParseBenchArgs(argc, argv)) {
+    return 1;
+  }
+  cout << "LASD Libraries 2024 (Benchmarks)" << endl;
+
+  if (Suite("Ops")) {
+    BenchOps();
+  }
+
+  if (Suite("HashTable")) {
+    BenchHashTable(200000);
+    BenchConcurrentHashTable(200000);
+    BenchHashTableFlat(200000);
+  }
+
+  if (Suite("BinaryTree")) {
+    BenchBinaryTree(200000);
+    BenchBinaryTreeVec(50000000);
+    BenchBinaryTreeBreadth(5000000);
+    BenchBinaryTreeParallel(4000000);
+  }
+
+  if (Suite("BST")) {
+    BenchBST(200000);
+  }
+
+  if (Suite("Memory")) {
+    BenchMemory();
+  }
+
+  WriteResults();
+  return 0;
+}
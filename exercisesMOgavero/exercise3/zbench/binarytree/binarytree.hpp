@@ -0,0 +1,164 @@
+#ifndef BENCH_BINARYTREE_HPP
+#define BENCH_BINARYTREE_HPP
+
+/* ************************************************************************** */
+
+#include <string>
+
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../binarytree/lnk/binarytreelnk.hpp"
+#include "../../binarytree/vec/binarytreevec.hpp"
+#include "../../binarytree/par/binarytreepar.hpp"
+
+/* ************************************************************************** */
+
+// Full in-order walk, then many short-lived cursors (a few steps each)
+
+template <typename Iterator>
+void BenchInOrderIterator(const std::string & name, const lasd::BinaryTreePar<int> & bt) {
+  ulong num = bt.Size();
+  Report(name + " full walk", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (Iterator itr(bt); !itr.Terminated(); ++itr) {
+      cnt += *itr;
+    }
+    DoNotOptimize(cnt);
+  }));
+  ulong crs = 100000;
+  Report(name + " short cursors (4 steps)", crs, MeasureNs(crs, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < crs; ++i) {
+      Iterator itr(bt);
+      for (ulong k = 0; k < 4; ++k, ++itr) {
+        cnt += *itr;
+      }
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " copies", crs, MeasureNs(crs, [&]() {
+    ulong cnt = 0;
+    Iterator itr(bt);
+    for (ulong i = 0; i < crs; ++i) {
+      Iterator cpy(itr);
+      cnt += *cpy;
+    }
+    DoNotOptimize(cnt);
+  }));
+}
+
+/* ************************************************************************** */
+
+inline void BenchBinaryTree(ulong num) {
+  lasd::Vector<int> vec(num);
+  for (ulong i = 0; i < num; ++i) {
+    vec[i] = static_cast<int>(i);
+  }
+  lasd::BinaryTreePar<int> bt(vec);
+
+  std::cout << std::endl << "Binary trees (in-order iterators)" << std::endl;
+  BenchInOrderIterator<lasd::BTInOrderIterator<int>>("BTInOrderIterator", bt);
+  BenchInOrderIterator<lasd::BTParInOrderIterator<int>>("BTParInOrderIterator", bt);
+  Report("BTParInOrderCursor full walk", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (lasd::BTParInOrderCursor<int> cur(bt); !cur.Terminated(); cur.Next()) {
+      cnt += cur.Element();
+    }
+    DoNotOptimize(cnt);
+  }));
+}
+
+/* ************************************************************************** */
+
+// Index loops on the element array against the generic visits through Root()
+
+inline void BenchBinaryTreeVec(ulong num) {
+  lasd::BinaryTreeVec<int> bt{lasd::Vector<int>(num)};
+  ulong cnt = 0;
+  auto fun = [&cnt](const int & dat) { cnt += dat; };
+
+  std::cout << std::endl << "BinaryTreeVec visits (complete tree)" << std::endl;
+  Report("BinaryTreeVec pre-order (index)", num, MeasureNs(num, [&]() { bt.PreOrderTraverse(fun); }));
+  Report("BinaryTreeVec in-order (index)", num, MeasureNs(num, [&]() { bt.InOrderTraverse(fun); }));
+  Report("BinaryTreeVec post-order (index)", num, MeasureNs(num, [&]() { bt.PostOrderTraverse(fun); }));
+  Report("BinaryTreeVec breadth (index)", num, MeasureNs(num, [&]() { bt.BreadthTraverse(fun); }));
+  Report("BinaryTreeVec node array allocation", num, MeasureNs(num, [&]() { bt.Root(); }));
+  Report("BinaryTreeVec pre-order (nodes)", num, MeasureNs(num, [&]() { bt.lasd::BinaryTree<int>::PreOrderTraverse(fun); }));
+  Report("BinaryTreeVec in-order (nodes)", num, MeasureNs(num, [&]() { bt.lasd::BinaryTree<int>::InOrderTraverse(fun); }));
+  Report("BinaryTreeVec post-order (nodes)", num, MeasureNs(num, [&]() { bt.lasd::BinaryTree<int>::PostOrderTraverse(fun); }));
+  DoNotOptimize(cnt);
+}
+
+/* ************************************************************************** */
+
+// Breadth visits: queue of nodes (BinaryTreeLnk) against the array scan (BinaryTreeVec)
+
+template <typename Tree>
+void BenchBreadthIterator(const std::string & name, const Tree & bt) {
+  ulong num = bt.Size();
+  Report(name + " BTBreadthIterator", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (lasd::BTBreadthIterator<int> itr(bt); !itr.Terminated(); ++itr) {
+      cnt += *itr;
+    }
+    DoNotOptimize(cnt);
+  }));
+}
+
+inline void BenchBinaryTreeBreadth(ulong num) {
+  lasd::Vector<int> vec(num);
+  for (ulong i = 0; i < num; ++i) {
+    vec[i] = static_cast<int>(i);
+  }
+  lasd::BinaryTreeLnk<int> lnk(vec);
+  lasd::BinaryTreeVec<int> bt(vec);
+
+  std::cout << std::endl << "Breadth visits" << std::endl;
+  BenchBreadthIterator("BinaryTreeLnk", lnk);
+  BenchBreadthIterator("BinaryTreeVec", bt);
+  Report("BinaryTreeLnk BreadthMap", num, MeasureNs(num, [&]() { lnk.BreadthMap([](int & dat) { dat += 1; }); }));
+  lasd::MutableBinaryTree<int> & gen = bt;
+  Report("BinaryTreeVec BreadthMap (std::function)", num, MeasureNs(num, [&]() { gen.BreadthMap([](int & dat) { dat += 1; }); }));
+  Report("BinaryTreeVec BreadthMap (inlined)", num, MeasureNs(num, [&]() { bt.BreadthMap([](int & dat) { dat += 1; }); }));
+  DoNotOptimize(bt.Root().Element());
+}
+
+/* ************************************************************************** */
+
+// Fork-join visits: sequential fold and map against pools of growing size
+
+template <typename Tree>
+void BenchParallelTree(const std::string & name, Tree & bt) {
+  ulong num = bt.Size();
+  std::function<long(const long &, const long &)> add = [](const long & a, const long & b) { return a + b; };
+  Report(name + " Fold (sequential)", num, MeasureNs(num, [&]() {
+    DoNotOptimize(bt.template Fold<long>([](const int & dat, const long & acc) { return acc + dat; }, 0));
+  }));
+  Report(name + " Map (sequential)", num, MeasureNs(num, [&]() { bt.Map([](int & dat) { dat ^= 1; }); }));
+  for (ulong threads : {1ul, 8ul, 16ul, 32ul, 64ul}) {
+    lasd::ThreadPool pool(threads);
+    std::string thr = " (" + std::to_string(threads) + " threads)";
+    Report(name + " ParallelFold" + thr, num, MeasureNs(num, [&]() {
+      DoNotOptimize(bt.template ParallelFold<long>([](const int & dat, const long & acc) { return acc + dat; }, add, 0, pool));
+    }));
+    Report(name + " ParallelMap" + thr, num, MeasureNs(num, [&]() { bt.ParallelMap([](int & dat) { dat ^= 1; }, pool); }));
+  }
+}
+
+inline void BenchBinaryTreeParallel(ulong num) {
+  lasd::Vector<int> vec(num);
+  for (ulong i = 0; i < num; ++i) {
+    vec[i] = static_cast<int>(i);
+  }
+  lasd::BinaryTreeLnk<int> lnk(vec);
+  lasd::BinaryTreeVec<int> btv(vec);
+
+  std::cout << std::endl << "Parallel visits (" << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+  BenchParallelTree("BinaryTreeLnk", lnk);
+  BenchParallelTree("BinaryTreeVec", btv);
+}
+
+/* ************************************************************************** */
+
+#endif
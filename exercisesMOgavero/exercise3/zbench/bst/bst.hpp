@@ -0,0 +1,312 @@
+#ifndef BENCH_BST_HPP
+#define BENCH_BST_HPP
+
+/* ************************************************************************** */
+
+#include <string>
+#include <ranges>
+
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../bst/bst.hpp"
+#include "../../bst/avl/bstavl.hpp"
+#include "../../bst/persistent/bstpersistent.hpp"
+
+/* ************************************************************************** */
+
+// Sorted keys: the worst case of the unbalanced tree
+
+template <typename BSTType>
+void BenchBSTSorted(const std::string & name, ulong num) {
+  BSTType bst;
+  Report(name + " Insert (sorted)", num, MeasureNs(num, [&]() {
+    for (ulong i = 0; i < num; ++i) {
+      bst.Insert(static_cast<int>(i));
+    }
+  }));
+  Report(name + " Exists", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < num; ++i) {
+      cnt += bst.Exists(static_cast<int>(i));
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " Min + Successor walk", num, MeasureNs(num, [&]() {
+    int cur = bst.Min();
+    for (ulong i = 1; i < num; ++i) {
+      cur = bst.Successor(cur);
+    }
+    DoNotOptimize(cur);
+  }));
+  Report(name + " MinNRemove", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < num; ++i) {
+      cnt += bst.MinNRemove();
+    }
+    DoNotOptimize(cnt);
+  }));
+}
+
+// Rank by subtree sizes against the in-order scan it replaces
+
+template <typename BSTType>
+void BenchBSTRank(const std::string & name, ulong num) {
+  BSTType bst;
+  for (ulong i = 0; i < num; ++i) {
+    bst.Insert(static_cast<int>((i * 2654435761ul) % (4 * num)));
+  }
+  ulong qry = 1000;
+  Report(name + " Rank", qry, MeasureNs(qry, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < qry; ++i) {
+      cnt += bst.Rank(static_cast<int>((i * 7919) % (4 * num)));
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " Select", qry, MeasureNs(qry, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < qry; ++i) {
+      cnt += bst.Select((i * 7919) % num);
+    }
+    DoNotOptimize(cnt);
+  }));
+  ulong scn = 20;
+  Report(name + " rank by InOrderTraverse", scn, MeasureNs(scn, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < scn; ++i) {
+      int key = static_cast<int>((i * 7919) % (4 * num));
+      bst.InOrderTraverse(
+        [&cnt, key](const int & dat) {
+          cnt += (dat < key);
+        }
+      );
+    }
+    DoNotOptimize(cnt);
+  }));
+}
+
+// Construction from a sorted vector (bulk load) against inserting each key
+
+template <typename BSTType>
+void BenchBSTBulkLoad(const std::string & name, ulong num) {
+  lasd::Vector<int> vec(num);
+  for (ulong i = 0; i < num; ++i) {
+    vec[i] = static_cast<int>(i);
+  }
+  Report(name + " construct from sorted Vector", num, MeasureNs(num, [&]() {
+    BSTType bst(vec);
+    DoNotOptimize(bst.Size());
+  }));
+  Report(name + " Insert one by one (sorted)", num, MeasureNs(num, [&]() {
+    BSTType bst;
+    for (ulong i = 0; i < num; ++i) {
+      bst.Insert(vec[i]);
+    }
+    DoNotOptimize(bst.Size());
+  }));
+  BSTType bst;
+  for (ulong i = 0; i < num; ++i) {
+    bst.Insert(vec[(i * 2654435761ul) % num]);
+  }
+  Report(name + " Rebalance", num, MeasureNs(num, [&]() {
+    bst.Rebalance();
+  }));
+}
+
+// Split/join set algebra against inserting or removing the other set key by key
+
+inline void BenchBSTAVLSetAlgebra(ulong num, ulong oth) {
+  lasd::BSTAVL<int> big, sml;
+  for (ulong i = 0; i < num; ++i) {
+    big.Insert(static_cast<int>((i * 2654435761ul) % (2 * num)));
+  }
+  for (ulong i = 0; i < oth; ++i) {
+    sml.Insert(static_cast<int>((i * 40503ul) % (2 * num)));
+  }
+  std::string sfx = " (n=" + std::to_string(num) + ", m=" + std::to_string(oth) + ")";
+  auto run = [&](const std::string & name, auto fun) {
+    lasd::BSTAVL<int> res(big); // (the copy of the large tree is not timed)
+    Report(name + sfx, oth, MeasureNs(oth, [&]() { fun(res); }));
+    DoNotOptimize(res.Size());
+  };
+  run("Union", [&](lasd::BSTAVL<int> & res) { res.Union(sml); });
+  run("Union parallel", [&](lasd::BSTAVL<int> & res) { res.Union(sml, true); });
+  run("InsertAll", [&](lasd::BSTAVL<int> & res) { res.InsertAll(sml); });
+  run("Intersect", [&](lasd::BSTAVL<int> & res) { res.Intersect(sml); });
+  run("Difference", [&](lasd::BSTAVL<int> & res) { res.Difference(sml); });
+  run("RemoveAll", [&](lasd::BSTAVL<int> & res) { res.RemoveAll(sml); });
+}
+
+// Narrow range scans, pruned against a filtered full in-order scan (ns per scan)
+
+template <typename BSTType>
+void BenchBSTRange(const std::string & name, ulong num) {
+  BSTType bst;
+  for (ulong i = 0; i < num; ++i) {
+    bst.Insert(static_cast<int>((i * 2654435761ul) % (4 * num)));
+  }
+  ulong qry = 1000;
+  int wid = 400;
+  Report(name + " RangeTraverse (width 400)", qry, MeasureNs(qry, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < qry; ++i) {
+      int lo = static_cast<int>((i * 7919) % (4 * num));
+      bst.RangeTraverse(lo, lo + wid, [&cnt](const int & dat) { cnt += dat; });
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " BSTRangeIterator (width 400)", qry, MeasureNs(qry, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < qry; ++i) {
+      int lo = static_cast<int>((i * 7919) % (4 * num));
+      for (lasd::BSTRangeIterator<int> itr(bst, lo, lo + wid); !itr.Terminated(); ++itr) {
+        cnt += *itr;
+      }
+    }
+    DoNotOptimize(cnt);
+  }));
+  ulong scn = 20;
+  Report(name + " filtered InOrderTraverse (width 400)", scn, MeasureNs(scn, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < scn; ++i) {
+      int lo = static_cast<int>((i * 7919) % (4 * num));
+      bst.InOrderTraverse(
+        [&cnt, lo, wid](const int & dat) {
+          cnt += (lo <= dat && dat < lo + wid) ? dat : 0;
+        }
+      );
+    }
+    DoNotOptimize(cnt);
+  }));
+}
+
+// Full in-order scans: STL iterator and BTInOrderIterator against InOrderTraverse
+
+template <typename BSTType>
+void BenchBSTScan(const std::string & name, ulong num) {
+  BSTType bst;
+  for (ulong i = 0; i < num; ++i) {
+    bst.Insert(static_cast<int>((i * 2654435761ul) % (4 * num)));
+  }
+  Report(name + " InOrderTraverse", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    bst.InOrderTraverse([&cnt](const int & dat) { cnt += dat; });
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " BTInOrderIterator", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (lasd::BTInOrderIterator<int> itr(bst); !itr.Terminated(); ++itr) {
+      cnt += *itr;
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " range-for (STL iterator)", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (int dat : bst) {
+      cnt += dat;
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " reverse range-for (STL iterator)", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (int dat : bst | std::views::reverse) {
+      cnt += dat;
+    }
+    DoNotOptimize(cnt);
+  }));
+}
+
+// Snapshots of a persistent tree against deep copies of BSTAVL, and the cost
+// of path copying on updates and lookups
+
+inline void BenchBSTPersistent(ulong num) {
+  lasd::BSTAVL<int> avl;
+  lasd::BSTPersistent<int> pst;
+  Report("BSTAVL<int> Insert (random)", num, MeasureNs(num, [&]() {
+    for (ulong i = 0; i < num; ++i) {
+      avl.Insert(static_cast<int>((i * 2654435761ul) % (4 * num)));
+    }
+  }));
+  Report("BSTPersistent<int> Insert (random)", num, MeasureNs(num, [&]() {
+    for (ulong i = 0; i < num; ++i) {
+      pst.Insert(static_cast<int>((i * 2654435761ul) % (4 * num)));
+    }
+  }));
+  Report("BSTAVL<int> Exists", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < num; ++i) {
+      cnt += avl.Exists(static_cast<int>((i * 7919) % (4 * num)));
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report("BSTPersistent<int> Exists", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < num; ++i) {
+      cnt += pst.Exists(static_cast<int>((i * 7919) % (4 * num)));
+    }
+    DoNotOptimize(cnt);
+  }));
+  ulong cps = 20;
+  Report("BSTAVL<int> copy constructor", cps, MeasureNs(cps, [&]() {
+    for (ulong i = 0; i < cps; ++i) {
+      lasd::BSTAVL<int> cpy(avl);
+      DoNotOptimize(cpy.Size());
+    }
+  }));
+  ulong snp = 1000000;
+  Report("BSTPersistent<int> Snapshot", snp, MeasureNs(snp, [&]() {
+    for (ulong i = 0; i < snp; ++i) {
+      lasd::BSTPersistent<int> cpy = pst.Snapshot();
+      DoNotOptimize(cpy.Size());
+    }
+  }));
+  // Every update followed by a snapshot: the writer pays only the path copies
+  ulong upd = num / 10;
+  Report("BSTPersistent<int> Remove + Insert + Snapshot", upd, MeasureNs(upd, [&]() {
+    for (ulong i = 0; i < upd; ++i) {
+      int key = static_cast<int>((i * 2654435761ul) % (4 * num));
+      pst.Remove(key);
+      pst.Insert(key);
+      lasd::BSTPersistent<int> cpy = pst.Snapshot();
+      DoNotOptimize(cpy.Size());
+    }
+  }));
+}
+
+/* ************************************************************************** */
+
+inline void BenchBST(ulong num) {
+  std::cout << std::endl << "Binary search trees (sorted keys)" << std::endl;
+  BenchBSTSorted<lasd::BST<int>>("BST<int>", num / 10);
+  BenchBSTSorted<lasd::BSTAVL<int>>("BSTAVL<int>", num / 10);
+  BenchBSTSorted<lasd::BSTAVL<int>>("BSTAVL<int>", num);
+
+  std::cout << std::endl << "Binary search trees (bulk load)" << std::endl;
+  BenchBSTBulkLoad<lasd::BST<int>>("BST<int>", num / 10);
+  BenchBSTBulkLoad<lasd::BSTAVL<int>>("BSTAVL<int>", num / 10);
+  BenchBSTBulkLoad<lasd::BSTAVL<int>>("BSTAVL<int>", num);
+
+  std::cout << std::endl << "Binary search trees (order statistics)" << std::endl;
+  BenchBSTRank<lasd::BST<int>>("BST<int>", num);
+  BenchBSTRank<lasd::BSTAVL<int>>("BSTAVL<int>", num);
+
+  std::cout << std::endl << "Binary search trees (set algebra, BSTAVL<int>)" << std::endl;
+  BenchBSTAVLSetAlgebra(num, num);
+  BenchBSTAVLSetAlgebra(num, num / 100);
+
+  std::cout << std::endl << "Binary search trees (range scans)" << std::endl;
+  BenchBSTRange<lasd::BST<int>>("BST<int>", num);
+  BenchBSTRange<lasd::BSTAVL<int>>("BSTAVL<int>", num);
+
+  std::cout << std::endl << "Binary search trees (full in-order scans)" << std::endl;
+  BenchBSTScan<lasd::BST<int>>("BST<int>", num);
+  BenchBSTScan<lasd::BSTAVL<int>>("BSTAVL<int>", num);
+
+  std::cout << std::endl << "Binary search trees (persistent snapshots)" << std::endl;
+  BenchBSTPersistent(num);
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,306 @@
+#ifndef BENCH_HASHTABLE_HPP
+#define BENCH_HASHTABLE_HPP
+
+/* ************************************************************************** */
+
+#include <cmath>
+#include <string>
+#include <string_view>
+#include <random>
+#include <sstream>
+
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
+#include "../../stream/stream.hpp"
+#include "../../hashtable/clsadr/htclsadr.hpp"
+#include "../../hashtable/opnadr/htopnadr.hpp"
+
+/* ************************************************************************** */
+
+// Previous default hash functions and reduction, kept as a baseline
+
+inline ulong LegacyHash(const int & dat) {
+  return (static_cast<ulong>(dat) * static_cast<ulong>(dat));
+}
+
+inline ulong LegacyHash(const double & dat) {
+  long intgpart = floor(dat);
+  long fracpart = pow(2, 24) * (dat - intgpart);
+  return (intgpart * fracpart);
+}
+
+inline ulong LegacyHash(const std::string & dat) {
+  ulong hash = 5381;
+  for (ulong i = 0; i < dat.length(); ++i) {
+    hash = (hash << 5) + dat[i];
+  }
+  return hash;
+}
+
+static const ulong legacyprime = 1000000016531;
+
+inline ulong LegacyReduce(ulong key, ulong a, ulong b, ulong range) {
+  return (((a * key + b) % legacyprime) % range);
+}
+
+inline ulong FastReduce(ulong key, ulong a, ulong b, ulong range) {
+  return lasd::FastRange(a * key + b, range);
+}
+
+/* ************************************************************************** */
+
+// Key sets
+
+inline lasd::Vector<int> BenchKeysInt(ulong num) {
+  lasd::Vector<int> keys(num);
+  for (ulong i = 0; i < num; ++i) {
+    keys[i] = ((i % 2) ? -1 : 1) * static_cast<int>(i / 2);
+  }
+  return keys;
+}
+
+inline lasd::Vector<double> BenchKeysDouble(ulong num) {
+  lasd::Vector<double> keys(num);
+  for (ulong i = 0; i < num; ++i) {
+    keys[i] = static_cast<double>(i);
+  }
+  return keys;
+}
+
+inline lasd::Vector<std::string> BenchKeysString(ulong num) {
+  lasd::Vector<std::string> keys(num);
+  for (ulong i = 0; i < num; ++i) {
+    keys[i] = "session/user/" + std::to_string(i);
+  }
+  return keys;
+}
+
+/* ************************************************************************** */
+
+// Collisions: maximum bucket load and empty buckets over a table of 2n slots
+
+template <typename Data, typename Hash, typename Reduce>
+void BenchCollisions(const std::string & name, const lasd::Vector<Data> & keys, Hash hash, Reduce reduce) {
+  ulong range = 2 * keys.Size();
+  lasd::Vector<ulong> load(range);
+  for (ulong i = 0; i < keys.Size(); ++i) {
+    ++load[reduce(hash(keys[i]), 0x9e3779b97f4a7c15ul, 0x632be59bd9b4e019ul, range)];
+  }
+  ulong maxload = 0;
+  ulong empty = 0;
+  for (ulong i = 0; i < range; ++i) {
+    maxload = (load[i] > maxload) ? load[i] : maxload;
+    empty += (load[i] == 0);
+  }
+  std::cout << "  " << std::left << std::setw(48) << name << " n=" << std::setw(9) << keys.Size()
+            << " max load " << std::setw(8) << maxload << " empty " << std::fixed << std::setprecision(3)
+            << (static_cast<double>(empty) / range) << " (ideal 0.607)" << std::endl;
+}
+
+template <typename Data, typename Hash>
+void BenchHashThroughput(const std::string & name, const lasd::Vector<Data> & keys, Hash hash) {
+  Report(name, keys.Size(), MeasureNs(keys.Size(), [&]() {
+    ulong acc = 0;
+    for (ulong i = 0; i < keys.Size(); ++i) {
+      acc += hash(keys[i]);
+    }
+    DoNotOptimize(acc);
+  }));
+}
+
+template <typename Reduce>
+void BenchReduce(const std::string & name, ulong num, Reduce reduce) {
+  Report(name, num, MeasureNs(num, [&]() {
+    ulong acc = 0;
+    for (ulong i = 0; i < num; ++i) {
+      acc += reduce(lasd::Mix64(i), 0x9e3779b97f4a7c15ul, 0x632be59bd9b4e019ul, 1000003);
+    }
+    DoNotOptimize(acc);
+  }));
+}
+
+template <typename HT, typename Data>
+void BenchHashTableOps(const std::string & name, const lasd::Vector<Data> & keys) {
+  HT ht;
+  Report(name + " Insert", keys.Size(), MeasureNs(keys.Size(), [&]() {
+    for (ulong i = 0; i < keys.Size(); ++i) {
+      ht.Insert(keys[i]);
+    }
+  }));
+  Report(name + " Exists", keys.Size(), MeasureNs(keys.Size(), [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < keys.Size(); ++i) {
+      cnt += ht.Exists(keys[i]);
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " Remove", keys.Size(), MeasureNs(keys.Size(), [&]() {
+    for (ulong i = 0; i < keys.Size(); ++i) {
+      ht.Remove(keys[i]);
+    }
+  }));
+}
+
+// Probing two tables with string_view keys (a join step)
+
+template <typename HT>
+void BenchHashTableLookup(const std::string & name, const lasd::Vector<std::string> & keys) {
+  HT hta, htb;
+  for (ulong i = 0; i < keys.Size(); ++i) {
+    ((i % 2 == 0) ? hta : htb).Insert(keys[i]);
+  }
+  lasd::Vector<std::string_view> views(keys.Size());
+  for (ulong i = 0; i < keys.Size(); ++i) {
+    views[i] = keys[i];
+  }
+  Report(name + " 2x Exists(string(view))", keys.Size(), MeasureNs(keys.Size(), [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < views.Size(); ++i) {
+      cnt += hta.Exists(std::string(views[i])) + htb.Exists(std::string(views[i]));
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " 2x Exists(view)", keys.Size(), MeasureNs(keys.Size(), [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < views.Size(); ++i) {
+      cnt += hta.Exists(views[i]) + htb.Exists(views[i]);
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report(name + " Hash + 2x ExistsHashed", keys.Size(), MeasureNs(keys.Size(), [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < views.Size(); ++i) {
+      ulong hash = lasd::HashTable<std::string>::Hash(views[i]);
+      cnt += hta.ExistsHashed(hash, views[i]) + htb.ExistsHashed(hash, views[i]);
+    }
+    DoNotOptimize(cnt);
+  }));
+}
+
+// Probe loop against the batched, prefetching API (join-like probe stream)
+
+template <typename HT>
+void BenchHashTableBatch(const std::string & name, ulong num) {
+  lasd::Vector<int> keys = BenchKeysInt(num);
+  lasd::Vector<int> probe(num);
+  std::default_random_engine gen(7);
+  std::uniform_int_distribution<ulong> dist(0, 2 * num);
+  for (ulong i = 0; i < num; ++i) {
+    probe[i] = (static_cast<int>(dist(gen)) - static_cast<int>(num));
+  }
+  HT hta;
+  Report(name + " Insert loop", num, MeasureNs(num, [&]() {
+    for (ulong i = 0; i < num; ++i) {
+      hta.Insert(keys[i]);
+    }
+  }));
+  HT htb;
+  Report(name + " InsertBatch", num, MeasureNs(num, [&]() {
+    htb.InsertBatch(keys);
+  }));
+  Report(name + " Exists loop", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < num; ++i) {
+      cnt += hta.Exists(probe[i]);
+    }
+    DoNotOptimize(cnt);
+  }));
+  lasd::Vector<bool> out(num);
+  Report(name + " ExistsBatch", num, MeasureNs(num, [&]() {
+    hta.ExistsBatch(probe, out);
+    DoNotOptimize(out[num - 1]);
+  }));
+}
+
+// Ingest of text and binary records: through an intermediate List (one node
+// per record), against Build straight from the stream
+
+inline void BenchHashTableBuild(ulong num) {
+  std::default_random_engine gen(11);
+  std::uniform_int_distribution<int> dist(0, 1 << 30);
+  std::string txt;
+  std::string raw;
+  for (ulong i = 0; i < num; ++i) {
+    int val = dist(gen);
+    txt += std::to_string(val) + '\n';
+    raw.append(reinterpret_cast<const char *>(&val), sizeof(val));
+  }
+  Report("HashTableOpnAdr<int> text via List", num, MeasureNs(num, [&]() {
+    std::istringstream str(txt);
+    lasd::List<int> lst;
+    int val;
+    while (str >> val) {
+      lst.InsertAtBack(val);
+    }
+    lasd::HashTableOpnAdr<int> ht(lst);
+    DoNotOptimize(ht.Size());
+  }));
+  Report("HashTableOpnAdr<int> text Build (TextSource)", num, MeasureNs(num, [&]() {
+    std::istringstream str(txt);
+    lasd::HashTableOpnAdr<int> ht;
+    ht.Build(lasd::TextSource<int>(str));
+    DoNotOptimize(ht.Size());
+  }));
+  Report("HashTableOpnAdr<int> binary Build (BinarySource)", num, MeasureNs(num, [&]() {
+    std::istringstream str(raw);
+    lasd::HashTableOpnAdr<int> ht;
+    ht.Build(lasd::BinarySource<int>(str));
+    DoNotOptimize(ht.Size());
+  }));
+}
+
+/* ************************************************************************** */
+
+inline void BenchHashTable(ulong num) {
+  lasd::Vector<int> keysint = BenchKeysInt(num);
+  lasd::Vector<double> keysdbl = BenchKeysDouble(num);
+  lasd::Vector<std::string> keysstr = BenchKeysString(num);
+
+  lasd::Hashable<int> hint;
+  lasd::Hashable<double> hdbl;
+  lasd::Hashable<std::string> hstr;
+  auto oldint = [](const int & dat) { return LegacyHash(dat); };
+  auto olddbl = [](const double & dat) { return LegacyHash(dat); };
+  auto oldstr = [](const std::string & dat) { return LegacyHash(dat); };
+
+  std::cout << std::endl << "Hash collisions" << std::endl;
+  BenchCollisions("int (+/-i) legacy", keysint, oldint, LegacyReduce);
+  BenchCollisions("int (+/-i) mix64 + fast range", keysint, hint, FastReduce);
+  BenchCollisions("double (integral) legacy", keysdbl, olddbl, LegacyReduce);
+  BenchCollisions("double (integral) bitcast + fast range", keysdbl, hdbl, FastReduce);
+  BenchCollisions("string (common prefix) legacy", keysstr, oldstr, LegacyReduce);
+  BenchCollisions("string (common prefix) wyhash + fast range", keysstr, hstr, FastReduce);
+
+  std::cout << std::endl << "Hash throughput" << std::endl;
+  BenchHashThroughput("int legacy", keysint, oldint);
+  BenchHashThroughput("int mix64", keysint, hint);
+  BenchHashThroughput("double legacy", keysdbl, olddbl);
+  BenchHashThroughput("double bitcast", keysdbl, hdbl);
+  BenchHashThroughput("string legacy", keysstr, oldstr);
+  BenchHashThroughput("string wyhash", keysstr, hstr);
+  BenchReduce("reduce double modulo", num, LegacyReduce);
+  BenchReduce("reduce fast range", num, FastReduce);
+
+  std::cout << std::endl << "Hash table operations" << std::endl;
+  BenchHashTableOps<lasd::HashTableOpnAdr<int>>("HashTableOpnAdr<int>", keysint);
+  BenchHashTableOps<lasd::HashTableClsAdr<int>>("HashTableClsAdr<int>", keysint);
+  BenchHashTableOps<lasd::HashTableOpnAdr<std::string>>("HashTableOpnAdr<string>", keysstr);
+  BenchHashTableOps<lasd::HashTableClsAdr<std::string>>("HashTableClsAdr<string>", keysstr);
+
+  std::cout << std::endl << "Hash table batch operations (" << 20 * num << " int keys)" << std::endl;
+  BenchHashTableBatch<lasd::HashTableOpnAdr<int>>("HashTableOpnAdr<int>", 20 * num);
+
+  // (the List destructor is recursive: kept below 10^5 nodes)
+  std::cout << std::endl << "Hash table streaming construction (ns per record)" << std::endl;
+  BenchHashTableBuild((num < 100000) ? num : 100000);
+
+  std::cout << std::endl << "Hash table lookup (string_view keys, two tables)" << std::endl;
+  BenchHashTableLookup<lasd::HashTableOpnAdr<std::string>>("HashTableOpnAdr<string>", keysstr);
+  BenchHashTableLookup<lasd::HashTableClsAdr<std::string>>("HashTableClsAdr<string>", keysstr);
+}
+
+/* ************************************************************************** */
+
+#endif
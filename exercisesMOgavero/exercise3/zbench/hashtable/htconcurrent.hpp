@@ -0,0 +1,115 @@
+#ifndef BENCH_HTCONCURRENT_HPP
+#define BENCH_HTCONCURRENT_HPP
+
+/* ************************************************************************** */
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "../util/bench_utils.hpp"
+
+#include "../../hashtable/opnadr/htopnadr.hpp"
+#include "../../hashtable/concurrent/htconcurrent.hpp"
+
+/* ************************************************************************** */
+
+// Baseline: one mutex around the sequential open-addressing table
+
+template <typename Data>
+class LockedHashTable {
+
+private:
+
+  lasd::HashTableOpnAdr<Data> ht;
+  mutable std::mutex mtx;
+
+public:
+
+  bool Insert(const Data & dat) {
+    std::lock_guard<std::mutex> grd(mtx);
+    return ht.Insert(dat);
+  }
+
+  bool Remove(const Data & dat) {
+    std::lock_guard<std::mutex> grd(mtx);
+    return ht.Remove(dat);
+  }
+
+  bool Exists(const Data & dat) const {
+    std::lock_guard<std::mutex> grd(mtx);
+    return ht.Exists(dat);
+  }
+
+};
+
+/* ************************************************************************** */
+
+// Runs ops operations per thread (rdpct% Exists, the rest Insert/Remove)
+// on keys in [0, range), and returns the wall-clock nanoseconds per operation
+
+template <typename HT>
+double BenchMix(HT & ht, ulong nthr, ulong ops, ulong rdpct, ulong range) {
+  std::atomic<bool> go = false;
+  std::vector<std::thread> thrs;
+  for (ulong t = 0; t < nthr; ++t) {
+    thrs.emplace_back([&ht, &go, t, ops, rdpct, range]() {
+      ulong rng = 0x9e3779b97f4a7c15ul * (t + 1);
+      ulong cnt = 0;
+      while (!go.load()) {
+        std::this_thread::yield();
+      }
+      for (ulong i = 0; i < ops; ++i) {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        int key = static_cast<int>((rng >> 8) % range);
+        if ((rng & 127) % 100 < rdpct) {
+          cnt += ht.Exists(key);
+        } else if (rng & 128) {
+          cnt += ht.Insert(key);
+        } else {
+          cnt += ht.Remove(key);
+        }
+      }
+      DoNotOptimize(cnt);
+    });
+  }
+  return MeasureNs(nthr * ops, [&]() {
+    go.store(true);
+    for (std::thread & thr : thrs) {
+      thr.join();
+    }
+  });
+}
+
+template <typename HT>
+void BenchConcurrentMix(const std::string & name, ulong nthr, ulong ops, ulong rdpct, ulong range) {
+  HT ht;
+  for (ulong i = 0; i < range; i += 2) {
+    ht.Insert(static_cast<int>(i));
+  }
+  Report(name + " " + std::to_string(rdpct) + "/" + std::to_string(100 - rdpct) + " x" + std::to_string(nthr),
+         nthr * ops, BenchMix(ht, nthr, ops, rdpct, range));
+}
+
+/* ************************************************************************** */
+
+inline void BenchConcurrentHashTable(ulong ops) {
+  ulong maxthr = std::thread::hardware_concurrency();
+  maxthr = (maxthr < 4) ? 4 : maxthr;
+  std::cout << std::endl << "Concurrent hash table (read/write mix, hardware threads: "
+            << std::thread::hardware_concurrency() << ")" << std::endl;
+  for (ulong rdpct : {90ul, 50ul}) {
+    for (ulong nthr = 1; nthr <= maxthr; nthr *= 2) {
+      BenchConcurrentMix<LockedHashTable<int>>("mutex + HashTableOpnAdr", nthr, ops, rdpct, 1 << 16);
+      BenchConcurrentMix<lasd::ConcurrentHashTable<int>>("ConcurrentHashTable", nthr, ops, rdpct, 1 << 16);
+    }
+  }
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef BENCH_HTFLAT_HPP
+#define BENCH_HTFLAT_HPP
+
+/* ************************************************************************** */
+
+#include <string>
+
+#include "../util/bench_utils.hpp"
+#include "hashtable.hpp"
+
+#include "../../hashtable/opnadr/htopnadr.hpp"
+#include "../../hashtable/flat/htflat.hpp"
+
+/* ************************************************************************** */
+
+// The same operations through DictionaryContainer (virtual calls, size read
+// through the virtual base) and on the final HashTableFlat; the last rows
+// pay the virtual call again through DictionaryAdapter. The two tables probe
+// alike, but HashTableFlat finds a free slot in the same pass as the
+// duplicate check and counts tombstones in its load factor.
+
+template <typename Data>
+void BenchHashTableFlatType(const std::string & type, const lasd::Vector<Data> & keys) {
+  ulong num = keys.Size();
+  lasd::HashTableOpnAdr<Data> ht;
+  lasd::HashTableFlat<Data> fht;
+  lasd::DictionaryContainer<Data> & dic = ht;
+  Report("HashTableOpnAdr<" + type + "> Insert (DictionaryContainer&)", num, MeasureNs(num, [&]() {
+    for (ulong i = 0; i < num; ++i) {
+      dic.Insert(keys[i]);
+    }
+  }));
+  Report("HashTableFlat<" + type + "> Insert", num, MeasureNs(num, [&]() {
+    for (ulong i = 0; i < num; ++i) {
+      fht.Insert(keys[i]);
+    }
+  }));
+  Report("HashTableOpnAdr<" + type + "> Exists (DictionaryContainer&)", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < num; ++i) {
+      cnt += dic.Exists(keys[i]);
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report("HashTableFlat<" + type + "> Exists", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < num; ++i) {
+      cnt += fht.Exists(keys[i]);
+    }
+    DoNotOptimize(cnt);
+  }));
+  lasd::DictionaryAdapter ad(fht);
+  lasd::DictionaryContainer<Data> & fdic = ad;
+  Report("HashTableFlat<" + type + "> Exists (DictionaryAdapter)", num, MeasureNs(num, [&]() {
+    ulong cnt = 0;
+    for (ulong i = 0; i < num; ++i) {
+      cnt += fdic.Exists(keys[i]);
+    }
+    DoNotOptimize(cnt);
+  }));
+  Report("HashTableOpnAdr<" + type + "> Remove (DictionaryContainer&)", num, MeasureNs(num, [&]() {
+    for (ulong i = 0; i < num; ++i) {
+      dic.Remove(keys[i]);
+    }
+  }));
+  Report("HashTableFlat<" + type + "> Remove", num, MeasureNs(num, [&]() {
+    for (ulong i = 0; i < num; ++i) {
+      fht.Remove(keys[i]);
+    }
+  }));
+}
+
+inline void BenchHashTableFlat(ulong num) {
+  std::cout << std::endl << "Polymorphic vs flat (final, no virtual bases) hash table" << std::endl;
+  BenchHashTableFlatType<int>("int", BenchKeysInt(num));
+  BenchHashTableFlatType<std::string>("string", BenchKeysString(num));
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef BENCH_MEMORY_HPP
+#define BENCH_MEMORY_HPP
+
+/* ************************************************************************** */
+
+#include <string>
+
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
+#include "../../stack/vec/stackvec.hpp"
+#include "../../stack/lst/stacklst.hpp"
+#include "../../queue/vec/queuevec.hpp"
+#include "../../queue/lst/queuelst.hpp"
+#include "../../binarytree/vec/binarytreevec.hpp"
+#include "../../binarytree/lnk/binarytreelnk.hpp"
+#include "../../bst/bst.hpp"
+#include "../../bst/avl/bstavl.hpp"
+#include "../../bst/persistent/bstpersistent.hpp"
+#include "../../hashtable/clsadr/htclsadr.hpp"
+#include "../../hashtable/opnadr/htopnadr.hpp"
+#include "../../hashtable/concurrent/htconcurrent.hpp"
+
+/* ************************************************************************** */
+
+// Footprint (MemoryUsage) per element at several sizes: the total and its
+// parts, plus the number of allocations (each one also costs a malloc
+// header, which is not included)
+
+inline void ReportMemory(const std::string & name, ulong num, const lasd::MemStats & mem) {
+  double div = (num != 0) ? static_cast<double>(num) : 1.0;
+  std::cout << "  " << std::left << std::setw(14) << name << " n=" << std::setw(7) << num << std::right
+            << std::fixed << std::setprecision(1) << std::setw(9) << mem.Total() / div
+            << " B/elem (payload " << std::setw(6) << mem.payload / div << " overhead " << std::setw(7)
+            << mem.overhead / div << " slack " << std::setw(6) << mem.slack / div << ") allocs "
+            << mem.allocations << std::endl;
+}
+
+template <typename Data, typename MakeKey>
+void BenchMemoryType(const std::string & type, MakeKey key) {
+  std::cout << "  Data = " << type << " (sizeof " << sizeof(Data) << ")" << std::endl;
+  for (ulong num : {10ul, 1000ul, 100000ul}) {
+    // Distinct keys in scattered order (num and 7919 are coprime)
+    lasd::Vector<Data> keys(num);
+    for (ulong i = 0; i < num; ++i) {
+      keys[i] = key((i * 7919) % num);
+    }
+    ReportMemory("Vector", num, keys.MemoryUsage());
+    ReportMemory("List", num, lasd::List<Data>(keys).MemoryUsage());
+
+    lasd::StackVec<Data> stkvec;
+    lasd::StackLst<Data> stklst;
+    lasd::QueueVec<Data> quevec;
+    lasd::QueueLst<Data> quelst;
+    for (ulong i = 0; i < num; ++i) {
+      stkvec.Push(keys[i]);
+      stklst.Push(keys[i]);
+      quevec.Enqueue(keys[i]);
+      quelst.Enqueue(keys[i]);
+    }
+    ReportMemory("StackVec", num, stkvec.MemoryUsage());
+    ReportMemory("StackLst", num, stklst.MemoryUsage());
+    ReportMemory("QueueVec", num, quevec.MemoryUsage());
+    ReportMemory("QueueLst", num, quelst.MemoryUsage());
+
+    lasd::BinaryTreeVec<Data> btv(keys);
+    btv.Root(); // (allocates the node array)
+    ReportMemory("BinaryTreeVec", num, btv.MemoryUsage());
+    ReportMemory("BinaryTreeLnk", num, lasd::BinaryTreeLnk<Data>(keys).MemoryUsage());
+    ReportMemory("BST", num, lasd::BST<Data>(keys).MemoryUsage());
+    ReportMemory("BSTAVL", num, lasd::BSTAVL<Data>(keys).MemoryUsage());
+    ReportMemory("BSTPersistent", num, lasd::BSTPersistent<Data>(keys).MemoryUsage());
+
+    ReportMemory("HTClsAdr", num, lasd::HashTableClsAdr<Data>(keys).MemoryUsage());
+    ReportMemory("HTOpnAdr", num, lasd::HashTableOpnAdr<Data>(keys).MemoryUsage());
+    ReportMemory("HTConcurrent", num, lasd::ConcurrentHashTable<Data>(keys).MemoryUsage());
+  }
+}
+
+inline void BenchMemory() {
+  BenchMemoryType<int>("int", [](ulong i) { return static_cast<int>(i); });
+  BenchMemoryType<std::string>("string", [](ulong i) { return "key_" + std::to_string(1000000000ul + i); });
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef BENCH_OPS_HPP
+#define BENCH_OPS_HPP
+
+/* ************************************************************************** */
+
+#include <string>
+#include <random>
+
+#include "../util/bench_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../hashtable/clsadr/htclsadr.hpp"
+#include "../../hashtable/opnadr/htopnadr.hpp"
+#include "../../bst/bst.hpp"
+#include "../../bst/avl/bstavl.hpp"
+#include "../../bst/persistent/bstpersistent.hpp"
+
+/* ************************************************************************** */
+
+// Micro-benchmarks of every dictionary operation, by size and type: each
+// repetition starts from a fresh copy of a container holding num keys.
+
+// Keys of a benchmark: even keys are present, odd ones absent
+
+template <typename Data>
+struct OpsKeys {
+  lasd::Vector<Data> present; // Even keys, in random order
+  lasd::Vector<Data> absent; // Odd keys, in random order
+  lasd::Vector<Data> probe; // Alternating present and absent keys
+};
+
+template <typename Data, typename MakeKey>
+OpsKeys<Data> MakeOpsKeys(ulong num, MakeKey key) {
+  OpsKeys<Data> keys{lasd::Vector<Data>(num), lasd::Vector<Data>(num), lasd::Vector<Data>(num)};
+  std::vector<ulong> perm(num);
+  for (ulong i = 0; i < num; ++i) {
+    perm[i] = i;
+  }
+  std::mt19937_64 gen(num);
+  for (ulong i = num; i > 1; --i) {
+    std::swap(perm[i - 1], perm[gen() % i]);
+  }
+  for (ulong i = 0; i < num; ++i) {
+    keys.present[i] = key(2 * perm[i]);
+    keys.absent[i] = key(2 * perm[i] + 1);
+    keys.probe[i] = (i % 2 == 0) ? keys.present[i] : keys.absent[i];
+  }
+  return keys;
+}
+
+/* ************************************************************************** */
+
+// Every repetition rebuilds the table from the keys (copying it here makes
+// GCC 12 crash on the copy constructor of HashTableOpnAdr)
+
+template <typename HTType, typename Data>
+void BenchOpsHashTable(const std::string & name, const std::string & type, ulong num, const OpsKeys<Data> & keys) {
+  const HTType base(keys.present);
+  Bench(name + " Insert", type, num, num, [&]() { return HTType(keys.present); },
+    [&](HTType & ht, ulong i) { ht.Insert(keys.absent[i]); });
+  Bench(name + " Exists", type, num, num, []() { return 0; },
+    [&](int &, ulong i) { DoNotOptimize(base.Exists(keys.probe[i])); });
+  Bench(name + " Remove", type, num, num, [&]() { return HTType(keys.present); },
+    [&](HTType & ht, ulong i) { ht.Remove(keys.present[i]); });
+}
+
+template <typename BSTType, typename Data>
+void BenchOpsBST(const std::string & name, const std::string & type, ulong num, const OpsKeys<Data> & keys) {
+  const BSTType base(keys.present);
+  Bench(name + " Insert", type, num, num, [&]() { return BSTType(base); },
+    [&](BSTType & bst, ulong i) { bst.Insert(keys.absent[i]); });
+  Bench(name + " Exists", type, num, num, []() { return 0; },
+    [&](int &, ulong i) { DoNotOptimize(base.Exists(keys.probe[i])); });
+  Bench(name + " Remove", type, num, num, [&]() { return BSTType(base); },
+    [&](BSTType & bst, ulong i) { bst.Remove(keys.present[i]); });
+  Bench(name + " Min", type, num, num, []() { return 0; },
+    [&](int &, ulong) { DoNotOptimize(base.Min()); });
+  // Absent keys, so that each one has both neighbours (but at the ends)
+  Bench(name + " Successor", type, num, num - 1, []() { return 0; },
+    [&](int &, ulong i) { DoNotOptimize(base.Successor(keys.absent[i] < base.Max() ? keys.absent[i] : base.Min())); });
+  Bench(name + " Predecessor", type, num, num - 1, []() { return 0; },
+    [&](int &, ulong i) { DoNotOptimize(base.Predecessor(base.Min() < keys.absent[i] ? keys.absent[i] : base.Max())); });
+  Bench(name + " RemoveMin", type, num, num, [&]() { return BSTType(base); },
+    [](BSTType & bst, ulong) { bst.RemoveMin(); });
+}
+
+// The persistent tree has neither Successor nor RemoveMin
+
+template <typename Data>
+void BenchOpsBSTPersistent(const std::string & type, ulong num, const OpsKeys<Data> & keys) {
+  using BSTType = lasd::BSTPersistent<Data>;
+  const BSTType base(keys.present);
+  Bench("BSTPersistent Insert", type, num, num, [&]() { return BSTType(base); },
+    [&](BSTType & bst, ulong i) { bst.Insert(keys.absent[i]); });
+  Bench("BSTPersistent Exists", type, num, num, []() { return 0; },
+    [&](int &, ulong i) { DoNotOptimize(base.Exists(keys.probe[i])); });
+  Bench("BSTPersistent Remove", type, num, num, [&]() { return BSTType(base); },
+    [&](BSTType & bst, ulong i) { bst.Remove(keys.present[i]); });
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename MakeKey>
+void BenchOpsType(const std::string & type, MakeKey key) {
+  for (ulong num : {1000ul, 100000ul}) {
+    OpsKeys<Data> keys = MakeOpsKeys<Data>(num, key);
+    BenchOpsHashTable<lasd::HashTableOpnAdr<Data>>("HashTableOpnAdr", type, num, keys);
+    BenchOpsHashTable<lasd::HashTableClsAdr<Data>>("HashTableClsAdr", type, num, keys);
+    BenchOpsBST<lasd::BST<Data>>("BST", type, num, keys);
+    BenchOpsBST<lasd::BSTAVL<Data>>("BSTAVL", type, num, keys);
+    BenchOpsBSTPersistent(type, num, keys);
+  }
+}
+
+inline void BenchOps() {
+  BenchOpsType<int>("int", [](ulong i) { return static_cast<int>(i); });
+  BenchOpsType<std::string>("string", [](ulong i) { return "key_" + std::to_string(1000000000ul + i); });
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef BENCH_PERF_COUNTERS_HPP
+#define BENCH_PERF_COUNTERS_HPP
+
+/* ************************************************************************** */
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <iostream>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/* ************************************************************************** */
+
+// Hardware performance counters (Linux perf_event_open), read around a
+// measured piece of code. Only user-space events are counted, for the calling
+// thread and the threads it starts afterwards. Each event is opened on its
+// own, so the harness keeps whatever subset the machine provides; when none
+// can be opened (no PMU, perf_event_paranoid, a container without
+// CAP_PERFMON, another OS) the benchmarks fall back to timing only.
+
+enum PerfEvent : ulong { Cycles, Instructions, L1DMisses, LLCMisses, BranchMisses, DTLBMisses, PerfEvents };
+
+inline const char * PerfEventName(ulong evt) {
+  static const char * const names[PerfEvents] = {"cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses", "dtlb_misses"};
+  return names[evt];
+}
+
+// Counts per operation (valid[evt] is false for the events not available)
+
+struct PerfCounts {
+  double value[PerfEvents] = {};
+  bool valid[PerfEvents] = {};
+
+  bool Any() const noexcept {
+    for (ulong evt = 0; evt < PerfEvents; ++evt) {
+      if (valid[evt]) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+/* ************************************************************************** */
+
+class PerfCounters {
+
+private:
+
+  int fds[PerfEvents];
+  std::string error; // Why no counter is available
+
+  PerfCounters() {
+    for (int & fd : fds) {
+      fd = -1;
+    }
+#if defined(__linux__)
+    const std::pair<ulong, ulong> events[PerfEvents] = {
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+      {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    };
+    int err = 0;
+    for (ulong evt = 0; evt < PerfEvents; ++evt) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = events[evt].first;
+      attr.config = events[evt].second;
+      attr.disabled = 1;
+      attr.inherit = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      // Scaled by enabled/running time when the PMU is multiplexed
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      fds[evt] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+      if (fds[evt] < 0 && err == 0) {
+        err = errno;
+      }
+    }
+    if (!Available()) {
+      error = std::string("perf_event_open: ") + std::strerror(err);
+      if (err == EACCES || err == EPERM) {
+        error += ", see /proc/sys/kernel/perf_event_paranoid";
+      }
+    }
+#else
+    error = "perf_event_open is Linux only";
+#endif
+  }
+
+public:
+
+  ~PerfCounters() {
+#if defined(__linux__)
+    for (int fd : fds) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+#endif
+  }
+
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters & operator=(const PerfCounters &) = delete;
+
+  // Opened on first use; the fallback is reported once, on std::cerr
+  static PerfCounters & Instance() {
+    static PerfCounters pfc;
+    static bool told = false;
+    if (!told && !pfc.Available()) {
+      std::cerr << "Hardware counters unavailable (" << pfc.Error() << "): timing only" << std::endl;
+      told = true;
+    }
+    return pfc;
+  }
+
+  bool Available() const noexcept {
+    for (int fd : fds) {
+      if (fd >= 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const std::string & Error() const noexcept {
+    return error;
+  }
+
+  void Start() noexcept {
+#if defined(__linux__)
+    for (int fd : fds) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+#endif
+  }
+
+  // Stops counting and returns the counts divided by ops
+  PerfCounts Stop(ulong ops) noexcept {
+    PerfCounts cnt;
+#if defined(__linux__)
+    for (int fd : fds) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      }
+    }
+    double div = (ops != 0) ? static_cast<double>(ops) : 1.0;
+    for (ulong evt = 0; evt < PerfEvents; ++evt) {
+      std::uint64_t buf[3]; // value, time enabled, time running
+      if (fds[evt] >= 0 && read(fds[evt], buf, sizeof(buf)) == sizeof(buf) && buf[2] != 0) {
+        cnt.value[evt] = static_cast<double>(buf[0]) * (static_cast<double>(buf[1]) / buf[2]) / div;
+        cnt.valid[evt] = true;
+      }
+    }
+#endif
+    return cnt;
+  }
+
+};
+
+/* ************************************************************************** */
+
+#endif
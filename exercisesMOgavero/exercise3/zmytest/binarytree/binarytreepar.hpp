@@ -0,0 +1,131 @@
+#ifndef MYTEST_BINARYTREEPAR_HPP
+#define MYTEST_BINARYTREEPAR_HPP
+
+/* ************************************************************************** */
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../binarytree/par/binarytreepar.hpp"
+
+/* ************************************************************************** */
+
+// The stackless iterator must visit the same keys as the stack-based one
+
+template <typename Data>
+void CheckParInOrder(const lasd::BinaryTreePar<Data> & bt) {
+  lasd::BTInOrderIterator<Data> exp(bt);
+  lasd::BTParInOrderIterator<Data> itr(bt);
+  ulong cnt = 0;
+  for (; !exp.Terminated(); ++exp, ++itr) {
+    ASSERT_FALSE(itr.Terminated());
+    ASSERT_EQ(*itr, *exp);
+    ++cnt;
+  }
+  ASSERT_TRUE(itr.Terminated());
+  ASSERT_EQ(cnt, bt.Size());
+  ASSERT_THROW(*itr, std::out_of_range);
+  ASSERT_THROW(++itr, std::out_of_range);
+}
+
+template <typename Data>
+void TestBinaryTreeParSize(ulong num) {
+  lasd::Vector<Data> vec(num);
+  for (ulong i = 0; i < num; ++i) {
+    vec[i] = MakeValue<Data>(static_cast<int>(i));
+  }
+  lasd::BinaryTreePar<Data> bt(vec);
+  ASSERT_EQ(bt.Size(), num);
+  CheckParInOrder(bt);
+
+  // Same shape as the plain linked tree built from the same container
+  lasd::BinaryTreeLnk<Data> lnk(vec);
+  const lasd::BinaryTree<Data> & btref = bt;
+  ASSERT_TRUE(btref == static_cast<const lasd::BinaryTree<Data> &>(lnk));
+
+  lasd::BinaryTreePar<Data> cpy(bt);
+  ASSERT_TRUE(cpy == bt);
+  CheckParInOrder(cpy);
+  cpy.Clear();
+  CheckParInOrder(cpy);
+  cpy = bt;
+  CheckParInOrder(cpy);
+
+  lasd::BinaryTreePar<Data> mov(std::move(cpy));
+  ASSERT_TRUE(mov == bt);
+  CheckParInOrder(mov);
+  CheckParInOrder(cpy);
+
+  lasd::BinaryTreePar<Data> fromvec(std::move(vec));
+  ASSERT_TRUE(fromvec == bt);
+  CheckParInOrder(fromvec);
+}
+
+inline void TestBinaryTreeParIterator() {
+  lasd::Vector<int> vec(7);
+  for (ulong i = 0; i < 7; ++i) {
+    vec[i] = static_cast<int>(i);
+  }
+  lasd::BinaryTreePar<int> bt(vec);
+
+  // Breadth-built tree: in order is 3 1 4 0 5 2 6
+  lasd::BTParInOrderIterator<int> itr(bt);
+  ASSERT_EQ(*itr, 3);
+  ++itr;
+  lasd::BTParInOrderIterator<int> cpy(itr);
+  ++itr;
+  ++itr;
+  ASSERT_EQ(*itr, 0);
+  ASSERT_EQ(*cpy, 1);
+  ASSERT_TRUE(itr != cpy);
+  ++cpy;
+  ++cpy;
+  ASSERT_TRUE(itr == cpy);
+  itr.Reset();
+  ASSERT_EQ(*itr, 3);
+
+  bt.Map([](int & dat) { dat *= 10; });
+  itr.Reset();
+  ASSERT_EQ(*itr, 30);
+
+  // The bare cursor behind the iterator: two pointers, copied as bytes
+  static_assert(std::is_trivially_copyable_v<lasd::BTParInOrderCursor<int>>);
+  static_assert(sizeof(lasd::BTParInOrderCursor<int>) == 2 * sizeof(void *));
+  itr.Reset();
+  lasd::BTParInOrderCursor<int> cur(bt);
+  ASSERT_TRUE(cur == itr.GetCursor());
+  int exp[] = {30, 10, 40, 0, 50, 20, 60};
+  for (int val : exp) {
+    ASSERT_FALSE(cur.Terminated());
+    ASSERT_EQ(cur.Element(), val);
+    lasd::BTParInOrderCursor<int> snap;
+    std::memcpy(&snap, &cur, sizeof(cur));
+    cur.Next();
+    ASSERT_TRUE(snap != cur);
+    ASSERT_EQ(snap.Element(), val);
+  }
+  ASSERT_TRUE(cur.Terminated());
+
+  lasd::BinaryTreePar<int> emp;
+  lasd::BTParInOrderIterator<int> end(emp);
+  ASSERT_TRUE(end.Terminated());
+  end.Reset();
+  ASSERT_TRUE(end.Terminated());
+}
+
+inline void TestBinaryTreePar() {
+  for (ulong num : {0ul, 1ul, 2ul, 3ul, 10ul, 100ul, 1023ul}) {
+    TestBinaryTreeParSize<int>(num);
+    TestBinaryTreeParSize<std::string>(num);
+  }
+  TestBinaryTreeParIterator();
+  std::cout << "All BinaryTreePar tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
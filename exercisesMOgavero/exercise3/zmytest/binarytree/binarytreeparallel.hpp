@@ -0,0 +1,89 @@
+#ifndef MYTEST_BINARYTREEPARALLEL_HPP
+#define MYTEST_BINARYTREEPARALLEL_HPP
+
+/* ************************************************************************** */
+
+#include <atomic>
+#include <string>
+
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../binarytree/lnk/binarytreelnk.hpp"
+#include "../../binarytree/vec/binarytreevec.hpp"
+#include "../../bst/bst.hpp"
+
+/* ************************************************************************** */
+
+// Parallel visits must reach every element once, whatever the grain
+
+template <typename Tree>
+void CheckParallelVisits(Tree & bt, lasd::ThreadPool & pool, ulong grain) {
+  ulong num = bt.Size();
+  long exp = 0;
+  bt.Traverse([&exp](const int & dat) { exp += dat; });
+
+  std::atomic<long> sum = 0;
+  std::atomic<ulong> cnt = 0;
+  bt.ParallelTraverse([&](const int & dat) { sum.fetch_add(dat); cnt.fetch_add(1); }, pool, grain);
+  ASSERT_EQ(sum.load(), exp);
+  ASSERT_EQ(cnt.load(), num);
+
+  std::function<long(const long &, const long &)> add = [](const long & a, const long & b) { return a + b; };
+  ASSERT_EQ(bt.template ParallelFold<long>([](const int & dat, const long & acc) { return acc + dat; }, add, 0, pool, grain), exp);
+  std::function<ulong(const ulong &, const ulong &)> cntjoin = [](const ulong & a, const ulong & b) { return a + b; };
+  ASSERT_EQ(bt.template ParallelFold<ulong>([](const int &, const ulong & acc) { return acc + 1; }, cntjoin, 0, pool, grain), num);
+}
+
+inline void TestBinaryTreeParallelSize(ulong num, lasd::ThreadPool & pool) {
+  lasd::Vector<int> vec(num);
+  for (ulong i = 0; i < num; ++i) {
+    vec[i] = static_cast<int>((i * 7919) % 100003);
+  }
+  lasd::BinaryTreeLnk<int> lnk(vec);
+  lasd::BinaryTreeVec<int> btv(vec);
+  lasd::BST<int> bst(vec);
+
+  for (ulong grain : {1ul, 16ul, lasd::BinaryTree<int>::pargrain}) {
+    CheckParallelVisits(lnk, pool, grain);
+    CheckParallelVisits(btv, pool, grain);
+    CheckParallelVisits(bst, pool, grain);
+  }
+
+  // Order-insensitive maps: same result as the sequential one
+  lasd::BinaryTreeLnk<int> explnk(lnk);
+  explnk.Map([](int & dat) { dat = 2 * dat + 1; });
+  lnk.ParallelMap([](int & dat) { dat = 2 * dat + 1; }, pool, 8);
+  ASSERT_TRUE(lnk == explnk);
+  lasd::BinaryTreeVec<int> expbtv(btv);
+  expbtv.Map([](int & dat) { dat = 2 * dat + 1; });
+  btv.ParallelMap([](int & dat) { dat = 2 * dat + 1; }, pool, 8);
+  ASSERT_TRUE(btv == expbtv);
+
+  // Maximum, as a fold with a non-additive join
+  if (num > 0) {
+    std::function<int(const int &, const int &)> max = [](const int & a, const int & b) { return (a < b) ? b : a; };
+    int top = lnk.ParallelFold<int>([](const int & dat, const int & acc) { return (acc < dat) ? dat : acc; }, max, -1, pool, 4);
+    ASSERT_EQ(top, lnk.Fold<int>([](const int & dat, const int & acc) { return (acc < dat) ? dat : acc; }, -1));
+    ASSERT_EQ(bst.ParallelFold<int>([](const int & dat, const int & acc) { return (acc < dat) ? dat : acc; }, max, -1, pool, 4), bst.Max());
+  }
+}
+
+inline void TestBinaryTreeParallel() {
+  for (ulong threads : {1ul, 4ul}) {
+    lasd::ThreadPool pool(threads);
+    for (ulong num : {0ul, 1ul, 2ul, 3ul, 100ul, 5000ul, 20000ul}) {
+      TestBinaryTreeParallelSize(num, pool);
+    }
+  }
+  lasd::BinaryTreeVec<int> bt(lasd::Vector<int>(1000));
+  bt.ParallelMap([](int & dat) { dat = 1; });
+  std::atomic<ulong> cnt = 0;
+  bt.ParallelTraverse([&cnt](const int & dat) { cnt.fetch_add(dat); });
+  ASSERT_EQ(cnt.load(), 1000ul);
+  std::cout << "All parallel BinaryTree tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
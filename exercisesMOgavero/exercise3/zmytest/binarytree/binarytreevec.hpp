@@ -0,0 +1,230 @@
+#ifndef MYTEST_BINARYTREEVEC_HPP
+#define MYTEST_BINARYTREEVEC_HPP
+
+/* ************************************************************************** */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../binarytree/lnk/binarytreelnk.hpp"
+#include "../../binarytree/vec/binarytreevec.hpp"
+
+/* ************************************************************************** */
+
+// The index loops must visit in the same order as the node-based visits
+
+template <typename Data>
+void CheckSameVisit(const lasd::BinaryTree<Data> & exp, const lasd::BinaryTree<Data> & bt) {
+  lasd::Vector<Data> seq(exp.Size());
+  ulong idx = 0;
+  exp.PreOrderTraverse([&](const Data & dat) { seq[idx++] = dat; });
+  idx = 0;
+  bt.PreOrderTraverse([&](const Data & dat) { ASSERT_EQ(dat, seq[idx++]); });
+  ASSERT_EQ(idx, exp.Size());
+  idx = 0;
+  exp.PostOrderTraverse([&](const Data & dat) { seq[idx++] = dat; });
+  idx = 0;
+  bt.PostOrderTraverse([&](const Data & dat) { ASSERT_EQ(dat, seq[idx++]); });
+  ASSERT_EQ(idx, exp.Size());
+  idx = 0;
+  exp.InOrderTraverse([&](const Data & dat) { seq[idx++] = dat; });
+  idx = 0;
+  bt.InOrderTraverse([&](const Data & dat) { ASSERT_EQ(dat, seq[idx++]); });
+  ASSERT_EQ(idx, exp.Size());
+  idx = 0;
+  exp.BreadthTraverse([&](const Data & dat) { seq[idx++] = dat; });
+  idx = 0;
+  bt.BreadthTraverse([&](const Data & dat) { ASSERT_EQ(dat, seq[idx++]); });
+  ASSERT_EQ(idx, exp.Size());
+}
+
+template <typename Data>
+void TestBinaryTreeVecSize(ulong num) {
+  lasd::Vector<Data> vec(num);
+  for (ulong i = 0; i < num; ++i) {
+    vec[i] = MakeValue<Data>(static_cast<int>(i));
+  }
+  lasd::BinaryTreeVec<Data> bt(vec);
+  lasd::BinaryTreeLnk<Data> lnk(vec);
+  CheckSameVisit<Data>(lnk, bt);
+
+  // Index navigation agrees with the node objects
+  for (ulong i = 0; i < num; ++i) {
+    ASSERT_EQ(bt.ElementAt(i), vec[i]);
+    ASSERT_EQ(bt.HasLeftChild(i), 2 * i + 1 < num);
+    ASSERT_EQ(bt.HasRightChild(i), 2 * i + 2 < num);
+    ASSERT_EQ(bt.IsLeaf(i), !bt.HasLeftChild(i));
+    if (i > 0) {
+      ulong par = lasd::BinaryTreeVec<Data>::ParentIndex(i);
+      ASSERT_TRUE(lasd::BinaryTreeVec<Data>::LeftIndex(par) == i || lasd::BinaryTreeVec<Data>::RightIndex(par) == i);
+    }
+  }
+  ASSERT_THROW(bt.ElementAt(num), std::out_of_range);
+  if (num > 0) {
+    const lasd::BinaryTree<Data> & btref = bt;
+    ASSERT_TRUE(btref == static_cast<const lasd::BinaryTree<Data> &>(lnk));
+    ASSERT_EQ(bt.Root().Element(), vec[0]);
+    ASSERT_EQ(bt.Root().HasLeftChild(), bt.HasLeftChild(0));
+  } else {
+    ASSERT_EQ(bt.InOrderFirst(), bt.Size());
+    ASSERT_EQ(bt.PostOrderFirst(), bt.Size());
+    ASSERT_THROW(bt.Root(), std::length_error);
+  }
+
+  // Copies and moves, with and without the node array already allocated
+  lasd::BinaryTreeVec<Data> cpy(bt);
+  CheckSameVisit<Data>(lnk, cpy);
+  lasd::BinaryTreeVec<Data> mov(std::move(cpy));
+  CheckSameVisit<Data>(lnk, mov);
+  ASSERT_TRUE(cpy.Empty());
+  cpy = mov;
+  ASSERT_TRUE(cpy == mov);
+  if (num > 0) {
+    ASSERT_EQ(mov.Root().Element(), vec[0]);
+    cpy = std::move(mov);
+    ASSERT_EQ(cpy.Root().Element(), vec[0]);
+    ASSERT_EQ(mov.Root().Element(), vec[0]);
+  }
+  cpy.Clear();
+  CheckSameVisit<Data>(lasd::BinaryTreeLnk<Data>(), cpy);
+}
+
+inline void TestBinaryTreeVecMap() {
+  lasd::Vector<int> vec(12);
+  for (ulong i = 0; i < 12; ++i) {
+    vec[i] = static_cast<int>(i);
+  }
+  lasd::BinaryTreeVec<int> bt(vec);
+  lasd::BinaryTreeLnk<int> lnk(vec);
+
+  // Each visit numbers the elements in its own order
+  int cnt = 0;
+  bt.PreOrderMap([&cnt](int & dat) { dat = cnt++; });
+  cnt = 0;
+  lnk.PreOrderMap([&cnt](int & dat) { dat = cnt++; });
+  CheckSameVisit<int>(lnk, bt);
+  cnt = 0;
+  bt.PostOrderMap([&cnt](int & dat) { dat = cnt++; });
+  cnt = 0;
+  lnk.PostOrderMap([&cnt](int & dat) { dat = cnt++; });
+  CheckSameVisit<int>(lnk, bt);
+  cnt = 0;
+  bt.InOrderMap([&cnt](int & dat) { dat = cnt++; });
+  cnt = 0;
+  lnk.InOrderMap([&cnt](int & dat) { dat = cnt++; });
+  CheckSameVisit<int>(lnk, bt);
+  bt.BreadthMap([](int & dat) { dat *= 2; });
+  lnk.BreadthMap([](int & dat) { dat *= 2; });
+  CheckSameVisit<int>(lnk, bt);
+
+  // Walking the index order by hand
+  ulong idx = bt.InOrderFirst();
+  ASSERT_EQ(idx, 7ul);
+  idx = bt.InOrderNext(idx);
+  ASSERT_EQ(idx, 3ul);
+  ASSERT_EQ(bt.PreOrderNext(11), 6ul);
+  ASSERT_EQ(bt.PostOrderNext(0), bt.Size());
+}
+
+// The breadth iterator scans the array of a BinaryTreeVec
+inline void TestBinaryTreeVecBreadth() {
+  for (ulong num : {0ul, 1ul, 2ul, 7ul, 100ul}) {
+    lasd::Vector<int> vec(num);
+    for (ulong i = 0; i < num; ++i) {
+      vec[i] = static_cast<int>(i);
+    }
+    lasd::BinaryTreeVec<int> bt(vec);
+    lasd::BinaryTreeLnk<int> lnk(vec);
+    ASSERT_TRUE(bt.BreadthArray() != nullptr || num == 0);
+    ASSERT_TRUE(lnk.BreadthArray() == nullptr);
+
+    lasd::BTBreadthIterator<int> exp(lnk);
+    lasd::BTBreadthIterator<int> itr(bt);
+    for (; !exp.Terminated(); ++exp, ++itr) {
+      ASSERT_FALSE(itr.Terminated());
+      ASSERT_EQ(*itr, *exp);
+    }
+    ASSERT_TRUE(itr.Terminated());
+    ASSERT_THROW(*itr, std::out_of_range);
+    if (num > 0) {
+      ASSERT_THROW(++itr, std::out_of_range);
+    }
+    itr.Reset();
+    ASSERT_EQ(itr.Terminated(), (num == 0));
+
+    lasd::BTBreadthMutableIterator<int> mit(bt);
+    for (; !mit.Terminated(); ++mit) {
+      *mit += 1;
+    }
+    lasd::BTBreadthIterator<int> cpy(itr);
+    for (ulong i = 0; i < num; ++i, ++cpy) {
+      ASSERT_EQ(*cpy, static_cast<int>(i + 1));
+    }
+    ASSERT_TRUE(cpy.Terminated());
+
+    // Inlined overloads and the generic std::function paths
+    bt.BreadthMap([](int & dat) { dat *= 3; });
+    lasd::MutableBinaryTree<int> & gen = bt;
+    gen.BreadthMap([](int & dat) { dat -= 1; });
+    long sum = 0;
+    bt.BreadthTraverse([&sum](const int & dat) { sum += dat; });
+    long exs = 0;
+    for (ulong i = 0; i < num; ++i) {
+      exs += 3 * static_cast<long>(i + 1) - 1;
+    }
+    ASSERT_EQ(sum, exs);
+    lnk.BreadthMap([](int & dat) { dat = 3 * (dat + 1) - 1; });
+    const lasd::BinaryTree<int> & btref = bt;
+    ASSERT_TRUE(btref == static_cast<const lasd::BinaryTree<int> &>(lnk));
+    ASSERT_TRUE(static_cast<const lasd::BinaryTree<int> &>(lnk) == btref);
+  }
+}
+
+// Readers racing on the first Root() of a const tree share one node array
+
+inline void TestBinaryTreeVecConcurrentRoot() {
+  const ulong nthr = 8;
+  for (ulong rnd = 0; rnd < 200; ++rnd) {
+    lasd::Vector<int> vec(64);
+    for (ulong i = 0; i < vec.Size(); ++i) {
+      vec[i] = static_cast<int>(i);
+    }
+    const lasd::BinaryTreeVec<int> bt(vec);
+    std::vector<const lasd::BinaryTree<int>::Node *> roots(nthr);
+    std::vector<std::thread> thrs;
+    for (ulong t = 0; t < nthr; ++t) {
+      thrs.emplace_back([&bt, &roots, t]() {
+        roots[t] = &bt.Root();
+        ASSERT_EQ(roots[t]->LeftChild().RightChild().Element(), 4);
+      });
+    }
+    for (std::thread & thr : thrs) {
+      thr.join();
+    }
+    for (ulong t = 0; t < nthr; ++t) {
+      ASSERT_TRUE(roots[t] == &bt.Root());
+    }
+  }
+}
+
+inline void TestBinaryTreeVec() {
+  for (ulong num = 0; num <= 40; ++num) {
+    TestBinaryTreeVecSize<int>(num);
+  }
+  for (ulong num : {100ul, 1023ul, 1024ul}) {
+    TestBinaryTreeVecSize<int>(num);
+    TestBinaryTreeVecSize<std::string>(num);
+  }
+  TestBinaryTreeVecMap();
+  TestBinaryTreeVecBreadth();
+  TestBinaryTreeVecConcurrentRoot();
+  std::cout << "All BinaryTreeVec tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
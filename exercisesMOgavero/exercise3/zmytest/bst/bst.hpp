@@ -0,0 +1,355 @@
+#ifndef MYTEST_BST_HPP
+#define MYTEST_BST_HPP
+
+/* ************************************************************************** */
+
+#include <compare>
+#include <string>
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../bst/bst.hpp"
+#include "../../bst/avl/bstavl.hpp"
+
+/* ************************************************************************** */
+
+// Compares the order statistics of bst with the set of keys marked in prs
+
+template <typename BSTType>
+void CheckOrderStatistics(const BSTType & bst, const bool * prs, int num) {
+  ulong cnt = 0;
+  for (int i = 0; i < num; ++i) {
+    ASSERT_EQ(bst.Rank(i), cnt);
+    if (prs[i]) {
+      ASSERT_EQ(bst.Select(cnt), i);
+      ASSERT_EQ(bst[cnt], i);
+      ++cnt;
+    }
+  }
+  ASSERT_EQ(bst.Size(), cnt);
+  ASSERT_EQ(bst.Rank(num), cnt);
+  ASSERT_THROW(bst.Select(cnt), std::out_of_range);
+  for (int lo = 0; lo < num; lo += 37) {
+    for (int hi = lo; hi <= num; hi += 53) {
+      ulong exp = 0;
+      for (int i = lo; i < hi; ++i) {
+        exp += prs[i];
+      }
+      ASSERT_EQ(bst.CountRange(lo, hi), exp);
+    }
+  }
+  ASSERT_EQ(bst.CountRange(num, 0), 0ul);
+}
+
+template <template <typename> class BSTType>
+void TestBSTOrderStatistics() {
+  const int num = 1000;
+  bool prs[num] = {};
+  BSTType<int> bst;
+  CheckOrderStatistics(bst, prs, num);
+
+  ulong rng = 12345;
+  for (int k = 0; k < 3000; ++k) {
+    rng = rng * 6364136223846793005ul + 1442695040888963407ul;
+    int key = static_cast<int>((rng >> 33) % num);
+    ASSERT_EQ(bst.Insert(key), !prs[key]);
+    prs[key] = true;
+  }
+  CheckOrderStatistics(bst, prs, num);
+
+  // Every kind of removal keeps the subtree sizes
+  for (int key = 0; key < num; key += 5) {
+    ASSERT_EQ(bst.Remove(key), prs[key]);
+    prs[key] = false;
+  }
+  prs[bst.MinNRemove()] = false;
+  prs[bst.Max()] = false;
+  bst.RemoveMax();
+  prs[bst.PredecessorNRemove(500)] = false;
+  prs[bst.SuccessorNRemove(500)] = false;
+  prs[bst.Predecessor(250)] = false;
+  bst.RemovePredecessor(250);
+  prs[bst.Successor(750)] = false;
+  bst.RemoveSuccessor(750);
+  CheckOrderStatistics(bst, prs, num);
+
+  BSTType<int> cpy(bst);
+  CheckOrderStatistics(cpy, prs, num);
+  cpy.Clear();
+  cpy = bst;
+  CheckOrderStatistics(cpy, prs, num);
+
+  while (!bst.Empty()) {
+    prs[bst.MinNRemove()] = false;
+  }
+  CheckOrderStatistics(bst, prs, num);
+}
+
+inline void TestBSTOrderStatisticsString() {
+  lasd::BST<std::string> bst;
+  bst.Insert("b");
+  bst.Insert("d");
+  bst.Insert("a");
+  bst.Insert("c");
+  ASSERT_EQ(bst.Select(0), "a");
+  ASSERT_EQ(bst[3], "d");
+  ASSERT_EQ(bst.Rank("c"), 2ul);
+  ASSERT_EQ(bst.Rank("bb"), 2ul);
+  ASSERT_EQ(bst.CountRange("b", "d"), 2ul);
+}
+
+// Height of the subtree rooted at nod (a leaf has height 1)
+
+template <typename Data>
+ulong TreeHeight(const typename lasd::BinaryTree<Data>::Node & nod) {
+  ulong lef = nod.HasLeftChild() ? TreeHeight<Data>(nod.LeftChild()) : 0;
+  ulong rig = nod.HasRightChild() ? TreeHeight<Data>(nod.RightChild()) : 0;
+  return ((lef < rig) ? rig : lef) + 1;
+}
+
+inline ulong MinHeight(ulong num) {
+  ulong hgt = 0;
+  while (num != 0) {
+    num >>= 1;
+    ++hgt;
+  }
+  return hgt;
+}
+
+// Sorted input is bulk-loaded perfectly balanced; Rebalance flattens any tree
+
+// Key that counts its copies (copy construction and copy assignment)
+
+struct CountedKey {
+  int key = 0;
+  static inline ulong copies = 0;
+  static inline ulong compares = 0;
+
+  CountedKey() = default;
+  CountedKey(int val) : key(val) {}
+  CountedKey(const CountedKey & oth) : key(oth.key) { ++copies; }
+  CountedKey & operator=(const CountedKey & oth) { key = oth.key; ++copies; return *this; }
+
+  bool operator==(const CountedKey & oth) const { ++compares; return (key == oth.key); }
+  std::strong_ordering operator<=>(const CountedKey & oth) const { ++compares; return (key <=> oth.key); }
+};
+
+template <template <typename> class BSTType>
+void TestBSTBulkLoad() {
+  const int num = 1000;
+  bool prs[num] = {};
+  lasd::Vector<int> vec(2 * num);
+  for (ulong i = 0; i < 2 * num; ++i) {
+    vec[i] = static_cast<int>(i / 4) * 2; // (each even key four times)
+  }
+  for (int i = 0; i < num; ++i) {
+    prs[i] = (i % 2 == 0);
+  }
+
+  BSTType<int> bst(vec);
+  ASSERT_EQ(bst.Size(), static_cast<ulong>(num / 2));
+  ASSERT_EQ(TreeHeight<int>(bst.Root()), MinHeight(bst.Size()));
+  CheckOrderStatistics(bst, prs, num);
+
+  BSTType<int> mov(std::move(vec));
+  ASSERT_TRUE(mov == bst);
+
+  // Later updates still keep the subtree sizes
+  ASSERT_TRUE(bst.Insert(1));
+  prs[1] = true;
+  ASSERT_TRUE(bst.Remove(100));
+  prs[100] = false;
+  CheckOrderStatistics(bst, prs, num);
+
+  // Unsorted input falls back to one insertion per element
+  lasd::Vector<int> uns(3);
+  uns[0] = 2;
+  uns[1] = 1;
+  uns[2] = 3;
+  BSTType<int> sml(uns);
+  ASSERT_EQ(sml.Size(), 3ul);
+  ASSERT_EQ(sml.Root().Element(), 2);
+
+  BSTType<int> deg;
+  for (int i = 0; i < num; ++i) {
+    deg.Insert(i);
+    prs[i] = true;
+  }
+  deg.Rebalance();
+  ASSERT_EQ(deg.Size(), static_cast<ulong>(num));
+  ASSERT_EQ(TreeHeight<int>(deg.Root()), MinHeight(num));
+  CheckOrderStatistics(deg, prs, num);
+  ASSERT_TRUE(deg.Remove(0) && deg.Remove(num - 1) && deg.Insert(num));
+  ASSERT_EQ(deg.Min(), 1);
+  ASSERT_EQ(deg.Max(), num);
+
+  BSTType<int> emp;
+  emp.Rebalance();
+  ASSERT_TRUE(emp.Empty());
+
+  // Checking the order copies nothing: one copy per node, none per element
+  lasd::Vector<CountedKey> keys(num);
+  for (int i = 0; i < num; ++i) {
+    keys[i].key = i / 2;
+  }
+  CountedKey::copies = 0;
+  BSTType<CountedKey> cnt(keys);
+  ASSERT_EQ(cnt.Size(), static_cast<ulong>(num / 2));
+  ASSERT_EQ(CountedKey::copies, static_cast<ulong>(num / 2));
+  lasd::Vector<int> none;
+  BSTType<int> fromnone(none);
+  ASSERT_TRUE(fromnone.Empty());
+}
+
+// Range queries against a filtered full scan, on bounds present and absent
+
+template <template <typename> class BSTType>
+void TestBSTRange() {
+  BSTType<int> bst;
+  for (int key = 0; key < 400; key += 3) {
+    bst.Insert((key * 7) % 400);
+  }
+
+  for (int lo = -5; lo < 410; lo += 17) {
+    for (int hi = lo - 10; hi < 420; hi += 29) {
+      lasd::StackVec<int> exp;
+      bst.InOrderTraverse(
+        [&exp, lo, hi](const int & dat) {
+          if (lo <= dat && dat < hi) {
+            exp.Push(dat);
+          }
+        }
+      );
+      lasd::StackVec<int> got;
+      bst.RangeTraverse(lo, hi, [&got](const int & dat) { got.Push(dat); });
+      ASSERT_TRUE(got == exp);
+
+      lasd::BSTRangeIterator<int> itr(bst, lo, hi);
+      lasd::StackVec<int> itd;
+      for (; !itr.Terminated(); ++itr) {
+        itd.Push(*itr);
+      }
+      ASSERT_TRUE(itd == exp);
+      ASSERT_EQ(itd.Size(), bst.CountRange(lo, hi));
+      ASSERT_THROW(*itr, std::out_of_range);
+      ASSERT_THROW(++itr, std::out_of_range);
+
+      itr.Reset();
+      ASSERT_EQ(itr.Terminated(), exp.Empty());
+    }
+  }
+
+  // Keys are updated in place, keeping their order
+  BSTType<int> ten;
+  for (int key = 0; key < 400; key += 10) {
+    ten.Insert(key);
+  }
+  ten.RangeMap(100, 200, [](int & dat) { dat += 5; });
+  ASSERT_TRUE(ten.Exists(105) && ten.Exists(195) && ten.Exists(200));
+  ASSERT_FALSE(ten.Exists(100) || ten.Exists(190) || ten.Exists(205));
+  ulong cnt = 0;
+  ten.RangeTraverse(100, 200, [&cnt](const int & dat) { ASSERT_EQ(dat % 10, 5); ++cnt; });
+  ASSERT_EQ(cnt, 10ul);
+
+  BSTType<int> emp;
+  lasd::BSTRangeIterator<int> itr(emp, 0, 10);
+  ASSERT_TRUE(itr.Terminated());
+  emp.RangeTraverse(0, 10, [](const int &) { ASSERT_TRUE(false); });
+}
+
+// STL iterators against the in-order visit, forwards and backwards
+
+static_assert(std::bidirectional_iterator<lasd::BST<int>::const_iterator>);
+static_assert(std::ranges::bidirectional_range<const lasd::BSTAVL<std::string>>);
+
+template <template <typename> class BSTType>
+void TestBSTIterator() {
+  BSTType<int> bst;
+  ASSERT_TRUE(bst.begin() == bst.end());
+  ASSERT_EQ(std::ranges::distance(bst), 0);
+
+  // Unbalanced shapes too: ascending runs make long right spines
+  for (int key = 0; key < 300; ++key) {
+    bst.Insert((key < 100) ? key : ((key * 37) % 1000));
+  }
+  lasd::StackVec<int> exp;
+  bst.InOrderTraverse([&exp](const int & dat) { exp.Push(dat); });
+
+  lasd::StackVec<int> fwd;
+  for (const int & dat : bst) {
+    fwd.Push(dat);
+  }
+  ASSERT_TRUE(fwd == exp);
+  ASSERT_EQ(static_cast<ulong>(std::ranges::distance(bst)), bst.Size());
+  ASSERT_TRUE(std::ranges::is_sorted(bst));
+
+  lasd::StackVec<int> bwd;
+  for (int dat : bst | std::views::reverse) {
+    bwd.Push(dat);
+  }
+  ulong idx = 0;
+  while (!bwd.Empty()) {
+    ASSERT_EQ(bwd.TopNPop(), bst[idx++]);
+  }
+  ASSERT_EQ(idx, bst.Size());
+
+  for (int key = -1; key <= 1000; key += 7) {
+    auto pos = std::ranges::lower_bound(bst, key);
+    ASSERT_EQ(static_cast<ulong>(std::ranges::distance(bst.begin(), pos)), bst.Rank(key));
+    ASSERT_EQ(std::ranges::binary_search(bst, key), bst.Exists(key));
+  }
+
+  auto itr = bst.begin();
+  ASSERT_EQ(*itr++, bst.Min());
+  ASSERT_EQ(*itr, bst[1]);
+  ASSERT_TRUE(--itr == bst.begin());
+  auto last = bst.end();
+  ASSERT_EQ(*--last, bst.Max());
+  ASSERT_TRUE(++last == bst.cend());
+
+  BSTType<std::string> str;
+  str.Insert("b");
+  str.Insert("a");
+  ASSERT_EQ(str.begin()->size(), 1ul);
+  ASSERT_EQ(*std::ranges::next(str.begin()), "b");
+
+  // No step walks down from the root again: a full scan of a left spine
+  // (a single chain for BST) compares no keys
+  const int num = 2000;
+  BSTType<CountedKey> chn;
+  for (int key = num - 1; key >= 0; --key) {
+    chn.Insert(CountedKey(key));
+  }
+  CountedKey::compares = 0;
+  int nxt = 0;
+  for (const CountedKey & dat : chn) {
+    ASSERT_EQ(dat.key, nxt++);
+  }
+  ASSERT_EQ(nxt, num);
+  for (auto pos = chn.end(); pos != chn.begin(); ) {
+    ASSERT_EQ((--pos)->key, --nxt);
+  }
+  ASSERT_EQ(nxt, 0);
+  ASSERT_EQ(CountedKey::compares, 0ul);
+}
+
+inline void TestBST() {
+  TestBSTOrderStatistics<lasd::BST>();
+  TestBSTOrderStatistics<lasd::BSTAVL>();
+  TestBSTOrderStatisticsString();
+  TestBSTBulkLoad<lasd::BST>();
+  TestBSTBulkLoad<lasd::BSTAVL>();
+  TestBSTRange<lasd::BST>();
+  TestBSTRange<lasd::BSTAVL>();
+  TestBSTIterator<lasd::BST>();
+  TestBSTIterator<lasd::BSTAVL>();
+  std::cout << "All BST tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
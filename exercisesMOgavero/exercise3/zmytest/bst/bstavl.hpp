@@ -0,0 +1,276 @@
+#ifndef MYTEST_BSTAVL_HPP
+#define MYTEST_BSTAVL_HPP
+
+/* ************************************************************************** */
+
+#include <string>
+
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
+#include "../../bst/avl/bstavl.hpp"
+
+/* ************************************************************************** */
+
+// Checks the AVL invariant below nod and returns the height of the subtree
+
+template <typename Data>
+ulong CheckAVL(const typename lasd::BinaryTree<Data>::Node & nod) {
+  ulong lef = 0, rig = 0;
+  if (nod.HasLeftChild()) {
+    ASSERT_TRUE(nod.LeftChild().Element() < nod.Element());
+    lef = CheckAVL<Data>(nod.LeftChild());
+  }
+  if (nod.HasRightChild()) {
+    ASSERT_TRUE(nod.RightChild().Element() > nod.Element());
+    rig = CheckAVL<Data>(nod.RightChild());
+  }
+  ASSERT_TRUE(lef <= rig + 1 && rig <= lef + 1);
+  return ((lef < rig) ? rig : lef) + 1;
+}
+
+template <typename Data>
+void CheckAVL(const lasd::BSTAVL<Data> & bst) {
+  if (!bst.Empty()) {
+    ASSERT_EQ(CheckAVL<Data>(bst.Root()), bst.Height());
+  } else {
+    ASSERT_EQ(bst.Height(), 0ul);
+  }
+}
+
+inline void TestBSTAVLSorted() {
+  const int num = 100000;
+  lasd::BSTAVL<int> bst;
+  for (int i = 0; i < num; ++i) {
+    ASSERT_TRUE(bst.Insert(i));
+  }
+  ASSERT_FALSE(bst.Insert(0));
+  ASSERT_EQ(bst.Size(), static_cast<ulong>(num));
+  ASSERT_TRUE(bst.Height() <= 24);
+  CheckAVL(bst);
+  ASSERT_EQ(bst.Min(), 0);
+  ASSERT_EQ(bst.Max(), num - 1);
+  ASSERT_EQ(bst.Successor(41), 42);
+  ASSERT_EQ(bst.Predecessor(41), 40);
+
+  int prv = -1;
+  bst.InOrderTraverse(
+    [&prv](const int & dat) {
+      ASSERT_EQ(dat, prv + 1);
+      prv = dat;
+    }
+  );
+  ASSERT_EQ(prv, num - 1);
+
+  // Descending removals from the front keep the tree balanced
+  for (int i = 0; i < num / 2; ++i) {
+    ASSERT_EQ(bst.MinNRemove(), i);
+  }
+  CheckAVL(bst);
+  for (int i = num - 1; i >= 3 * num / 4; --i) {
+    bst.RemoveMax();
+  }
+  CheckAVL(bst);
+  ASSERT_EQ(bst.Size(), static_cast<ulong>(num / 4));
+  ASSERT_EQ(bst.Min(), num / 2);
+  ASSERT_EQ(bst.Max(), 3 * num / 4 - 1);
+  bst.Clear();
+  ASSERT_TRUE(bst.Empty());
+  CheckAVL(bst);
+}
+
+inline void TestBSTAVLMixed() {
+  lasd::BSTAVL<int> bst;
+  for (int i = 0; i < 2000; ++i) {
+    bst.Insert((i * 7919) % 2000);
+  }
+  CheckAVL(bst);
+  for (int i = 0; i < 2000; i += 3) {
+    ASSERT_TRUE(bst.Remove(i));
+  }
+  ASSERT_FALSE(bst.Remove(0));
+  CheckAVL(bst);
+  ASSERT_EQ(bst.PredecessorNRemove(10), 8);
+  bst.RemoveSuccessor(10);
+  ASSERT_FALSE(bst.Exists(11));
+  ASSERT_EQ(bst.SuccessorNRemove(10), 13);
+  bst.RemovePredecessor(10);
+  ASSERT_FALSE(bst.Exists(7));
+  CheckAVL(bst);
+  for (int i = 0; i < 2000; ++i) {
+    ASSERT_EQ(bst.Exists(i), (i % 3 != 0) && (i != 7) && (i != 8) && (i != 11) && (i != 13));
+  }
+
+  // Copies keep the shape (and the heights) of the source
+  lasd::BSTAVL<int> cpy(bst);
+  ASSERT_TRUE(cpy == bst);
+  ASSERT_EQ(cpy.Height(), bst.Height());
+  cpy.Insert(-1);
+  CheckAVL(cpy);
+  ASSERT_TRUE(cpy != bst);
+  cpy = bst;
+  ASSERT_TRUE(cpy == bst);
+  lasd::BSTAVL<int> mov(std::move(cpy));
+  ASSERT_TRUE(mov == bst);
+  ASSERT_TRUE(cpy.Empty());
+}
+
+inline void TestBSTAVLContainers() {
+  lasd::SortableVector<std::string> vec(500);
+  for (int i = 0; i < 500; ++i) {
+    vec[i] = MakeValue<std::string>(i);
+  }
+  vec.Sort();
+  lasd::BSTAVL<std::string> bst(vec);
+  ASSERT_EQ(bst.Size(), 500ul);
+  CheckAVL(bst);
+  lasd::BSTAVL<std::string> mov(std::move(vec));
+  ASSERT_TRUE(mov == bst);
+  CheckAVL(mov);
+
+  lasd::List<int> lst;
+  for (int i = 0; i < 300; ++i) {
+    lst.InsertAtBack(i);
+  }
+  lasd::BSTAVL<int> bstint(lst);
+  CheckAVL(bstint);
+  ASSERT_TRUE(bstint.Height() <= 10);
+}
+
+// Assignment through a BST reference keeps the node type of the target
+
+inline void TestBSTAVLBaseAssign() {
+  lasd::BST<int> bst;
+  for (int i = 0; i < 1000; ++i) {
+    bst.Insert(i); // (a degenerate chain)
+  }
+  lasd::BSTAVL<int> avl;
+  avl.Insert(-1);
+  lasd::BST<int> & ref = avl;
+  ref = bst;
+  ASSERT_EQ(avl.Size(), 1000ul);
+  CheckAVL(avl);
+  for (int i = 1000; i < 2000; ++i) {
+    ASSERT_TRUE(avl.Insert(i));
+  }
+  ASSERT_TRUE(avl.Remove(500));
+  CheckAVL(avl);
+  ASSERT_EQ(avl.Size(), 1999ul);
+  ASSERT_EQ(avl[500], 501);
+
+  lasd::BSTAVL<int> oth;
+  for (int i = 0; i < 100; ++i) {
+    oth.Insert(3 * i);
+  }
+  ref = oth;
+  ASSERT_TRUE(avl == oth);
+  CheckAVL(avl);
+  ref = std::move(bst);
+  ASSERT_EQ(avl.Size(), 1000ul);
+  ASSERT_TRUE(avl.Insert(1000));
+  CheckAVL(avl);
+  ref = std::move(oth);
+  ASSERT_EQ(avl.Size(), 100ul);
+  ASSERT_TRUE(avl.Insert(1) && !avl.Insert(3));
+  CheckAVL(avl);
+
+  // And the other way round: a plain BST assigned from a BSTAVL
+  lasd::BST<int> pln;
+  lasd::BST<int> & src = avl;
+  pln = src;
+  ASSERT_EQ(pln.Size(), 101ul);
+  ASSERT_TRUE(pln.Insert(2) && pln.Exists(297));
+  ASSERT_EQ(pln.Rank(3), 3ul);
+  // (moving copies too: the AVL keeps its own nodes and stays usable)
+  pln = std::move(src);
+  ASSERT_EQ(pln.Size(), 101ul);
+  ASSERT_TRUE(!pln.Exists(2) && pln.Exists(297));
+  ASSERT_TRUE(avl.Insert(2) && avl.Insert(5000));
+  ASSERT_EQ(avl.Size(), 103ul);
+  CheckAVL(avl);
+  ASSERT_TRUE(pln.Insert(4) && pln.Remove(297));
+}
+
+// Set algebra against membership arrays, on trees of very different sizes
+
+inline void CheckSetAlgebra(int num, int fstcnt, int sndcnt, bool par) {
+  bool * fst = new bool[num] {};
+  bool * snd = new bool[num] {};
+  lasd::BSTAVL<int> a, b;
+  ulong rng = 99991 + num + fstcnt;
+  for (int k = 0; k < fstcnt + sndcnt; ++k) {
+    rng = rng * 6364136223846793005ul + 1442695040888963407ul;
+    int key = static_cast<int>((rng >> 33) % num);
+    if (k < fstcnt) {
+      a.Insert(key);
+      fst[key] = true;
+    } else {
+      b.Insert(key);
+      snd[key] = true;
+    }
+  }
+
+  lasd::BSTAVL<int> uni(a), itr(a), dif(a), rev(b);
+  uni.Union(b, par);
+  itr.Intersect(b, par);
+  dif.Difference(b, par);
+  lasd::BSTAVL<int> tmp(a);
+  rev.Difference(std::move(tmp), par);
+  ASSERT_TRUE(tmp.Empty());
+
+  const lasd::BSTAVL<int> * res[] = {&uni, &itr, &dif, &rev};
+  for (const lasd::BSTAVL<int> * bst : res) {
+    CheckAVL(*bst);
+  }
+  ulong cnt[4] = {};
+  for (int key = 0; key < num; ++key) {
+    bool exp[4] = {fst[key] || snd[key], fst[key] && snd[key], fst[key] && !snd[key], snd[key] && !fst[key]};
+    for (int i = 0; i < 4; ++i) {
+      ASSERT_EQ(res[i]->Exists(key), exp[i]);
+      if (exp[i]) {
+        ASSERT_EQ(res[i]->Select(cnt[i]++), key);
+      }
+    }
+  }
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(res[i]->Size(), cnt[i]);
+  }
+  delete[] fst;
+  delete[] snd;
+}
+
+inline void TestBSTAVLSetAlgebra() {
+  for (bool par : {false, true}) {
+    CheckSetAlgebra(100, 0, 50, par);
+    CheckSetAlgebra(100, 50, 0, par);
+    CheckSetAlgebra(1000, 600, 700, par);
+    CheckSetAlgebra(100000, 20, 40000, par);
+    CheckSetAlgebra(100000, 40000, 20, par);
+    CheckSetAlgebra(100000, 40000, 40000, par);
+  }
+
+  // An argument aliasing the tree
+  lasd::BSTAVL<int> bst;
+  for (int i = 0; i < 100; ++i) {
+    bst.Insert(i);
+  }
+  bst.Union(bst);
+  bst.Intersect(std::move(bst));
+  ASSERT_EQ(bst.Size(), 100ul);
+  bst.Difference(bst);
+  ASSERT_TRUE(bst.Empty());
+}
+
+inline void TestBSTAVL() {
+  TestBSTAVLSorted();
+  TestBSTAVLMixed();
+  TestBSTAVLContainers();
+  TestBSTAVLBaseAssign();
+  TestBSTAVLSetAlgebra();
+  std::cout << "All BSTAVL tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef MYTEST_BSTPERSISTENT_HPP
+#define MYTEST_BSTPERSISTENT_HPP
+
+/* ************************************************************************** */
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../bst/persistent/bstpersistent.hpp"
+
+/* ************************************************************************** */
+
+// Height of the subtree rooted at nod, checking the AVL balance on the way
+
+template <typename Data>
+ulong PersistentHeight(const typename lasd::BinaryTree<Data>::Node & nod) {
+  ulong lef = nod.HasLeftChild() ? PersistentHeight<Data>(nod.LeftChild()) : 0;
+  ulong rig = nod.HasRightChild() ? PersistentHeight<Data>(nod.RightChild()) : 0;
+  ASSERT_TRUE(lef <= rig + 1 && rig <= lef + 1);
+  return ((lef < rig) ? rig : lef) + 1;
+}
+
+// Compares a version of the tree with the set of keys marked in prs
+
+inline void CheckPersistent(const lasd::BSTPersistent<int> & bst, const std::vector<char> & prs) {
+  ulong cnt = 0;
+  int prv = -1;
+  bst.InOrderTraverse(
+    [&cnt, &prv, &prs](const int & dat) {
+      ASSERT_TRUE(prv < dat && prs[dat]);
+      prv = dat;
+      ++cnt;
+    }
+  );
+  ASSERT_EQ(bst.Size(), cnt);
+  for (ulong i = 0; i < prs.size(); ++i) {
+    ASSERT_EQ(bst.Exists(static_cast<int>(i)), prs[i] != 0);
+  }
+  if (cnt != 0) {
+    ASSERT_EQ(bst.Max(), prv);
+    ASSERT_EQ(PersistentHeight<int>(bst.Root()), bst.Height());
+  } else {
+    ASSERT_THROW(bst.Root(), std::length_error);
+    ASSERT_THROW(bst.Min(), std::length_error);
+    ASSERT_EQ(bst.Height(), 0ul);
+  }
+}
+
+// Random updates; every snapshot keeps the version it was taken from
+
+inline void TestBSTPersistentVersions() {
+  const int num = 600;
+  std::vector<char> prs(num, 0);
+  lasd::BSTPersistent<int> bst;
+  CheckPersistent(bst, prs);
+
+  std::vector<lasd::BSTPersistent<int>> snaps;
+  std::vector<std::vector<char>> olds;
+  ulong rng = 4242;
+  for (int k = 1; k <= 6000; ++k) {
+    rng = rng * 6364136223846793005ul + 1442695040888963407ul;
+    int key = static_cast<int>((rng >> 33) % num);
+    // Insertions prevail first, removals afterwards
+    if (((rng >> 20) % 100) < ((k <= 3000) ? 70u : 30u)) {
+      ASSERT_EQ(bst.Insert(key), !prs[key]);
+      prs[key] = 1;
+    } else {
+      ASSERT_EQ(bst.Remove(key), prs[key] != 0);
+      prs[key] = 0;
+    }
+    if (k % 500 == 0) {
+      snaps.push_back(bst.Snapshot());
+      olds.push_back(prs);
+    }
+  }
+  CheckPersistent(bst, prs);
+  for (ulong i = 0; i < snaps.size(); ++i) {
+    CheckPersistent(snaps[i], olds[i]);
+  }
+
+  // Sorted insertions stay balanced; emptying the tree leaves the snapshot intact
+  lasd::BSTPersistent<int> seq;
+  for (int key = 0; key < num; ++key) {
+    ASSERT_TRUE(seq.Insert(key));
+  }
+  ASSERT_TRUE(seq.Height() <= 11);
+  lasd::BSTPersistent<int> full(seq);
+  ASSERT_TRUE(full == seq);
+  for (int key = 0; key < num; key += 2) {
+    ASSERT_TRUE(seq.Remove(key));
+  }
+  ASSERT_TRUE(full != seq);
+  seq.Clear();
+  ASSERT_TRUE(seq.Empty());
+  ASSERT_FALSE(seq.Remove(0));
+  std::vector<char> all(num, 1);
+  CheckPersistent(full, all);
+  ASSERT_EQ(full.Min(), 0);
+}
+
+inline void TestBSTPersistentContainers() {
+  lasd::Vector<std::string> vec(200);
+  for (int i = 0; i < 200; ++i) {
+    vec[i] = MakeValue<std::string>(i % 150);
+  }
+  lasd::BSTPersistent<std::string> bst(vec);
+  ASSERT_EQ(bst.Size(), 150ul);
+  ASSERT_TRUE(bst.Exists("str_149"));
+  ASSERT_FALSE(bst.Exists("str_150"));
+  ASSERT_EQ(bst.Min(), "str_0");
+  ASSERT_EQ(bst.Max(), "str_99");
+
+  lasd::BSTPersistent<std::string> mov(std::move(vec));
+  ASSERT_TRUE(mov == bst);
+  ASSERT_TRUE(mov.Remove("str_0"));
+  ASSERT_TRUE(mov != bst);
+
+  lasd::BSTPersistent<std::string> tmp(std::move(mov));
+  ASSERT_TRUE(mov.Empty());
+  ASSERT_EQ(tmp.Size(), 149ul);
+  mov = bst;
+  ASSERT_TRUE(mov == bst);
+  mov = std::move(tmp);
+  ASSERT_EQ(mov.Size(), 149ul);
+  ASSERT_EQ(tmp.Size(), 150ul);
+  ASSERT_TRUE(bst.Remove("str_7"));
+  ASSERT_TRUE(tmp.Exists("str_7"));
+  ASSERT_TRUE(mov.Exists("str_7"));
+}
+
+// One writer slides a window of consecutive keys, readers check every snapshot
+
+inline void TestBSTPersistentThreads() {
+  const int nthr = 4;
+  const int num = 20000;
+  const int wid = 500;
+  lasd::BSTPersistent<int> bst;
+  std::atomic<bool> done = false;
+  std::vector<std::thread> thrs;
+
+  for (int t = 0; t < nthr; ++t) {
+    thrs.emplace_back([&bst, &done]() {
+      int last = -1;
+      do {
+        lasd::BSTPersistent<int> snap = bst.Snapshot();
+        if (snap.Empty()) {
+          continue;
+        }
+        int lo = snap.Min();
+        int hi = snap.Max();
+        ASSERT_EQ(snap.Size(), static_cast<ulong>(hi - lo + 1));
+        ASSERT_TRUE(hi >= last);
+        last = hi;
+        int nxt = lo;
+        snap.InOrderTraverse([&nxt](const int & dat) { ASSERT_EQ(dat, nxt++); });
+        ASSERT_EQ(nxt, hi + 1);
+      } while (!done.load());
+    });
+  }
+  for (int key = 0; key < num; ++key) {
+    ASSERT_TRUE(bst.Insert(key));
+    if (key >= wid) {
+      ASSERT_TRUE(bst.Remove(key - wid));
+    }
+  }
+  done.store(true);
+  for (std::thread & thr : thrs) {
+    thr.join();
+  }
+  ASSERT_EQ(bst.Size(), static_cast<ulong>(wid));
+  ASSERT_EQ(bst.Min(), num - wid);
+}
+
+inline void TestBSTPersistent() {
+  TestBSTPersistentVersions();
+  TestBSTPersistentContainers();
+  TestBSTPersistentThreads();
+  std::cout << "All BSTPersistent tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,250 @@
+#ifndef MYTEST_HASHTABLE_HPP
+#define MYTEST_HASHTABLE_HPP
+
+/* ************************************************************************** */
+
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <stdexcept>
+
+#include "../util/test_utils.hpp"
+
+#include "../../hashtable/clsadr/htclsadr.hpp"
+#include "../../hashtable/opnadr/htopnadr.hpp"
+#include "../../stream/stream.hpp"
+
+/* ************************************************************************** */
+
+inline void TestHashFunctions() {
+  lasd::Hashable<int> hint;
+  lasd::Hashable<double> hdbl;
+  lasd::Hashable<std::string> hstr;
+
+  // Opposite integers no longer collide
+  for (int i = 1; i < 1000; ++i) {
+    ASSERT_NE(hint(i), hint(-i));
+  }
+
+  // Integral doubles no longer all hash to the same value
+  ASSERT_NE(hdbl(1.0), hdbl(2.0));
+  ASSERT_NE(hdbl(-3.0), hdbl(3.0));
+  ASSERT_NE(hdbl(0.5), hdbl(1.5));
+  ASSERT_EQ(hdbl(0.0), hdbl(-0.0));
+
+  // Strings: every byte matters, whatever the length
+  std::string str(100, 'x');
+  for (ulong len = 0; len < str.length(); ++len) {
+    ASSERT_NE(lasd::HashBytes(str.data(), len), lasd::HashBytes(str.data(), len + 1));
+  }
+  ASSERT_NE(hstr("ab"), hstr("ba"));
+  ASSERT_NE(hstr(std::string(40, 'a') + "b"), hstr(std::string(40, 'a') + "c"));
+  ASSERT_EQ(hstr("lasd"), hstr(std::string("lasd")));
+
+  // Fast range stays within bounds
+  for (ulong i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(lasd::FastRange(lasd::Mix64(i), 61) < 61);
+  }
+  ASSERT_EQ(lasd::FastRange(~0ul, 7), 6ul);
+
+  std::cout << "All hash function tests passed\n";
+}
+
+template <template <typename> class HT>
+void TestHashTableKeys() {
+  HT<int> htint;
+  for (int i = -500; i <= 500; ++i) {
+    ASSERT_TRUE(htint.Insert(i));
+  }
+  ASSERT_EQ(htint.Size(), 1001ul);
+  for (int i = -500; i <= 500; ++i) {
+    ASSERT_TRUE(htint.Exists(i));
+  }
+  ASSERT_FALSE(htint.Exists(501));
+
+  HT<double> htdbl;
+  for (int i = 0; i < 500; ++i) {
+    ASSERT_TRUE(htdbl.Insert(static_cast<double>(i)));
+  }
+  ASSERT_FALSE(htdbl.Insert(-0.0));
+  for (int i = 0; i < 500; ++i) {
+    ASSERT_TRUE(htdbl.Exists(static_cast<double>(i)));
+    ASSERT_FALSE(htdbl.Exists(i + 0.5));
+  }
+
+  HT<std::string> htstr;
+  for (int i = 0; i < 500; ++i) {
+    ASSERT_TRUE(htstr.Insert(MakeValue<std::string>(i)));
+  }
+  for (int i = 0; i < 500; i += 2) {
+    ASSERT_TRUE(htstr.Remove(MakeValue<std::string>(i)));
+  }
+  ASSERT_EQ(htstr.Size(), 250ul);
+  for (int i = 0; i < 500; ++i) {
+    ASSERT_EQ(htstr.Exists(MakeValue<std::string>(i)), (i % 2 == 1));
+  }
+
+  // Construction from a container (copying and moving its elements)
+  lasd::Vector<int> vec(300);
+  for (int i = 0; i < 300; ++i) {
+    vec[i] = i % 200;
+  }
+  HT<int> htcpy(vec);
+  ASSERT_EQ(htcpy.Size(), 200ul);
+  ASSERT_TRUE(htcpy.Exists(199) && !htcpy.Exists(200));
+  HT<int> htmov(std::move(vec));
+  ASSERT_EQ(htmov.Size(), 200ul);
+  ASSERT_TRUE(htmov.Exists(0) && htmov.Remove(0) && !htmov.Exists(0));
+}
+
+template <template <typename> class HT>
+void TestHashTableLookup() {
+  HT<std::string> htstr;
+  for (int i = 0; i < 300; ++i) {
+    ASSERT_TRUE(htstr.Insert(MakeValue<std::string>(i)));
+  }
+
+  // Heterogeneous lookup: no temporary std::string
+  std::string buf = "str_42|str_999";
+  ASSERT_TRUE(htstr.Exists(std::string_view(buf).substr(0, 6)));
+  ASSERT_FALSE(htstr.Exists(std::string_view(buf).substr(7)));
+  ASSERT_TRUE(htstr.Exists("str_0"));
+  ASSERT_FALSE(htstr.Exists("str_"));
+
+  // Precomputed hash, shared by tables with different coefficients and sizes
+  HT<std::string> htoth(1000);
+  htoth.Insert("str_7");
+  ulong hash = lasd::HashTable<std::string>::Hash(std::string_view("str_7"));
+  ASSERT_EQ(hash, lasd::HashTable<std::string>::Hash(std::string("str_7")));
+  ASSERT_TRUE(htstr.ExistsHashed(hash, std::string_view("str_7")));
+  ASSERT_TRUE(htoth.ExistsHashed(hash, "str_7"));
+
+  // Hashed insertion and removal agree with the plain interface
+  std::string key = "key";
+  hash = lasd::HashTable<std::string>::Hash(key);
+  ASSERT_TRUE(htstr.InsertHashed(hash, key));
+  ASSERT_FALSE(htstr.InsertHashed(hash, std::string(key)));
+  ASSERT_TRUE(htstr.Exists(key));
+  ASSERT_EQ(htstr.Size(), 301ul);
+  ASSERT_TRUE(htstr.RemoveHashed(hash, key));
+  ASSERT_FALSE(htstr.RemoveHashed(hash, key));
+  ASSERT_FALSE(htstr.Exists("key"));
+
+  // Hashed insertion across a resize
+  HT<int> htint;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(htint.InsertHashed(lasd::HashTable<int>::Hash(i), i));
+  }
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(htint.Exists(i));
+    ASSERT_TRUE(htint.ExistsHashed(lasd::HashTable<int>::Hash(i), i));
+  }
+}
+
+template <template <typename> class HT>
+void TestHashTableBatch() {
+  lasd::Vector<int> keys(1000);
+  for (ulong i = 0; i < keys.Size(); ++i) {
+    keys[i] = 3 * static_cast<int>(i);
+  }
+  HT<int> ht;
+  ASSERT_TRUE(ht.InsertBatch(keys));
+  ASSERT_EQ(ht.Size(), 1000ul);
+  ASSERT_FALSE(ht.InsertBatch(keys));
+  ASSERT_EQ(ht.Size(), 1000ul);
+
+  // Probe keys: hits, misses and a partial last group
+  lasd::Vector<int> probe(3001);
+  for (ulong i = 0; i < probe.Size(); ++i) {
+    probe[i] = static_cast<int>(i);
+  }
+  lasd::Vector<bool> out;
+  ht.ExistsBatch(probe, out);
+  ASSERT_EQ(out.Size(), probe.Size());
+  for (ulong i = 0; i < probe.Size(); ++i) {
+    ASSERT_EQ(out[i], ht.Exists(probe[i]));
+    ASSERT_EQ(out[i], (i % 3 == 0) && (i < 3000));
+  }
+
+  lasd::Vector<int> empty;
+  ht.ExistsBatch(empty, out);
+  ASSERT_EQ(out.Size(), 0ul);
+  ASSERT_TRUE(ht.InsertBatch(empty));
+}
+
+inline void TestHashTableBuild() {
+  // Generator with repetitions, longer than a chunk, with and without a hint
+  for (ulong hint : {0ul, 5000ul, 10ul}) {
+    lasd::HashTableOpnAdr<int> ht;
+    ht.Insert(-1);
+    int nxt = 0;
+    ht.Build([&nxt](int & dat) {
+      if (nxt == 5000) {
+        return false;
+      }
+      dat = (nxt++ * 7919) % 3000;
+      return true;
+    }, hint);
+    ASSERT_EQ(ht.Size(), 3000ul);
+    ASSERT_FALSE(ht.Exists(-1));
+    for (int i = 0; i < 3000; ++i) {
+      ASSERT_TRUE(ht.Exists(i));
+    }
+    ASSERT_TRUE(ht.Insert(3000));
+    ASSERT_TRUE(ht.Remove(0));
+  }
+
+  // Text records, split across small chunks
+  std::string txt;
+  for (int i = 0; i < 2000; ++i) {
+    txt += std::to_string(3 * i - 1000) + ((i % 5 == 0) ? "\n" : "  ");
+  }
+  std::istringstream str(txt);
+  lasd::HashTableOpnAdr<int> htlng;
+  htlng.Build(lasd::TextSource<int>(str, 64));
+  ASSERT_EQ(htlng.Size(), 2000ul);
+  ASSERT_TRUE(htlng.Exists(-1000) && htlng.Exists(4997));
+  ASSERT_FALSE(htlng.Exists(-999));
+
+  std::istringstream dbl("0.25 +7 -1e2");
+  lasd::HashTableOpnAdr<double> htdbl;
+  htdbl.Build(lasd::TextSource<double>(dbl));
+  ASSERT_EQ(htdbl.Size(), 3ul);
+  ASSERT_TRUE(htdbl.Exists(7.0) && htdbl.Exists(-100.0) && htdbl.Exists(0.25));
+
+  // Malformed text and a truncated binary record leave the table unchanged
+  std::istringstream bad("1 2 x3");
+  ASSERT_THROW(htlng.Build(lasd::TextSource<int>(bad)), std::invalid_argument);
+  ASSERT_EQ(htlng.Size(), 2000ul);
+
+  std::string raw;
+  for (int i = 0; i < 1000; ++i) {
+    raw.append(reinterpret_cast<const char *>(&i), sizeof(i));
+  }
+  std::istringstream bin(raw);
+  lasd::BinarySource<int> src(bin, 100);
+  ASSERT_EQ(lasd::SizeHintOf(src), 1000ul);
+  lasd::HashTableOpnAdr<int> htbin;
+  htbin.Build(src);
+  ASSERT_EQ(htbin.Size(), 1000ul);
+  ASSERT_TRUE(htbin.Exists(999) && !htbin.Exists(1000));
+  std::istringstream cut(raw.substr(0, raw.size() - 3));
+  ASSERT_THROW(htbin.Build(lasd::BinarySource<int>(cut)), std::runtime_error);
+  ASSERT_EQ(htbin.Size(), 1000ul);
+}
+
+inline void TestHashTable() {
+  TestHashFunctions();
+  TestHashTableKeys<lasd::HashTableClsAdr>();
+  TestHashTableKeys<lasd::HashTableOpnAdr>();
+  TestHashTableLookup<lasd::HashTableClsAdr>();
+  TestHashTableLookup<lasd::HashTableOpnAdr>();
+  TestHashTableBatch<lasd::HashTableClsAdr>();
+  TestHashTableBatch<lasd::HashTableOpnAdr>();
+  TestHashTableBuild();
+  std::cout << "All HashTable tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef MYTEST_HTCONCURRENT_HPP
+#define MYTEST_HTCONCURRENT_HPP
+
+/* ************************************************************************** */
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../hashtable/concurrent/htconcurrent.hpp"
+
+/* ************************************************************************** */
+
+inline void TestConcurrentHashTableSequential() {
+  lasd::ConcurrentHashTable<int> htint;
+  ASSERT_TRUE(htint.Empty());
+  for (int i = -500; i <= 500; ++i) {
+    ASSERT_TRUE(htint.Insert(i));
+  }
+  ASSERT_FALSE(htint.Insert(0));
+  ASSERT_EQ(htint.Size(), 1001ul);
+  for (int i = -500; i <= 500; ++i) {
+    ASSERT_TRUE(htint.Exists(i));
+  }
+  ASSERT_FALSE(htint.Exists(501));
+
+  // Churn on a small table: tombstones are dropped by rebuilding in place
+  for (int k = 0; k < 20; ++k) {
+    for (int i = 0; i <= 500; ++i) {
+      ASSERT_TRUE(htint.Remove(i));
+    }
+    for (int i = 0; i <= 500; ++i) {
+      ASSERT_TRUE(htint.Insert(i));
+    }
+  }
+  ASSERT_EQ(htint.Size(), 1001ul);
+
+  htint.Resize(10);
+  ASSERT_EQ(htint.Size(), 1001ul);
+  ASSERT_TRUE(htint.Exists(-500));
+  ASSERT_TRUE(htint.Exists(500));
+  htint.Clear();
+  ASSERT_TRUE(htint.Empty());
+  ASSERT_FALSE(htint.Exists(0));
+  ASSERT_TRUE(htint.Insert(0));
+
+  lasd::Vector<std::string> vec(100);
+  for (int i = 0; i < 100; ++i) {
+    vec[i] = MakeValue<std::string>(i);
+  }
+  lasd::ConcurrentHashTable<std::string> htstr(vec);
+  ASSERT_EQ(htstr.Size(), 100ul);
+  ASSERT_TRUE(htstr.Exists(std::string_view("str_99")));
+  ASSERT_TRUE(htstr.ExistsHashed(lasd::HashTable<std::string>::Hash("str_5"), "str_5"));
+  ASSERT_TRUE(htstr.Remove("str_5"));
+  ASSERT_FALSE(htstr.Exists("str_5"));
+}
+
+inline void TestConcurrentHashTableThreads() {
+  const int nthr = 4;
+  const int num = 20000;
+  lasd::ConcurrentHashTable<std::string> ht(16);
+  std::vector<std::thread> thrs;
+
+  // Writers: disjoint ranges, each key inserted, half of them removed again
+  for (int t = 0; t < nthr; ++t) {
+    thrs.emplace_back([&ht, t]() {
+      for (int i = t; i < num; i += nthr) {
+        ASSERT_TRUE(ht.Insert(MakeValue<std::string>(i)));
+      }
+      for (int i = t; i < num; i += 2 * nthr) {
+        ASSERT_TRUE(ht.Remove(MakeValue<std::string>(i)));
+      }
+    });
+  }
+  // Readers: keys outside the written range are never seen, across resizes
+  for (int t = 0; t < nthr; ++t) {
+    thrs.emplace_back([&ht]() {
+      for (int k = 0; k < 5; ++k) {
+        for (int i = num; i < num + 2000; ++i) {
+          ASSERT_FALSE(ht.Exists(MakeValue<std::string>(i)));
+        }
+      }
+    });
+  }
+  for (std::thread & thr : thrs) {
+    thr.join();
+  }
+
+  ASSERT_EQ(ht.Size(), static_cast<ulong>(num / 2));
+  for (int i = 0; i < num; ++i) {
+    ASSERT_EQ(ht.Exists(MakeValue<std::string>(i)), ((i % (2 * nthr)) >= nthr));
+  }
+}
+
+inline void TestConcurrentHashTable() {
+  TestConcurrentHashTableSequential();
+  TestConcurrentHashTableThreads();
+  std::cout << "All ConcurrentHashTable tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
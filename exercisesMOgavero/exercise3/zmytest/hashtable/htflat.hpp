@@ -0,0 +1,123 @@
+
+#ifndef MYTEST_HTFLAT_HPP
+#define MYTEST_HTFLAT_HPP
+
+/* ************************************************************************** */
+
+#include <random>
+#include <string>
+#include <type_traits>
+
+#include "../util/test_utils.hpp"
+#include "hashtable.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../hashtable/opnadr/htopnadr.hpp"
+#include "../../hashtable/flat/htflat.hpp"
+
+/* ************************************************************************** */
+
+// No virtual table, no virtual base: just the counters, the coefficients and
+// the two slot arrays
+static_assert(!std::is_polymorphic_v<lasd::HashTableFlat<int>>);
+static_assert(sizeof(lasd::HashTableFlat<int>) == 5 * sizeof(ulong) + 2 * sizeof(void *));
+
+// Random operations, mirrored on HashTableOpnAdr
+
+template <typename Data>
+void TestHashTableFlatRandom(ulong ops, ulong range) {
+  std::default_random_engine gen(17);
+  std::uniform_int_distribution<int> key(0, static_cast<int>(range));
+  std::uniform_int_distribution<int> op(0, 2);
+  lasd::HashTableFlat<Data> fht;
+  lasd::HashTableOpnAdr<Data> ht;
+  for (ulong i = 0; i < ops; ++i) {
+    Data dat = MakeValue<Data>(key(gen));
+    switch (op(gen)) {
+      case 0: ASSERT_EQ(fht.Insert(dat), ht.Insert(dat)); break;
+      case 1: ASSERT_EQ(fht.Remove(dat), ht.Remove(dat)); break;
+      default: ASSERT_EQ(fht.Exists(dat), ht.Exists(dat));
+    }
+    ASSERT_EQ(fht.Size(), ht.Size());
+  }
+  for (int i = 0; i <= static_cast<int>(range); ++i) {
+    ASSERT_EQ(fht.Exists(MakeValue<Data>(i)), ht.Exists(MakeValue<Data>(i)));
+  }
+}
+
+inline void TestHashTableFlatValue() {
+  lasd::HashTableFlat<int> ht;
+  ASSERT_TRUE(ht.Empty());
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(ht.Insert(i));
+  }
+  ASSERT_EQ(ht.Fold([](const int & dat, long acc) { return acc + dat; }, 0l), 4950l);
+  ulong cnt = 0;
+  ht.Traverse([&cnt](const int &) { ++cnt; });
+  ASSERT_EQ(cnt, 100ul);
+
+  // Copy, move, comparison and Clear
+  lasd::HashTableFlat<int> htcpy(ht);
+  ASSERT_TRUE(htcpy == ht);
+  ASSERT_TRUE(htcpy.Remove(0));
+  ASSERT_TRUE(htcpy != ht);
+  lasd::HashTableFlat<int> htmov(std::move(htcpy));
+  ASSERT_EQ(htmov.Size(), 99ul);
+  ASSERT_TRUE(htcpy.Empty() && !htcpy.Exists(1));
+  ASSERT_TRUE(htcpy.Insert(1) && htcpy.Exists(1));
+  htcpy = ht;
+  ASSERT_TRUE(htcpy == ht);
+  htcpy.Clear();
+  ASSERT_TRUE(htcpy.Empty() && !htcpy.Exists(1));
+
+  // Insertions and removals do not let the tombstones fill the table
+  lasd::HashTableFlat<int> htchurn;
+  for (int i = 0; i < 100000; ++i) {
+    ASSERT_TRUE(htchurn.Insert(i));
+    ASSERT_TRUE(htchurn.Remove(i));
+  }
+  ASSERT_TRUE(htchurn.Empty());
+  ASSERT_TRUE(htchurn.MemoryUsage().slack <= 128 * sizeof(int));
+  htchurn.Resize(10);
+  ASSERT_TRUE(htchurn.Insert(7) && htchurn.Exists(7));
+}
+
+inline void TestHashTableFlatAdapter() {
+  lasd::HashTableFlat<std::string> fht;
+  lasd::DictionaryAdapter ad(fht);
+  lasd::DictionaryContainer<std::string> & dic = ad;
+  for (int i = 0; i < 200; ++i) {
+    ASSERT_TRUE(dic.Insert(MakeValue<std::string>(i)));
+  }
+  ASSERT_FALSE(dic.Insert(MakeValue<std::string>(0)));
+  ASSERT_TRUE(dic.Remove(MakeValue<std::string>(0)));
+  ASSERT_EQ(dic.Size(), 199ul);
+  ASSERT_EQ(fht.Size(), 199ul);
+  ASSERT_TRUE(dic.Exists("str_199") && !dic.Exists("str_0"));
+  ASSERT_EQ(dic.MemoryUsage().payload, fht.MemoryUsage().payload);
+
+  // As a TraversableContainer, into the containers of the library
+  lasd::HashTableOpnAdr<std::string> ht(ad);
+  ASSERT_EQ(ht.Size(), 199ul);
+  lasd::Vector<std::string> vec(ad);
+  ASSERT_EQ(vec.Size(), 199ul);
+  for (ulong i = 0; i < vec.Size(); ++i) {
+    ASSERT_TRUE(ht.Exists(vec[i]) && fht.Exists(vec[i]));
+  }
+  lasd::HashTableFlat<std::string> fhtcpy(ad);
+  ASSERT_TRUE(fhtcpy == fht);
+}
+
+inline void TestHashTableFlat() {
+  TestHashTableKeys<lasd::HashTableFlat>();
+  TestHashTableLookup<lasd::HashTableFlat>();
+  TestHashTableFlatRandom<int>(100000, 2000);
+  TestHashTableFlatRandom<std::string>(30000, 1000);
+  TestHashTableFlatValue();
+  TestHashTableFlatAdapter();
+  std::cout << "All HashTableFlat tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef MYTEST_MEMORY_HPP
+#define MYTEST_MEMORY_HPP
+
+/* ************************************************************************** */
+
+#include <string>
+
+#include "../util/test_utils.hpp"
+
+#include "../../vector/vector.hpp"
+#include "../../list/list.hpp"
+#include "../../stack/vec/stackvec.hpp"
+#include "../../stack/lst/stacklst.hpp"
+#include "../../queue/vec/queuevec.hpp"
+#include "../../queue/lst/queuelst.hpp"
+#include "../../binarytree/vec/binarytreevec.hpp"
+#include "../../binarytree/lnk/binarytreelnk.hpp"
+#include "../../bst/bst.hpp"
+#include "../../bst/avl/bstavl.hpp"
+#include "../../bst/persistent/bstpersistent.hpp"
+#include "../../hashtable/clsadr/htclsadr.hpp"
+#include "../../hashtable/opnadr/htopnadr.hpp"
+#include "../../hashtable/concurrent/htconcurrent.hpp"
+
+/* ************************************************************************** */
+
+// Checks shared by every container: the object itself is always counted, the
+// payload is that of the stored elements
+
+template <typename Data>
+void CheckMemory(const lasd::Container & con, ulong objsize) {
+  lasd::MemStats mem = con.MemoryUsage();
+  ASSERT_EQ(mem.payload, con.Size() * sizeof(Data));
+  ASSERT_TRUE(mem.overhead >= objsize);
+  ASSERT_EQ(mem.Total(), mem.payload + mem.overhead + mem.slack);
+}
+
+inline void TestMemoryLinear() {
+  lasd::Vector<std::string> vec;
+  ASSERT_EQ(vec.MemoryUsage().overhead, sizeof(vec));
+  ASSERT_EQ(vec.MemoryUsage().allocations, 0ul);
+  vec.Resize(100);
+  CheckMemory<std::string>(vec, sizeof(vec));
+  ASSERT_EQ(vec.MemoryUsage().slack, 0ul);
+  ASSERT_EQ(vec.MemoryUsage().allocations, 1ul);
+
+  // One node per element, holding at least the next pointer
+  lasd::List<int> lst;
+  lasd::StackLst<int> stklst;
+  lasd::QueueLst<int> quelst;
+  for (int i = 0; i < 100; ++i) {
+    lst.InsertAtBack(i);
+    stklst.Push(i);
+    quelst.Enqueue(i);
+  }
+  CheckMemory<int>(lst, sizeof(lst));
+  ASSERT_EQ(lst.MemoryUsage().allocations, 100ul);
+  ASSERT_TRUE(lst.MemoryUsage().overhead >= sizeof(lst) + 100 * sizeof(void *));
+  CheckMemory<int>(stklst, sizeof(stklst));
+  CheckMemory<int>(quelst, sizeof(quelst));
+  ASSERT_EQ(stklst.MemoryUsage().overhead - sizeof(stklst), lst.MemoryUsage().overhead - sizeof(lst));
+
+  // Vector-based stack and queue: the free positions are slack
+  lasd::StackVec<int> stkvec;
+  lasd::QueueVec<int> quevec;
+  for (int i = 0; i < 100; ++i) {
+    stkvec.Push(i);
+    quevec.Enqueue(i);
+  }
+  for (lasd::Container * con : {static_cast<lasd::Container *>(&stkvec), static_cast<lasd::Container *>(&quevec)}) {
+    CheckMemory<int>(*con, 0);
+    lasd::MemStats mem = con->MemoryUsage();
+    ASSERT_TRUE(mem.slack > 0 && mem.slack % sizeof(int) == 0);
+    ASSERT_EQ(mem.allocations, 1ul);
+  }
+  ulong slack = stkvec.MemoryUsage().slack;
+  stkvec.Pop();
+  ASSERT_EQ(stkvec.MemoryUsage().slack, slack + sizeof(int));
+}
+
+inline void TestMemoryTrees() {
+  lasd::Vector<int> vec(200);
+  for (ulong i = 0; i < vec.Size(); ++i) {
+    vec[i] = static_cast<int>((i * 7919) % 200);
+  }
+
+  // The node array of BinaryTreeVec exists only after Root()
+  lasd::BinaryTreeVec<int> btv(vec);
+  CheckMemory<int>(btv, sizeof(btv));
+  ASSERT_EQ(btv.MemoryUsage().allocations, 1ul);
+  ulong overhead = btv.MemoryUsage().overhead;
+  btv.Root();
+  ASSERT_EQ(btv.MemoryUsage().allocations, 2ul);
+  ASSERT_TRUE(btv.MemoryUsage().overhead > overhead + 200 * sizeof(void *));
+  btv.Clear();
+  ASSERT_EQ(btv.MemoryUsage().allocations, 0ul);
+
+  // Linked trees: one allocation per node, larger nodes for richer trees
+  lasd::BinaryTreeLnk<int> btl(vec);
+  lasd::BST<int> bst(vec);
+  lasd::BSTAVL<int> avl(vec);
+  lasd::BSTPersistent<int> pst(vec);
+  CheckMemory<int>(btl, sizeof(btl));
+  CheckMemory<int>(bst, sizeof(bst));
+  CheckMemory<int>(avl, sizeof(avl));
+  CheckMemory<int>(pst, sizeof(pst));
+  for (const lasd::Container * con : {static_cast<const lasd::Container *>(&btl), static_cast<const lasd::Container *>(&bst),
+                                      static_cast<const lasd::Container *>(&avl), static_cast<const lasd::Container *>(&pst)}) {
+    ASSERT_EQ(con->MemoryUsage().allocations, 200ul);
+    ASSERT_EQ(con->MemoryUsage().slack, 0ul);
+  }
+  ASSERT_TRUE(avl.MemoryUsage().overhead - sizeof(avl) > bst.MemoryUsage().overhead - sizeof(bst));
+  bst.Remove(0);
+  ASSERT_EQ(bst.MemoryUsage().allocations, 199ul);
+}
+
+inline void TestMemoryHashTables() {
+  // Closed addressing: every empty bucket is a whole (empty) BST
+  lasd::HashTableClsAdr<int> htc;
+  ASSERT_EQ(htc.MemoryUsage().payload, 0ul);
+  ASSERT_EQ(htc.MemoryUsage().overhead, sizeof(htc) + 128 * sizeof(lasd::BST<int>));
+  ASSERT_EQ(htc.MemoryUsage().allocations, 1ul);
+  for (int i = 0; i < 100; ++i) {
+    htc.Insert(i);
+  }
+  CheckMemory<int>(htc, sizeof(htc));
+  ASSERT_EQ(htc.MemoryUsage().allocations, 101ul);
+
+  // Open addressing and concurrent tables: the free slots are slack
+  lasd::HashTableOpnAdr<int> hto;
+  lasd::ConcurrentHashTable<int> htr;
+  for (int i = 0; i < 100; ++i) {
+    hto.Insert(i);
+    htr.Insert(i);
+  }
+  for (const lasd::Container * con : {static_cast<const lasd::Container *>(&hto), static_cast<const lasd::Container *>(&htr)}) {
+    CheckMemory<int>(*con, 0);
+    lasd::MemStats mem = con->MemoryUsage();
+    ASSERT_TRUE(mem.slack > 0 && mem.slack % sizeof(int) == 0);
+  }
+  ASSERT_EQ(hto.MemoryUsage().allocations, 2ul);
+  hto.Remove(0);
+  CheckMemory<int>(hto, sizeof(hto));
+}
+
+inline void TestMemory() {
+  TestMemoryLinear();
+  TestMemoryTrees();
+  TestMemoryHashTables();
+  std::cout << "All memory tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
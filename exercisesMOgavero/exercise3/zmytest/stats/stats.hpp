@@ -0,0 +1,114 @@
+#ifndef MYTEST_STATS_HPP
+#define MYTEST_STATS_HPP
+
+/* ************************************************************************** */
+
+#include <type_traits>
+
+#include "../util/test_utils.hpp"
+
+#include "../../stats/stats.hpp"
+#include "../../vector/vector.hpp"
+#include "../../bst/bst.hpp"
+#include "../../bst/avl/bstavl.hpp"
+#include "../../hashtable/clsadr/htclsadr.hpp"
+#include "../../hashtable/opnadr/htopnadr.hpp"
+
+/* ************************************************************************** */
+
+// Without LASD_STATS every counter stays at zero; with it (make stats=1) the
+// expected counts are checked
+
+constexpr bool StatsOn = lasd::StatsPolicy::Enabled;
+
+inline void TestStatsVector() {
+  lasd::Vector<int> vec(10);
+  ASSERT_TRUE(vec.Stats() == lasd::OpStats());
+  vec.Resize(20);
+  lasd::OpStats sts = vec.Stats();
+  ASSERT_EQ(sts.resizes, StatsOn ? 1ul : 0ul);
+  ASSERT_EQ(sts.allocations, StatsOn ? 1ul : 0ul);
+  ASSERT_EQ(sts.moves, StatsOn ? 30ul : 0ul);
+
+  lasd::Vector<int> cpy(vec);
+  ASSERT_EQ(cpy.Stats().copies, StatsOn ? 20ul : 0ul);
+  ASSERT_EQ(cpy.Stats().resizes, 0ul);
+  vec.ResetStats();
+  ASSERT_TRUE(vec.Stats() == lasd::OpStats());
+}
+
+inline void TestStatsBST() {
+  // Perfect tree of height three
+  lasd::BST<int> bst;
+  for (int key : {4, 2, 6, 1, 3, 5, 7}) {
+    ASSERT_TRUE(bst.Insert(key));
+  }
+  bst.ResetStats();
+  ASSERT_TRUE(bst.Exists(7)); // 4 < 7, 6 < 7, then equal
+  ASSERT_EQ(bst.Stats().comparisons, StatsOn ? 4ul : 0ul);
+  bst.ResetStats();
+  ASSERT_FALSE(bst.Exists(0)); // Three times greater
+  ASSERT_EQ(bst.Stats().comparisons, StatsOn ? 6ul : 0ul);
+  bst.ResetStats();
+  ASSERT_EQ(bst.Successor(3), 4);
+  ASSERT_EQ(bst.Stats().comparisons > 0, StatsOn);
+  ASSERT_EQ(bst.Stats().rotations, 0ul);
+
+  // Sorted insertions: the AVL tree rotates, the plain one does not
+  const int num = 1023;
+  lasd::BST<int> seq;
+  lasd::BSTAVL<int> avl;
+  for (int key = 0; key < num; ++key) {
+    seq.Insert(key);
+    avl.Insert(key);
+  }
+  ASSERT_EQ(seq.Stats().rotations, 0ul);
+  ASSERT_EQ(avl.Stats().rotations > 0, StatsOn);
+  ASSERT_TRUE(avl.Stats().rotations < static_cast<ulong>(num));
+  // ... and far fewer comparisons (n^2 / 2 against n log(n))
+  ASSERT_TRUE(avl.Stats().comparisons <= seq.Stats().comparisons / 20);
+  avl.ResetStats();
+  avl.Remove(0);
+  ASSERT_EQ(avl.Stats().comparisons > 0, StatsOn);
+  ASSERT_TRUE(avl.Stats().comparisons <= 2 * 11);
+}
+
+template <template <typename> class HT>
+lasd::OpStats StatsHashTable(ulong num) {
+  HT<int> ht;
+  for (ulong i = 0; i < num; ++i) {
+    ht.Insert(static_cast<int>(i));
+  }
+  lasd::OpStats ins = ht.Stats();
+  ASSERT_EQ(ins.probes >= num, StatsOn);
+  ht.ResetStats();
+  ASSERT_TRUE(ht.Stats() == lasd::OpStats());
+  for (ulong i = 0; i < num; ++i) {
+    ASSERT_FALSE(ht.Exists(static_cast<int>(num + i)));
+  }
+  ASSERT_EQ(ht.Stats().probes >= num, StatsOn);
+  return ins;
+}
+
+inline void TestStatsHashTable() {
+  const ulong num = 1000;
+  // Open addressing: the table grows, every probe step counts
+  lasd::OpStats opn = StatsHashTable<lasd::HashTableOpnAdr>(num);
+  ASSERT_EQ(opn.resizes > 0, StatsOn);
+  // Closed addressing: one probe per bucket, comparisons inside the buckets
+  lasd::OpStats cls = StatsHashTable<lasd::HashTableClsAdr>(num);
+  ASSERT_EQ(cls.probes, StatsOn ? num : 0ul);
+  ASSERT_EQ(cls.comparisons > 0, StatsOn);
+}
+
+inline void TestStats() {
+  static_assert(std::is_empty_v<lasd::NoStats>);
+  TestStatsVector();
+  TestStatsBST();
+  TestStatsHashTable();
+  std::cout << "All stats tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
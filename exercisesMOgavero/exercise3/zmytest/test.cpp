@@ -1,5 +1,16 @@
 
-// #include "..."
+#include "hashtable/hashtable.hpp"
+#include "hashtable/htconcurrent.hpp"
+#include "hashtable/htflat.hpp"
+#include "threadpool/threadpool.hpp"
+#include "binarytree/binarytreevec.hpp"
+#include "binarytree/binarytreeparallel.hpp"
+#include "binarytree/binarytreepar.hpp"
+#include "bst/bst.hpp"
+#include "bst/bstavl.hpp"
+#include "bst/bstpersistent.hpp"
+#include "stats/stats.hpp"
+#include "memory/memory.hpp"
 
 /* ************************************************************************** */
 
@@ -10,5 +21,35 @@ using namespace std;
 /* ************************************************************************** */
 
 void mytest() {
-  // ...
+  cout << endl << "~*~#~*~ Running mytest ~*~#~*~ " << endl;
+
+  cout << endl << "Running HashTable tests..." << endl;
+  TestHashTable();
+
+  cout << endl << "Running ConcurrentHashTable tests..." << endl;
+  TestConcurrentHashTable();
+
+  cout << endl << "Running HashTableFlat tests..." << endl;
+  TestHashTableFlat();
+
+  cout << endl << "Running ThreadPool tests..." << endl;
+  TestThreadPool();
+
+  cout << endl << "Running BinaryTree tests..." << endl;
+  TestBinaryTreeVec();
+  TestBinaryTreePar();
+  TestBinaryTreeParallel();
+
+  cout << endl << "Running BST tests..." << endl;
+  TestBST();
+  TestBSTAVL();
+  TestBSTPersistent();
+
+  cout << endl << "Running stats tests..." << endl;
+  TestStats();
+
+  cout << endl << "Running memory tests..." << endl;
+  TestMemory();
+
+  cout << endl << "mytest completed." << endl;
 }
@@ -0,0 +1,69 @@
+#ifndef MYTEST_THREADPOOL_HPP
+#define MYTEST_THREADPOOL_HPP
+
+/* ************************************************************************** */
+
+#include <atomic>
+#include <stdexcept>
+
+#include "../util/test_utils.hpp"
+
+#include "../../threadpool/threadpool.hpp"
+
+/* ************************************************************************** */
+
+// Naive parallel Fibonacci: deep nesting of forks
+
+inline ulong ParFib(lasd::ThreadPool & pool, ulong n) {
+  if (n < 2) {
+    return n;
+  }
+  ulong a = 0;
+  ulong b = 0;
+  pool.Invoke([&]() { a = ParFib(pool, n - 1); }, [&]() { b = ParFib(pool, n - 2); });
+  return a + b;
+}
+
+inline void TestThreadPoolSize(ulong threads) {
+  lasd::ThreadPool pool(threads);
+  ASSERT_EQ(pool.Threads(), (threads == 0) ? 1ul : threads);
+
+  ASSERT_EQ(ParFib(pool, 20), 6765ul);
+
+  // Every index exactly once, in ranges of at most grain indices
+  for (ulong num : {0ul, 1ul, 7ul, 1000ul, 100000ul}) {
+    std::atomic<ulong> * hits = new std::atomic<ulong>[num + 1] {};
+    std::atomic<ulong> calls = 0;
+    pool.For(0, num, 64, [&](ulong lo, ulong hi) {
+      ASSERT_TRUE(lo < hi && hi - lo <= 64);
+      calls.fetch_add(1);
+      for (ulong i = lo; i < hi; ++i) {
+        hits[i].fetch_add(1);
+      }
+    });
+    for (ulong i = 0; i < num; ++i) {
+      ASSERT_EQ(hits[i].load(), 1ul);
+    }
+    ASSERT_TRUE(calls.load() >= num / 64);
+    delete[] hits;
+  }
+
+  // Exceptions reach the caller, from either side of a fork
+  ASSERT_THROW(pool.Invoke([]() { throw std::runtime_error("left"); }, []() {}), std::runtime_error);
+  ASSERT_THROW(pool.Invoke([]() {}, []() { throw std::runtime_error("right"); }), std::runtime_error);
+  ASSERT_THROW(pool.For(0, 1000, 10, [](ulong lo, ulong) { if (lo >= 500) { throw std::logic_error("range"); } }), std::logic_error);
+  ASSERT_EQ(ParFib(pool, 15), 610ul);
+}
+
+inline void TestThreadPool() {
+  for (ulong threads : {0ul, 1ul, 2ul, 8ul}) {
+    TestThreadPoolSize(threads);
+  }
+  ASSERT_TRUE(lasd::ThreadPool::Default().Threads() >= 1);
+  ASSERT_EQ(ParFib(lasd::ThreadPool::Default(), 10), 55ul);
+  std::cout << "All ThreadPool tests passed\n";
+}
+
+/* ************************************************************************** */
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef TEST_UTILS_HPP
+#define TEST_UTILS_HPP
+
+/* ************************************************************************** */
+
+#include <cassert>
+#include <string>
+#include <iostream>
+#include <typeinfo>
+#include <stdexcept>
+
+/* ************************************************************************** */
+
+// Test macros
+
+#define ASSERT_EQ(x, y) assert((x) == (y))
+#define ASSERT_NE(x, y) assert((x) != (y))
+#define ASSERT_TRUE(x)  assert(x)
+#define ASSERT_FALSE(x) assert(!(x))
+#define ASSERT_THROW(expr, exc_type)                        \
+  try { expr; assert(false); } catch (const exc_type &) {}  \
+  catch (...) { assert(false); }
+
+/* ************************************************************************** */
+
+// MakeValue<T>: deterministic test values of each element type
+
+template <typename T>
+T MakeValue(int i);
+
+template <>
+inline int MakeValue<int>(int i) { return i; }
+
+template <>
+inline double MakeValue<double>(int i) { return i; }
+
+template <>
+inline std::string MakeValue<std::string>(int i) {
+  return "str_" + std::to_string(i);
+}
+
+/* ************************************************************************** */
+
+#endif